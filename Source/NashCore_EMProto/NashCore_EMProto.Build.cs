@@ -9,8 +9,8 @@ public class NashCore_EMProto : ModuleRules
 		// Enable explicit or shared precompiled headers to keep compile times predictable.
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 	
-		// Expose core engine and input modules required by the simulation framework.
-		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput", "GameplayTags", "NavigationSystem", "AIModule", "GameplayTasks", "UMG", "Slate", "SlateCore" });
+		// Expose core engine, input and MassEntity modules required by the simulation framework.
+		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput", "GameplayTags", "NavigationSystem", "AIModule", "GameplayTasks", "UMG", "Slate", "SlateCore", "MassEntity" });
 
 		// No private-only dependencies are needed at this stage; keep the list explicit for clarity.
 		PrivateDependencyModuleNames.AddRange(new string[] {  });
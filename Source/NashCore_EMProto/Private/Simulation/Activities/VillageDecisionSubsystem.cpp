@@ -0,0 +1,140 @@
+// Includes the decision stage declaration.
+#include "Simulation/Activities/VillageDecisionSubsystem.h"
+
+// Region: Engine includes.
+#pragma region EngineIncludes
+// Provides the parallel decision evaluation.
+#include "Async/ParallelFor.h"
+// Provides world access for subsystem lookups.
+#include "Engine/World.h"
+#pragma endregion EngineIncludes
+
+// Region: Simulation includes.
+#pragma region SimulationIncludes
+// Provides the villagers whose decisions are evaluated.
+#include "Simulation/Activities/VillagerActivityComponent.h"
+// Provides per-stage timing buckets.
+#include "Simulation/Core/VillageSimProfiler.h"
+// Provides the decision phase hook.
+#include "Simulation/Time/VillageClockSubsystem.h"
+#pragma endregion SimulationIncludes
+
+// Region: Local constants.
+#pragma region LocalConstants
+namespace
+{
+	// Decisions handed to each parallel task; small batches run inline.
+	constexpr int32 DecisionBatchSize = 32;
+}
+#pragma endregion LocalConstants
+
+// Binds to the clock's decision phase.
+void UVillageDecisionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection); // Preserve base initialization.
+
+	if (UVillageClockSubsystem* Clock = Collection.InitializeDependency<UVillageClockSubsystem>()) // Ensure the clock exists first.
+	{
+		DecisionPhaseHandle = Clock->OnMinuteDecisionPhase.AddUObject(this, &UVillageDecisionSubsystem::ProcessDecisions); // Run after each minute's wakeups.
+	}
+}
+
+// Unbinds from the clock and drops pending requests.
+void UVillageDecisionSubsystem::Deinitialize()
+{
+	if (UVillageClockSubsystem* Clock = GetWorld() ? GetWorld()->GetSubsystem<UVillageClockSubsystem>() : nullptr) // Resolve the clock if it still exists.
+	{
+		Clock->OnMinuteDecisionPhase.Remove(DecisionPhaseHandle); // Stop receiving decision phases.
+	}
+
+	PendingVillagers.Reset(); // Drop queued villagers.
+	PendingKinds.Reset(); // Drop queued kinds.
+	PendingSlots.Reset(); // Drop slot lookups.
+	StepVillagers.Reset(); // Drop step villagers.
+	StepCommands.Reset(); // Drop step commands.
+
+	Super::Deinitialize(); // Preserve base cleanup.
+}
+
+// Decisions can only wait while the clock runs wakeups; the decision phase follows in the same minute.
+bool UVillageDecisionSubsystem::CanDeferDecisions() const
+{
+	if (!bStageEnabled) // Stage disabled; villagers decide immediately.
+	{
+		return false; // Decide now.
+	}
+
+	const UVillageClockSubsystem* Clock = GetWorld() ? GetWorld()->GetSubsystem<UVillageClockSubsystem>() : nullptr; // Resolve the clock.
+	return Clock && Clock->IsDispatchingWakeups(); // Defer only inside the wakeup dispatch.
+}
+
+// Queues a villager's decision.
+void UVillageDecisionSubsystem::QueueDecision(UVillagerActivityComponent* ActivityComponent, EVillagerDecisionKind Kind)
+{
+	if (!ActivityComponent) // Validate the villager.
+	{
+		return; // Nothing to queue.
+	}
+
+	if (const int32* Slot = PendingSlots.Find(ActivityComponent)) // Already queued this minute.
+	{
+		PendingKinds[*Slot] = Kind; // The latest request reflects the villager's current state.
+		return; // Keep its original position.
+	}
+
+	PendingSlots.Add(ActivityComponent, PendingVillagers.Add(ActivityComponent)); // Remember the slot for later requests.
+	PendingKinds.Add(Kind); // Kind parallel to the villager.
+}
+
+// Enables or disables the stage.
+void UVillageDecisionSubsystem::SetStageEnabled(bool bInEnabled)
+{
+	bStageEnabled = bInEnabled; // Store the switch.
+}
+
+// Evaluates queued decisions in parallel, then applies them in request order.
+void UVillageDecisionSubsystem::ProcessDecisions(int64 Minute)
+{
+	if (PendingVillagers.Num() == 0) // Nothing queued this minute.
+	{
+		LastStepDecisionCount = 0; // Report an empty step.
+		return; // Skip the stage.
+	}
+
+	VILLAGE_SIM_SCOPE(ActivitySelection); // Count the stage in the simulation benchmark.
+
+	StepVillagers.Reset(); // Reuse allocations across minutes.
+	StepCommands.Reset(); // Clear step commands.
+
+	for (int32 Slot = 0; Slot < PendingVillagers.Num(); ++Slot) // Snapshot the queue in request order.
+	{
+		UVillagerActivityComponent* Villager = PendingVillagers[Slot].Get(); // Resolve the queued villager.
+		if (!IsValid(Villager) || Villager->IsBeingDestroyed()) // Skip villagers being removed.
+		{
+			continue; // Died after requesting the decision.
+		}
+
+		StepVillagers.Add(Villager); // Evaluate this villager.
+		StepCommands.AddDefaulted_GetRef().Kind = PendingKinds[Slot]; // Decision kind requested.
+	}
+
+	PendingVillagers.Reset(); // Clear the queue before applying.
+	PendingKinds.Reset(); // Clear queued kinds.
+	PendingSlots.Reset(); // Clear slot lookups.
+
+	ParallelFor(TEXT("VillageDecisionStage"), StepVillagers.Num(), DecisionBatchSize, [this](int32 Index) // Evaluations only read villager state.
+	{
+		StepCommands[Index] = StepVillagers[Index]->EvaluateDecision(StepCommands[Index].Kind); // Evaluate without touching the world.
+	});
+
+	for (int32 Index = 0; Index < StepVillagers.Num(); ++Index) // Apply on the game thread in request order.
+	{
+		UVillagerActivityComponent* Villager = StepVillagers[Index]; // Villager owning the command.
+		if (IsValid(Villager) && !Villager->IsBeingDestroyed()) // Skip villagers removed by earlier commands.
+		{
+			Villager->ApplyDecision(StepCommands[Index]); // Requests made while applying run immediately.
+		}
+	}
+
+	LastStepDecisionCount = StepVillagers.Num(); // Report the step size.
+}
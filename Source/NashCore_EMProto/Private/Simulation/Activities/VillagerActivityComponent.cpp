@@ -7,12 +7,21 @@
 #include "Engine/World.h"
 // Supplies timer manager functionality.
 #include "TimerManager.h"
-// Provides actor iteration utilities for provider lookup.
-#include "EngineUtils.h"
 // Exposes actor accessors for provider presence validation.
 #include "GameFramework/Actor.h"
+// Supplies benchmark timing scopes.
+#include "Simulation/Core/VillageSimProfiler.h"
+// Supplies the provider index used for resource lookups.
+#include "Simulation/Social/VillageProviderRegistry.h"
+// Supplies travel costs between registered locations for provider choice.
+#include "Simulation/Movement/VillageNavigationCache.h"
+// Supplies the village-wide needs stage.
+#include "Simulation/Needs/VillageNeedsSubsystem.h"
 #pragma endregion EngineIncludes
 
+// Salt keeping activity decisions independent of other streams derived from the same villager seed.
+static constexpr uint32 DecisionStreamSalt = 0x41435456;
+
 // Default constructor configuring tick usage and defaults.
 UVillagerActivityComponent::UVillagerActivityComponent()
 	: bHasActiveActivity(false) // No activity at creation.
@@ -40,31 +49,51 @@ void UVillagerActivityComponent::BeginPlay()
 	if (UWorld* World = GetWorld()) // Validate world.
 	{
 		ClockSubsystem = World->GetSubsystem<UVillageClockSubsystem>(); // Cache clock subsystem.
+		InitializeDecisionStream(); // Seed decisions before the first activity is chosen.
+		NeedsStage = World->GetSubsystem<UVillageNeedsSubsystem>(); // Cache the village needs stage.
+		DecisionStage = World->GetSubsystem<UVillageDecisionSubsystem>(); // Cache the village decision stage.
+
+		if (NeedsStage && !IsNeedsLazy()) // Let the stage integrate this villager's curves; lazy needs are evaluated analytically.
+		{
+			NeedsStage->RegisterVillager(this); // Register for per-minute integration.
+		}
 
 		if (ClockSubsystem) // Ensure clock exists.
 		{
-			ClockSubsystem->OnMinuteChanged.AddDynamic(this, &UVillagerActivityComponent::OnMinuteTick); // Subscribe to minute tick.
+			LastProcessedMinute = ClockSubsystem->GetTotalMinutes(); // Start integrating from the current minute.
 		}
 	}
 
-	StartNextPlannedActivity(); // Begin initial activity.
+	if (bAutoStartOnBeginPlay) // Owner did not take over the first activity.
+	{
+		StartNextPlannedActivity(); // Begin initial activity.
+	}
 }
 
-// Tries to start the next planned activity based on schedule.
-void UVillagerActivityComponent::StartNextPlannedActivity()
+// Cancels pending wakeups so the clock never calls into a removed component.
+void UVillagerActivityComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (TryStartNeedSatisfyingActivity(EVillagerNeedUrgency::Critical)) // Prioritize critical needs.
+	if (ClockSubsystem) // Validate clock.
 	{
-		return; // Already started satisfying activity.
+		ClockSubsystem->CancelWakeup(WakeupHandle); // Drop the pending wakeup.
 	}
 
-	if (!TryStartScheduledActivity()) // Attempt to start scheduled PartOfDay activity.
+	if (NeedsStage) // Validate stage.
 	{
-		if (TryStartNeedSatisfyingActivity(EVillagerNeedUrgency::Mild)) // Fallback to mild needs.
-		{
-			return; // Started mild need satisfier.
-		}
+		NeedsStage->UnregisterVillager(this); // Stop integrating this villager.
 	}
+
+	ClearActivityTimers(); // Stop retry timers.
+
+	ReleaseActivityLocation(); // Return the reserved spot to the registry.
+
+	Super::EndPlay(EndPlayReason); // Preserve parent cleanup.
+}
+
+// Tries to start the next planned activity based on schedule.
+void UVillagerActivityComponent::StartNextPlannedActivity()
+{
+	RequestDecision(EVillagerDecisionKind::PlanNext); // Decide now or in this minute's decision phase.
 }
 
 // Forces a specific activity by tag.
@@ -75,13 +104,10 @@ void UVillagerActivityComponent::ForceActivityByTag(const FGameplayTag& Activity
 		return; // Abort if missing.
 	}
 
-	for (const FActivityDefinition& Definition : Archetype->ActivityDefinitions) // Iterate definitions.
+	const int32 ActivityIndex = Archetype->GetCompiledArchetype().FindActivityIndex(ActivityTag); // Look up the activity.
+	if (ActivityIndex != INDEX_NONE) // Match by tag.
 	{
-		if (Definition.ActivityTag == ActivityTag) // Match by tag.
-		{
-			BeginActivity(Definition); // Start matched activity.
-			return; // Stop searching.
-		}
+		BeginActivity(Archetype->ActivityDefinitions[ActivityIndex]); // Start matched activity.
 	}
 }
 
@@ -102,11 +128,42 @@ void UVillagerActivityComponent::SetArchetype(UVillagerArchetypeDataAsset* InArc
 {
 	Archetype = InArchetype; // Store archetype pointer.
 	ApplyArchetypeTuning(); // Pull archetype-driven tuning into component state. 
+
+	if (ClockSubsystem) // Already begun play; the stream was seeded without this archetype.
+	{
+		InitializeDecisionStream(); // Reseed with the villager id.
+	}
+}
+
+// Handles a scheduled wakeup from the clock.
+void UVillagerActivityComponent::HandleWakeup()
+{
+	WakeupHandle.Reset(); // The wheel retired this entry.
+
+	if (!ClockSubsystem) // Validate clock.
+	{
+		return; // Cannot process without time data.
+	}
+
+	FVillagerNeedsBatchScope NeedsBatch(NeedsComponent); // Coalesce this step's need changes into one notification.
+
+	const int64 Now = ClockSubsystem->GetTotalMinutes(); // Minute being dispatched.
+	CatchUpSkippedMinutes(Now - 1); // Integrate the quiet minutes before this one.
+	if (IsNeedsLazy()) // Lazy needs accrued analytically since their anchors.
+	{
+		NeedsComponent->SyncLazyNeeds(); // Settle values up to and including this minute.
+	}
+	OnMinuteTick(ClockSubsystem->GetCurrentHour(), ClockSubsystem->GetCurrentMinute()); // Process the due minute.
 }
 
-// Handles per-minute updates from the clock.
+// Processes a simulated minute for the active activity.
 void UVillagerActivityComponent::OnMinuteTick(int32 Hour, int32 Minute)
 {
+	if (ClockSubsystem) // Record progress so the next catch-up starts after this minute.
+	{
+		LastProcessedMinute = ClockSubsystem->GetTotalMinutes(); // Mark this minute as processed.
+	}
+
 	if (!bHasActiveActivity) // Skip when idle.
 	{
 		return; // Nothing to process.
@@ -138,19 +195,223 @@ void UVillagerActivityComponent::OnMinuteTick(int32 Hour, int32 Minute)
 	{
 		RunNeedInterruptionCheck(); // Evaluate interruption chance after this minute update.
 	}
+
+	if (bHasActiveActivity) // Keep following the activity that is active after this minute.
+	{
+		UpdateLazyNeedRates(); // Continue with the rate segment of the next minute.
+		ScheduleNextWakeup(); // Register the next minute needing attention.
+	}
+}
+
+// Applies the need deltas of minutes that elapsed without a wakeup.
+void UVillagerActivityComponent::CatchUpSkippedMinutes(int64 UpToMinute)
+{
+	VILLAGE_SIM_SCOPE(Needs); // Count need updates in the simulation benchmark.
+
+	const int64 SkippedMinutes = UpToMinute - LastProcessedMinute; // Minutes not yet integrated.
+	if (SkippedMinutes <= 0) // Already up to date.
+	{
+		return; // Nothing to integrate.
+	}
+
+	LastProcessedMinute = UpToMinute; // Mark the range as processed.
+
+	if (!bHasActiveActivity || !NeedsComponent || IsNeedsStageActive() || IsNeedsLazy()) // Idle villagers accumulate no deltas; the stage or lazy rates already cover them.
+	{
+		CurrentRuntimeState.ElapsedMinutes += bHasActiveActivity ? static_cast<float>(SkippedMinutes) : 0.0f; // Keep activity time in step with the clock.
+		return; // Nothing else to do.
+	}
+
+	for (const FVillagerCompiledNeedCurve& NeedCurve : GetActiveNeedCurves()) // Integrate each curve independently.
+	{
+		const FNeedDefinition& Definition = NeedsComponent->GetNeedDefinition(NeedCurve.NeedIndex); // Shared need definition.
+		const float StartValue = NeedsComponent->GetNeedValue(NeedCurve.NeedIndex); // Stored value before the skipped range.
+
+		float Value = StartValue; // Start from the stored value.
+		for (int64 Offset = 0; Offset < SkippedMinutes; ++Offset) // Replay the skipped minutes with per-minute clamping.
+		{
+			const float Delta = NeedCurve.SampleDelta(CurrentRuntimeState.ElapsedMinutes + static_cast<float>(Offset)); // Sample the delta for that minute.
+			Value = FMath::Clamp(Value + Delta, Definition.MinValue, Definition.MaxValue); // Apply with the same clamping as a live tick.
+		}
+
+		const float NetDelta = Value - StartValue; // Net change across the skipped range.
+		if (NetDelta != 0.0f) // Skip no-op updates.
+		{
+			NeedsComponent->ApplyNeedDeltaByIndex(NeedCurve.NeedIndex, NetDelta); // Apply the accumulated change once.
+		}
+	}
+
+	CurrentRuntimeState.ElapsedMinutes += static_cast<float>(SkippedMinutes); // Advance activity time across the skipped range.
+}
+
+// Integrates every minute up to the current clock minute.
+void UVillagerActivityComponent::SyncToCurrentMinute()
+{
+	if (ClockSubsystem) // Validate clock.
+	{
+		FVillagerNeedsBatchScope NeedsBatch(NeedsComponent); // Notify once for the whole catch-up.
+		CatchUpSkippedMinutes(ClockSubsystem->GetTotalMinutes()); // Apply deltas the villager would have received by now.
+	}
+}
+
+// Registers the next minute at which this villager needs attention.
+void UVillagerActivityComponent::ScheduleNextWakeup()
+{
+	if (!ClockSubsystem) // Validate clock.
+	{
+		return; // Cannot schedule without a clock.
+	}
+
+	ClockSubsystem->CancelWakeup(WakeupHandle); // Replace any previous wakeup.
+
+	if (!bHasActiveActivity) // Idle villagers are restarted by retry timers instead.
+	{
+		return; // Nothing to schedule.
+	}
+
+	const int64 DueMinute = ClockSubsystem->GetTotalMinutes() + ComputeMinutesUntilAttention(); // Resolve the absolute due minute.
+	WakeupHandle = ClockSubsystem->ScheduleWakeup(DueMinute, FOnVillageWakeup::CreateUObject(this, &UVillagerActivityComponent::HandleWakeup)); // Register with the timing wheel.
+}
+
+// Computes how many minutes may pass before the activity needs processing again.
+int64 UVillagerActivityComponent::ComputeMinutesUntilAttention() const
+{
+	const FActivityDefinition& Definition = CurrentRuntimeState.Definition; // Alias the active definition.
+
+	int64 Minutes = FMath::Max(1, MaxWakeupIntervalMinutes); // Start from the re-sampling cap.
+
+	if (Definition.bIsPartOfDay) // Scheduled activities end when the window closes.
+	{
+		Minutes = FMath::Min(Minutes, GetMinutesUntilWindowExit(Definition.PartOfDayWindow)); // Wake on window exit.
+
+		if (!CurrentRuntimeState.bWaitingForMovement && NeedsComponent && NeedsComponent->FindHighestPriorityNeed(EVillagerNeedUrgency::Mild) != INDEX_NONE) // Interruption rolls happen every minute while a need is urgent.
+		{
+			return 1; // Wake on the next minute.
+		}
+	}
+	else // Duration-based activities end once elapsed time reaches the duration.
+	{
+		const float MinutesUntilEnd = Definition.NonDailyDurationMinutes - CurrentRuntimeState.ElapsedMinutes + 1.0f; // The completion check sees elapsed time before this minute's increment.
+		Minutes = FMath::Min(Minutes, static_cast<int64>(FMath::CeilToFloat(FMath::Max(1.0f, MinutesUntilEnd)))); // Wake on completion.
+	}
+
+	Minutes = FMath::Min(Minutes, PredictMinutesUntilNeedBandChange(Minutes)); // Wake when a need changes band or bottoms out.
+
+	return FMath::Max<int64>(1, Minutes); // Never schedule the current minute.
+}
+
+// Returns the minutes until the clock leaves the supplied window.
+int64 UVillagerActivityComponent::GetMinutesUntilWindowExit(const FActivityTimeWindow& Window) const
+{
+	if (!ClockSubsystem) // Validate clock.
+	{
+		return 1; // Re-evaluate soon when time data is missing.
+	}
+
+	const int32 Hour = ClockSubsystem->GetCurrentHour(); // Current hour.
+	const int32 Minute = ClockSubsystem->GetCurrentMinute(); // Current minute.
+
+	if (Hour >= Window.AllowedEndHour || Hour < Window.AllowedStartHour) // Already outside the window.
+	{
+		return 1; // The next tick completes the activity.
+	}
+
+	for (int32 HoursAhead = 1; HoursAhead <= 24; ++HoursAhead) // Walk hour boundaries until the window closes.
+	{
+		const int32 FutureHour = (Hour + HoursAhead) % 24; // Hour after the boundary.
+		if (FutureHour >= Window.AllowedEndHour || FutureHour < Window.AllowedStartHour) // Window closed at this boundary.
+		{
+			return (60 - Minute) + 60 * (HoursAhead - 1); // Minutes until that boundary.
+		}
+	}
+
+	return MAX_int64; // The window spans the whole day.
+}
+
+// Predicts the minutes until any need affected by the activity crosses a band boundary within a horizon.
+int64 UVillagerActivityComponent::PredictMinutesUntilNeedBandChange(int64 HorizonMinutes) const
+{
+	int64 BestMinutes = MAX_int64; // No crossing predicted yet.
+
+	if (IsNeedsLazy() && ClockSubsystem) // Lazy needs solve their own crossing minutes.
+	{
+		const int64 EventMinute = NeedsComponent->PredictNextNeedEventMinute(); // Earliest crossing or rate change.
+		return EventMinute == MAX_int64 ? BestMinutes : FMath::Max<int64>(1, EventMinute - ClockSubsystem->GetTotalMinutes()); // Convert to minutes from now.
+	}
+
+	if (!NeedsComponent || IsNeedsStageActive()) // The stage reports band crossings as events instead.
+	{
+		return BestMinutes; // Nothing to predict.
+	}
+
+	const int64 FirstElapsedMinute = static_cast<int64>(CurrentRuntimeState.ElapsedMinutes); // Elapsed minute sampled on the next tick.
+
+	for (const FVillagerCompiledNeedCurve& NeedCurve : GetActiveNeedCurves()) // Inspect each affected need.
+	{
+		const FNeedDefinition& Definition = NeedsComponent->GetNeedDefinition(NeedCurve.NeedIndex); // Shared need definition.
+		const float Range = FMath::Max(KINDA_SMALL_NUMBER, Definition.MaxValue - Definition.MinValue); // Safe value range.
+		const float Boundaries[] = { // Values at which urgency or survival changes.
+			Definition.MinValue + Range * Definition.Thresholds.MildThreshold,
+			Definition.MinValue + Range * Definition.Thresholds.CriticalThreshold,
+			Definition.MinValue + KINDA_SMALL_NUMBER
+		};
+
+		float Value = NeedsComponent->GetNeedValue(NeedCurve.NeedIndex); // Value at the start of the segment being walked.
+		int64 ElapsedMinute = FirstElapsedMinute; // First elapsed minute of that segment.
+		int64 MinutesAhead = 0; // Minutes from now until that segment starts.
+
+		while (MinutesAhead < FMath::Min(HorizonMinutes, BestMinutes)) // Later crossings cannot wake the villager earlier.
+		{
+			int64 SegmentEnd = MAX_int64; // First elapsed minute of the next segment.
+			const float Rate = NeedCurve.FindRateSegment(ElapsedMinute, SegmentEnd); // Constant delta across the segment.
+			const int64 SegmentMinutes = SegmentEnd == MAX_int64 ? MAX_int64 : SegmentEnd - ElapsedMinute; // Minutes the segment lasts.
+
+			if (Rate < 0.0f) // Rising needs never fall into a more urgent band.
+			{
+				for (const float Boundary : Boundaries) // Find the nearest boundary below the current value.
+				{
+					if (Value <= Boundary) // Already at or below this boundary.
+					{
+						continue; // Only future crossings matter.
+					}
+
+					const int64 Minutes = FMath::Max<int64>(1, static_cast<int64>(FMath::CeilToFloat((Value - Boundary) / -Rate))); // Minutes into the segment.
+					if (Minutes <= SegmentMinutes) // Crossed before the rate changes.
+					{
+						BestMinutes = FMath::Min(BestMinutes, MinutesAhead + Minutes); // Keep the earliest crossing.
+					}
+				}
+			}
+
+			if (SegmentMinutes == MAX_int64) // The last segment continues forever.
+			{
+				break; // Nothing left to walk.
+			}
+
+			Value = FMath::Clamp(Value + Rate * static_cast<float>(SegmentMinutes), Definition.MinValue, Definition.MaxValue); // Value once the segment ends.
+			ElapsedMinute = SegmentEnd; // Continue with the next segment.
+			MinutesAhead += SegmentMinutes; // Time spent in the segment.
+		}
+	}
+
+	return BestMinutes; // Earliest predicted crossing.
 }
 
 // Starts executing a specific activity definition.
 void UVillagerActivityComponent::BeginActivity(const FActivityDefinition& Definition)
 {
+	SyncToCurrentMinute(); // Settle the previous activity's deltas before switching.
+
 	ClearActivityTimers(); // Reset timers from previous activity.
 
+	ReleaseActivityLocation(); // Free the spot held by the previous activity.
+
 	if (IsActivityInProviderCooldown(Definition.ActivityTag)) // Guard against retrying activities during provider cooldown. 
 	{
-		bHasActiveActivity = false; // Mark activity inactive. 
+		MarkActivityInactive(); // Mark activity inactive. 
 		if (LogComponent) // Log the skip for clarity. 
 		{
-			LogComponent->LogMessage(FString::Printf(TEXT("Delaying activity %s due to provider cooldown."), *UVillagerLogComponent::GetShortTagString(Definition.ActivityTag))); // Emit cooldown delay log. 
+			LogComponent->LogEvent(EVillageEventType::ActivityCooldownDelayed, FVillageEventParams().SetActivity(Definition.ActivityTag)); // Emit cooldown delay log. 
 		}
 		if (UWorld* World = GetWorld()) // Schedule a retry after the cooldown expires. 
 		{
@@ -160,6 +421,8 @@ void UVillagerActivityComponent::BeginActivity(const FActivityDefinition& Defini
 	}
 
 	CurrentRuntimeState.Definition = Definition; // Cache definition.
+	CurrentActivityIndex = Archetype ? Archetype->GetCompiledArchetype().FindActivityIndex(Definition.ActivityTag) : INDEX_NONE; // Resolve compiled curves for the activity.
+	ActivityStartMinute = ClockSubsystem ? ClockSubsystem->GetTotalMinutes() : 0; // Deltas start on the next minute.
 	CurrentRuntimeState.ElapsedMinutes = 0.0f; // Reset elapsed time.
 	CurrentRuntimeState.bWaitingForMovement = false; // Reset movement wait flag.
 	bFetchingResource = false; // Reset resource fetching flag.
@@ -169,33 +432,42 @@ void UVillagerActivityComponent::BeginActivity(const FActivityDefinition& Defini
 
 	bHasActiveActivity = true; // Mark activity active.
 
+	if (ClockSubsystem) // Begin integrating from the current minute.
+	{
+		LastProcessedMinute = ClockSubsystem->GetTotalMinutes(); // Deltas start on the next minute.
+	}
+	UpdateLazyNeedRates(); // Start the activity's first rate segments.
+	ScheduleNextWakeup(); // Register the first wakeup for this activity.
+
 	// Ensure the location can be resolved before logging/starting movement.
 	if (Definition.bRequiresSpecificLocation && MovementComponent)
 	{
-		FTransform Dummy;
-		if (!ResolveActivityTransform(Definition, Dummy))
+		FTransform ReservedTransform;
+		if (!AcquireActivityLocation(Definition, ReservedTransform))
 		{
 			if (LogComponent)
 			{
-				LogComponent->LogMessage(FString::Printf(TEXT("Activity %s has no valid location; skipping."), *UVillagerLogComponent::GetShortTagString(Definition.ActivityTag)));
+				LogComponent->LogEvent(EVillageEventType::ActivityLocationMissing, FVillageEventParams().SetActivity(Definition.ActivityTag));
 			}
-			bHasActiveActivity = false;
+			MarkActivityInactive();
 			if (UWorld* World = GetWorld())
 			{
 				World->GetTimerManager().SetTimer(MovementFailureRetryHandle, this, &UVillagerActivityComponent::StartNextPlannedActivity, MovementFailureRetryDelaySeconds, false);
 			}
 			return;
 		}
-		CachedActivityTransform = Dummy; // Cache the resolved transform.
+		CachedActivityTransform = ReservedTransform; // Cache the reserved instance transform.
 		bHasCachedActivityTransform = true; // Mark cache valid.
 	}
 
 	if (LogComponent) // Log start event.
 	{
-		const FString LocationInfo = Definition.bRequiresSpecificLocation
-			? FString::Printf(TEXT(" at %s"), *UVillagerLogComponent::GetShortTagString(Definition.ActivityLocationTag))
-			: FString();
-		LogComponent->LogMessage(FString::Printf(TEXT("Starting activity: %s%s"), *UVillagerLogComponent::GetShortTagString(Definition.ActivityTag), *LocationInfo)); // Emit log with context.
+		FVillageEventParams Event = FVillageEventParams().SetActivity(Definition.ActivityTag); // Describe the started activity.
+		if (Definition.bRequiresSpecificLocation) // Mention the location only when the activity travels.
+		{
+			Event.SetLocation(Definition.ActivityLocationTag);
+		}
+		LogComponent->LogEvent(EVillageEventType::ActivityStarted, Event); // Emit log with context.
 	}
 
 	if (Definition.bRequiresSpecificLocation && MovementComponent) // Handle movement requirement.
@@ -213,11 +485,11 @@ void UVillagerActivityComponent::BeginActivity(const FActivityDefinition& Defini
 
 				if (LogComponent)
 				{
-					LogComponent->LogMessage(FString::Printf(TEXT("Fetching resource %s from %s at %s before %s."),
-						*UVillagerLogComponent::GetShortTagString(Definition.RequiredResourceTag),
-						*UVillagerLogComponent::GetShortTagString(ProviderContext.ProviderIdTag),
-						*UVillagerLogComponent::GetShortTagString(ProviderContext.TradeLocationTag),
-						*UVillagerLogComponent::GetShortTagString(Definition.ActivityTag)));
+					LogComponent->LogEvent(EVillageEventType::ResourceFetchStarted, FVillageEventParams()
+						.SetResource(Definition.RequiredResourceTag)
+						.SetTarget(ProviderContext.ProviderIdTag)
+						.SetLocation(ProviderContext.TradeLocationTag)
+						.SetActivity(Definition.ActivityTag));
 				}
 
 				MovementComponent->RequestMoveToLocation(ProviderContext.TradeLocationTransform, MovementComponent->GetAcceptanceRadius(), FOnVillagerMovementFinished::CreateUObject(this, &UVillagerActivityComponent::HandleResourceMovementFinished)); // Move to provider.
@@ -225,9 +497,9 @@ void UVillagerActivityComponent::BeginActivity(const FActivityDefinition& Defini
 			}
 			else if (LogComponent)
 			{
-				LogComponent->LogMessage(FString::Printf(TEXT("No provider found for %s; proceeding to %s without fetch."),
-					*UVillagerLogComponent::GetShortTagString(Definition.RequiredResourceTag),
-					*UVillagerLogComponent::GetShortTagString(Definition.ActivityTag)));
+				LogComponent->LogEvent(EVillageEventType::ResourceProviderMissing, FVillageEventParams()
+					.SetResource(Definition.RequiredResourceTag)
+					.SetActivity(Definition.ActivityTag));
 			}
 		}
 
@@ -245,16 +517,19 @@ void UVillagerActivityComponent::BeginActivity(const FActivityDefinition& Defini
 // Handles completion of movement before performing the activity.
 void UVillagerActivityComponent::HandleMovementFinished(bool bSuccess)
 {
+	SyncToCurrentMinute(); // Settle deltas accumulated while travelling.
+
 	CurrentRuntimeState.bWaitingForMovement = false; // Clear wait flag.
 
 	if (!bSuccess) // Handle failed movement.
 	{
 		ClearActivityTimers(); // Stop any active timers before retrying selection.
-		bHasActiveActivity = false; // Mark as idle to prevent immediate re-entry.
+		ReleaseActivityLocation(); // Let others use the unreachable spot.
+		MarkActivityInactive(); // Mark as idle to prevent immediate re-entry.
 
 		if (LogComponent) // Log failure.
 		{
-			LogComponent->LogMessage(FString::Printf(TEXT("Movement failed for activity %s, retrying selection after %.1f seconds."), *UVillagerLogComponent::GetShortTagString(CurrentRuntimeState.Definition.ActivityTag), MovementFailureRetryDelaySeconds)); // Emit failure log with actor context.
+			LogComponent->LogEvent(EVillageEventType::MovementFailed, FVillageEventParams().SetActivity(CurrentRuntimeState.Definition.ActivityTag).SetValue(0, MovementFailureRetryDelaySeconds)); // Emit failure log with actor context.
 		}
 
 		LastMovementFailureTime.FindOrAdd(CurrentRuntimeState.Definition.ActivityTag) = FPlatformTime::Seconds(); // Remember failure time to avoid tight loops.
@@ -269,95 +544,274 @@ void UVillagerActivityComponent::HandleMovementFinished(bool bSuccess)
 
 	if (LogComponent) // Log arrival.
 	{
-		LogComponent->LogMessage(FString::Printf(TEXT("Arrived at activity location for %s."), *UVillagerLogComponent::GetShortTagString(CurrentRuntimeState.Definition.ActivityTag))); // Emit arrival log with actor context.
+		LogComponent->LogEvent(EVillageEventType::ActivityLocationReached, FVillageEventParams().SetActivity(CurrentRuntimeState.Definition.ActivityTag)); // Emit arrival log with actor context.
 	}
 
 	LastMovementFailureTime.Remove(CurrentRuntimeState.Definition.ActivityTag); // Clear failure record on success.
 
+	ScheduleNextWakeup(); // Arrival makes the activity interruptible; re-evaluate the next wakeup.
 }
 
 // Applies per-minute need deltas from the active activity curves.
 void UVillagerActivityComponent::ApplyNeedDeltasForMinute()
 {
-	if (!NeedsComponent) // Ensure needs component exists.
+	VILLAGE_SIM_SCOPE(Needs); // Count need updates in the simulation benchmark.
+
+	if (!NeedsComponent || IsNeedsStageActive() || IsNeedsLazy()) // The village needs stage or lazy rates cover the deltas.
+	{
+		return; // Abort if missing or handled by the stage.
+	}
+
+	for (const FVillagerCompiledNeedCurve& NeedCurve : GetActiveNeedCurves()) // Iterate curves.
+	{
+		const float Delta = NeedCurve.SampleDelta(CurrentRuntimeState.ElapsedMinutes); // Sample delta at elapsed minutes.
+		NeedsComponent->ApplyNeedDeltaByIndex(NeedCurve.NeedIndex, Delta); // Apply to needs component.
+	}
+}
+
+// Returns whether the village needs stage integrates this villager's curves.
+bool UVillagerActivityComponent::IsNeedsStageActive() const
+{
+	return NeedsStage && NeedsStage->IsStageEnabled() && !IsNeedsLazy(); // Stage exists and is enabled; lazy needs bypass it.
+}
+
+// Returns whether the needs component evaluates needs lazily.
+bool UVillagerActivityComponent::IsNeedsLazy() const
+{
+	return NeedsComponent && NeedsComponent->IsLazyEvaluation(); // Opt-in on the needs component.
+}
+
+// Sets each active curve's rate segment on a lazy needs component, bounded by the segment and activity ends.
+void UVillagerActivityComponent::UpdateLazyNeedRates()
+{
+	if (!IsNeedsLazy() || !ClockSubsystem) // Only lazy needs take rates.
 	{
-		return; // Abort if missing.
+		return; // Deltas are integrated per minute.
 	}
 
-	for (const TPair<FGameplayTag, UCurveFloat*>& Pair : CurrentRuntimeState.Definition.NeedCurves) // Iterate curves.
+	FVillagerNeedsBatchScope NeedsBatch(NeedsComponent); // Notify once for all re-anchored needs.
+	NeedsComponent->ClearNeedRates(); // Needs without a curve hold their value.
+
+	if (!bHasActiveActivity) // Idle villagers accumulate no deltas.
 	{
-		if (!Pair.Value) // Validate curve pointer.
-		{
-			continue; // Skip null entries.
-		}
+		return; // Everything holds.
+	}
+
+	const int64 Now = ClockSubsystem->GetTotalMinutes(); // Rates apply from the next minute.
+	const FActivityDefinition& Definition = CurrentRuntimeState.Definition; // Alias the active definition.
+
+	int64 LastDeltaMinute = MAX_int64; // Last minute a live tick would apply deltas.
+	if (Definition.bIsPartOfDay) // Window exit completes the activity before its deltas.
+	{
+		const int64 MinutesUntilExit = GetMinutesUntilWindowExit(Definition.PartOfDayWindow); // Minutes until the window closes.
+		LastDeltaMinute = MinutesUntilExit == MAX_int64 ? MAX_int64 : Now + MinutesUntilExit - 1; // Minute before the exit.
+	}
+	else // Duration-based activities stop applying deltas once elapsed time reaches the duration.
+	{
+		LastDeltaMinute = ActivityStartMinute + static_cast<int64>(FMath::CeilToFloat(Definition.NonDailyDurationMinutes)); // Last minute with elapsed time below the duration.
+	}
+
+	for (const FVillagerCompiledNeedCurve& NeedCurve : GetActiveNeedCurves()) // One rate per affected need.
+	{
+		int64 SegmentEnd = MAX_int64; // First elapsed minute of the next segment.
+		const float Rate = NeedCurve.FindRateSegment(Now - ActivityStartMinute, SegmentEnd); // Elapsed minute applied on the next tick.
+		const int64 SegmentLastMinute = SegmentEnd == MAX_int64 ? MAX_int64 : ActivityStartMinute + SegmentEnd; // Clock minute applying the segment's last delta.
+		NeedsComponent->SetNeedRate(NeedCurve.NeedIndex, Rate, FMath::Min(SegmentLastMinute, LastDeltaMinute)); // Rate until the segment or activity ends.
+	}
+}
+
+// Marks the activity inactive and freezes lazy needs at their current values.
+void UVillagerActivityComponent::MarkActivityInactive()
+{
+	bHasActiveActivity = false; // Mark activity inactive.
+
+	if (IsNeedsLazy()) // Rates belong to the activity that just stopped.
+	{
+		NeedsComponent->ClearNeedRates(); // Hold every need from now on.
+	}
+}
 
-		const float Delta = Pair.Value->GetFloatValue(CurrentRuntimeState.ElapsedMinutes); // Sample delta at elapsed minutes.
-		NeedsComponent->ApplyNeedDelta(Pair.Key, Delta); // Apply to needs component.
+// Returns the needs component driven by the active activity.
+UVillagerNeedsComponent* UVillagerActivityComponent::GetNeedsComponent() const
+{
+	return NeedsComponent; // Provide cached component.
+}
+
+// Provides the curves and elapsed activity minute the village needs stage integrates for a minute.
+bool UVillagerActivityComponent::GetNeedsStageInput(int64 Minute, float& OutElapsedMinutes, TConstArrayView<FVillagerCompiledNeedCurve>& OutCurves) const
+{
+	if (!bHasActiveActivity || IsNeedsLazy()) // Idle villagers accumulate no deltas; lazy needs take rates instead.
+	{
+		return false; // Nothing to integrate.
+	}
+
+	const int64 Elapsed = Minute - ActivityStartMinute - 1; // Matches ElapsedMinutes when a live tick applies this minute.
+	if (Elapsed < 0) // Activity began this minute.
+	{
+		return false; // First delta applies next minute.
+	}
+
+	const FActivityDefinition& Definition = CurrentRuntimeState.Definition; // Alias the active definition.
+	if (!Definition.bIsPartOfDay && static_cast<float>(Elapsed) >= Definition.NonDailyDurationMinutes) // Duration used up; completion is pending.
+	{
+		return false; // Live ticks skip deltas on the completing minute.
 	}
+
+	OutElapsedMinutes = static_cast<float>(Elapsed); // Curve sample time.
+	OutCurves = GetActiveNeedCurves(); // Shared compiled curves.
+	return OutCurves.Num() > 0; // Report whether any curve applies.
+}
+
+// Re-evaluates the next wakeup after the village needs stage moved a need into another urgency band.
+void UVillagerActivityComponent::HandleNeedBandCrossed()
+{
+	if (bHasActiveActivity) // Idle villagers are restarted by retry timers.
+	{
+		ScheduleNextWakeup(); // Urgent needs now wake the villager every minute for interruption rolls.
+	}
+}
+
+// Returns the compiled need curves of the active activity.
+TConstArrayView<FVillagerCompiledNeedCurve> UVillagerActivityComponent::GetActiveNeedCurves() const
+{
+	if (!bHasActiveActivity || !Archetype || !NeedsComponent) // Validate dependencies.
+	{
+		return TConstArrayView<FVillagerCompiledNeedCurve>(); // No curves apply.
+	}
+
+	if (NeedsComponent->GetArchetype() != Archetype || NeedsComponent->GetNeedCount() != Archetype->NeedDefinitions.Num()) // Need indices must refer to the same definitions.
+	{
+		return TConstArrayView<FVillagerCompiledNeedCurve>(); // Skip until both components are rebuilt.
+	}
+
+	return Archetype->GetCompiledArchetype().GetNeedCurvesForActivity(CurrentActivityIndex); // Shared precompiled curves.
 }
 
 // Continuously checks for need-driven interruptions during PartOfDay activities.
 void UVillagerActivityComponent::RunNeedInterruptionCheck()
 {
-	if (!bHasActiveActivity) // Skip if no activity.
+	RequestDecision(EVillagerDecisionKind::Interruption); // Decide now or in this minute's decision phase.
+}
+
+// Decides immediately or defers to the village decision stage while the clock runs wakeups.
+void UVillagerActivityComponent::RequestDecision(EVillagerDecisionKind Kind)
+{
+	if (Archetype) // Compiled tables build lazily; build them before worker threads read them.
 	{
-		return; // Nothing to do.
+		Archetype->GetCompiledArchetype(); // Warm the activity tables.
 	}
 
-	if (CurrentRuntimeState.bWaitingForMovement) // Avoid interruptions while moving to the activity.
+	if (NeedsComponent && NeedsComponent->GetArchetype()) // Force probabilities come from the needs component's archetype.
 	{
-		return; // Defer checks until movement is complete.
+		NeedsComponent->GetArchetype()->GetCompiledArchetype(); // Warm the need tables.
 	}
 
-	if (!CurrentRuntimeState.Definition.bIsPartOfDay || !NeedsComponent) // Only PartOfDay activities can be interrupted.
+	if (DecisionStage && DecisionStage->CanDeferDecisions()) // Batch with the other villagers waking this minute.
 	{
-		return; // Skip non-PartOfDay or missing dependencies.
+		DecisionStage->QueueDecision(this, Kind); // Evaluated in parallel after the wakeups.
+		return; // Applied by the stage.
 	}
 
-	FNeedRuntimeState CriticalNeed;
-	if (NeedsComponent->GetHighestPriorityNeed(EVillagerNeedUrgency::Critical, CriticalNeed)) // Check critical needs first.
+	VILLAGE_SIM_SCOPE(ActivitySelection); // Count activity selection in the simulation benchmark.
+	ApplyDecision(EvaluateDecision(Kind)); // Evaluate and apply in place.
+}
+
+// Evaluates a decision without touching the world; safe to run on worker threads alongside other villagers.
+FVillagerDecisionCommand UVillagerActivityComponent::EvaluateDecision(EVillagerDecisionKind Kind) const
+{
+	FVillagerDecisionCommand Command; // Result handed back to the game thread.
+	Command.Kind = Kind; // Remember the decision type.
+
+	if (Kind == EVillagerDecisionKind::PlanNext) // Mirrors the schedule priority: critical needs, schedule, then mild needs.
 	{
-		if (ShouldForceNeedActivity(CriticalNeed) && TryStartNeedSatisfyingActivity(CriticalNeed))
+		if (!SelectNeedSatisfyingActivity(EVillagerNeedUrgency::Critical, Command) && !SelectScheduledActivity(Command)) // Prioritize critical needs, then the schedule.
 		{
-			if (LogComponent)
-			{
-				LogComponent->LogMessage(FString::Printf(TEXT("Activity interrupted by need: %s"), *UVillagerLogComponent::GetShortTagString(CriticalNeed.NeedTag)));
-			}
+			SelectNeedSatisfyingActivity(EVillagerNeedUrgency::Mild, Command); // Fallback to mild needs.
 		}
-		return; // Do not consider mild needs when a critical one exists.
+		return Command; // Planned activity, if any.
+	}
+
+	if (!bHasActiveActivity || CurrentRuntimeState.bWaitingForMovement) // Idle or still moving to the activity.
+	{
+		return Command; // Defer checks until the activity is running.
+	}
+
+	if (!CurrentRuntimeState.Definition.bIsPartOfDay || !NeedsComponent) // Only PartOfDay activities can be interrupted.
+	{
+		return Command; // Skip non-PartOfDay or missing dependencies.
+	}
+
+	const int32 CriticalNeed = NeedsComponent->FindHighestPriorityNeed(EVillagerNeedUrgency::Critical); // Check critical needs first.
+	const int32 UrgentNeed = CriticalNeed != INDEX_NONE ? CriticalNeed : NeedsComponent->FindHighestPriorityNeed(EVillagerNeedUrgency::Mild); // Mild needs only without a critical one.
+	if (UrgentNeed != INDEX_NONE && ShouldForceNeedActivity(UrgentNeed)) // Roll the force probability.
+	{
+		SelectSatisfierForNeed(UrgentNeed, Command); // Interrupt with the satisfier.
+	}
+
+	return Command; // Interruption, if any.
+}
+
+// Applies an evaluated decision on the game thread.
+void UVillagerActivityComponent::ApplyDecision(const FVillagerDecisionCommand& Command)
+{
+	if (!Archetype) // Validate archetype presence.
+	{
+		return; // Nothing to apply.
 	}
 
-	FNeedRuntimeState MildNeed;
-	if (NeedsComponent->GetHighestPriorityNeed(EVillagerNeedUrgency::Mild, MildNeed)) // Fall back to mild needs.
+	for (const int32 SkippedIndex : Command.CooldownSkippedActivities) // Report satisfiers blocked by provider cooldowns.
 	{
-		if (ShouldForceNeedActivity(MildNeed) && TryStartNeedSatisfyingActivity(MildNeed))
+		if (LogComponent && Archetype->ActivityDefinitions.IsValidIndex(SkippedIndex)) // Log skip for visibility.
 		{
-			if (LogComponent)
-			{
-				LogComponent->LogMessage(FString::Printf(TEXT("Activity interrupted by need: %s"), *UVillagerLogComponent::GetShortTagString(MildNeed.NeedTag)));
-			}
+			LogComponent->LogEvent(EVillageEventType::ActivityCooldownSkipped, FVillageEventParams().SetActivity(Archetype->ActivityDefinitions[SkippedIndex].ActivityTag)); // Emit cooldown skip log.
 		}
 	}
+
+	if (!Archetype->ActivityDefinitions.IsValidIndex(Command.ActivityIndex)) // No activity chosen.
+	{
+		return; // Leave the villager as it is.
+	}
+
+	const FActivityDefinition& Definition = Archetype->ActivityDefinitions[Command.ActivityIndex]; // Alias the chosen activity.
+
+	FTransform Unused; // Only validity matters here.
+	if (Definition.bRequiresSpecificLocation && !ResolveActivityTransform(Definition, Unused)) // The first lookup of a tag may rescan and find it missing.
+	{
+		ApplyDecision(EvaluateDecision(Command.Kind)); // The registry now knows the tag is missing, so evaluation picks another activity.
+		return; // Applied by the retry.
+	}
+
+	BeginActivity(Definition); // Start the chosen activity.
+
+	if (Command.NeedIndex == INDEX_NONE || !NeedsComponent || !NeedsComponent->IsValidNeedIndex(Command.NeedIndex) || !LogComponent) // Only need-driven starts are logged here.
+	{
+		return; // Nothing to log.
+	}
+
+	const FVillageEventParams Event = FVillageEventParams().SetResource(NeedsComponent->GetNeedDefinition(Command.NeedIndex).NeedTag); // Need being satisfied.
+	LogComponent->LogEvent(EVillageEventType::NeedSwitch, Event); // Emit log with actor context.
+	if (Command.Kind == EVillagerDecisionKind::Interruption) // Interruptions are reported separately.
+	{
+		LogComponent->LogEvent(EVillageEventType::NeedInterrupt, Event); // Emit interruption log.
+	}
 }
 
 // Computes the probability of forcing a need-driven activity.
-float UVillagerActivityComponent::GetNeedForceProbability(const FNeedRuntimeState& NeededNeed) const
+float UVillagerActivityComponent::GetNeedForceProbability(int32 NeedIndex) const
 {
-	if (!NeededNeed.Definition.ForceActivityProbabilityCurve)
+	if (!NeedsComponent || !NeedsComponent->IsValidNeedIndex(NeedIndex)) // Validate the need.
 	{
-		return 1.0f; // Default to always forcing when no curve is provided.
+		return 0.0f; // Never force untracked needs.
 	}
 
-	const float Range = FMath::Max(KINDA_SMALL_NUMBER, NeededNeed.Definition.MaxValue - NeededNeed.Definition.MinValue); // Avoid division by zero.
-	const float Normalized = FMath::Clamp((NeededNeed.CurrentValue - NeededNeed.Definition.MinValue) / Range, 0.0f, 1.0f); // Normalize to 0-1.
-	const float RawProbability = NeededNeed.Definition.ForceActivityProbabilityCurve->GetFloatValue(Normalized); // Sample the curve.
-	return FMath::Clamp(RawProbability, 0.0f, 1.0f); // Clamp to valid probability range.
+	const FVillagerCompiledArchetype& Compiled = NeedsComponent->GetArchetype()->GetCompiledArchetype(); // Need indices refer to the needs component's archetype.
+	return Compiled.GetForceProbability(NeedIndex, NeedsComponent->GetNormalizedNeedValue(NeedIndex)); // Baked curve read.
 }
 
 // Determines whether the current check should force the need activity.
-bool UVillagerActivityComponent::ShouldForceNeedActivity(const FNeedRuntimeState& NeededNeed) const
+bool UVillagerActivityComponent::ShouldForceNeedActivity(int32 NeedIndex) const
 {
-	const float Probability = GetNeedForceProbability(NeededNeed);
+	const float Probability = GetNeedForceProbability(NeedIndex);
 	if (Probability <= 0.0f)
 	{
 		return false;
@@ -368,7 +822,7 @@ bool UVillagerActivityComponent::ShouldForceNeedActivity(const FNeedRuntimeState
 		return true;
 	}
 
-	return FMath::FRand() <= Probability;
+	return DecisionStream.FRand() <= Probability;
 }
 
 // Completes the current activity and transitions accordingly.
@@ -376,147 +830,104 @@ void UVillagerActivityComponent::CompleteCurrentActivity()
 {
 	ClearActivityTimers(); // Stop timers.
 
-	bHasActiveActivity = false; // Mark activity inactive.
+	ReleaseActivityLocation(); // Free the activity spot.
+
+	MarkActivityInactive(); // Mark activity inactive.
 	ResetProviderContext(); // Clear provider cache to avoid stale references. 
 
 	if (LogComponent) // Log completion.
 	{
-		LogComponent->LogMessage(FString::Printf(TEXT("Completed activity: %s"), *UVillagerLogComponent::GetShortTagString(CurrentRuntimeState.Definition.ActivityTag))); // Emit log with actor context.
+		LogComponent->LogEvent(EVillageEventType::ActivityCompleted, FVillageEventParams().SetActivity(CurrentRuntimeState.Definition.ActivityTag)); // Emit log with actor context.
 	}
 
 	StartNextPlannedActivity(); // Resume schedule.
 }
 
-// Attempts to start a need-satisfying activity based on urgency.
-bool UVillagerActivityComponent::TryStartNeedSatisfyingActivity(EVillagerNeedUrgency UrgencyThreshold)
+// Selects a need-satisfying activity based on urgency.
+bool UVillagerActivityComponent::SelectNeedSatisfyingActivity(EVillagerNeedUrgency UrgencyThreshold, FVillagerDecisionCommand& Command) const
 {
 	if (!NeedsComponent || !Archetype) // Validate dependencies.
 	{
 		return false; // Cannot proceed.
 	}
 
-	FNeedRuntimeState NeededNeed; // Holder for selected need.
-	if (!NeedsComponent->GetHighestPriorityNeed(UrgencyThreshold, NeededNeed)) // Evaluate needs.
+	const int32 NeedIndex = NeedsComponent->FindHighestPriorityNeed(UrgencyThreshold); // Evaluate needs.
+	if (NeedIndex == INDEX_NONE) // No need reached the threshold.
 	{
 		return false; // No matching need.
 	}
 
-	if (!ShouldForceNeedActivity(NeededNeed)) // Apply probabilistic forcing.
+	if (!ShouldForceNeedActivity(NeedIndex)) // Apply probabilistic forcing.
 	{
 		return false; // Skip forcing based on the probability curve.
 	}
 
-	return TryStartNeedSatisfyingActivity(NeededNeed); // Attempt to start the satisfying activity.
+	return SelectSatisfierForNeed(NeedIndex, Command); // Select the satisfying activity.
 }
 
-// Attempts to start the activity that satisfies the specified need.
-bool UVillagerActivityComponent::TryStartNeedSatisfyingActivity(const FNeedRuntimeState& NeededNeed)
+// Selects the activity that satisfies the specified need.
+bool UVillagerActivityComponent::SelectSatisfierForNeed(int32 NeedIndex, FVillagerDecisionCommand& Command) const
 {
-	if (!Archetype) // Validate data dependency.
+	if (!Archetype || !NeedsComponent || !NeedsComponent->IsValidNeedIndex(NeedIndex)) // Validate data dependencies.
 	{
 		return false; // Cannot proceed.
 	}
 
-	for (const FActivityDefinition& Definition : Archetype->ActivityDefinitions) // Search activities.
+	const FGameplayTag& NeedTag = NeedsComponent->GetNeedDefinition(NeedIndex).NeedTag; // Tag of the need to satisfy.
+	const int32 ActivityIndex = Archetype->GetCompiledArchetype().FindSatisfyingActivityIndex(NeedTag); // Precompiled satisfier lookup.
+	if (ActivityIndex == INDEX_NONE) // Need has no satisfying activity.
 	{
-		if (Definition.ActivityTag == NeededNeed.Definition.SatisfyingActivityTag) // Match satisfier.
-		{
-			if (IsActivityInProviderCooldown(Definition.ActivityTag)) // Respect provider cooldowns to avoid rapid retries. 
-			{
-				if (LogComponent) // Log skip for visibility. 
-				{
-					LogComponent->LogMessage(FString::Printf(TEXT("Skipping activity %s due to provider cooldown."), *UVillagerLogComponent::GetShortTagString(Definition.ActivityTag))); // Emit cooldown skip log. 
-				}
-				continue; // Skip this activity while cooldown is active. 
-			}
+		return false; // Nothing to start.
+	}
 
-			if (Definition.bRequiresSpecificLocation)
-			{
-				FTransform Dummy;
-				if (!ResolveActivityTransform(Definition, Dummy))
-				{
-					continue; // Skip invalid locations.
-				}
-			}
+	const FActivityDefinition& Definition = Archetype->ActivityDefinitions[ActivityIndex]; // Alias satisfier.
 
-			BeginActivity(Definition); // Start satisfying activity.
-			if (LogComponent) // Log decision.
-			{
-				LogComponent->LogMessage(FString::Printf(TEXT("Switching to satisfy need: %s"), *UVillagerLogComponent::GetShortTagString(NeededNeed.NeedTag))); // Emit log with actor context.
-			}
-			return true; // Success.
-		}
+	if (IsActivityInProviderCooldown(Definition.ActivityTag)) // Respect provider cooldowns to avoid rapid retries. 
+	{
+		Command.CooldownSkippedActivities.Add(ActivityIndex); // Logged when the command is applied.
+		return false; // Skip this activity while cooldown is active. 
+	}
+
+	if (Definition.bRequiresSpecificLocation && !CanResolveActivityLocation(Definition)) // Skip invalid locations.
+	{
+		return false; // Skip invalid locations.
 	}
 
-	return false; // No activity found.
+	Command.ActivityIndex = ActivityIndex; // Start the satisfier.
+	Command.NeedIndex = NeedIndex; // Remember the need for logging.
+	return true; // Success.
 }
 
-// Attempts to start the next scheduled PartOfDay activity.
-bool UVillagerActivityComponent::TryStartScheduledActivity()
+// Selects the next scheduled PartOfDay activity.
+bool UVillagerActivityComponent::SelectScheduledActivity(FVillagerDecisionCommand& Command) const
 {
 	if (!Archetype || !ClockSubsystem) // Validate dependencies.
 	{
 		return false; // Cannot schedule without data.
 	}
 
-	int32 CurrentHour = ClockSubsystem->GetCurrentHour(); // Fetch current hour.
-
+	const FVillagerCompiledArchetype& Compiled = Archetype->GetCompiledArchetype(); // Shared precompiled schedule.
 	const TArray<FActivityDefinition>& Definitions = Archetype->ActivityDefinitions; // Alias definitions.
 
-	TArray<FActivityDefinition> DailyDefinitions; // Container for daily activities.
-	for (const FActivityDefinition& Definition : Definitions) // Filter activities.
-	{
-		if (Definition.bIsPartOfDay) // Include only daily ones.
-		{
-			DailyDefinitions.Add(Definition); // Add to list.
-		}
-	}
-
-	DailyDefinitions.Sort([](const FActivityDefinition& A, const FActivityDefinition& B) { return A.DayOrder < B.DayOrder; }); // Sort by day order.
-
-	for (const FActivityDefinition& Definition : DailyDefinitions) // Iterate sorted activities.
+	for (const TConstArrayView<int32> Candidates : { Compiled.GetActivitiesForHour(ClockSubsystem->GetCurrentHour()), TConstArrayView<int32>(Compiled.DailyActivityIndices) }) // Daily activities whose window contains this hour, then any daily activity even if off-window.
 	{
-		if (IsActivityInProviderCooldown(Definition.ActivityTag)) // Skip activities blocked by provider cooldown. 
+		for (const int32 ActivityIndex : Candidates) // Candidates in day order.
 		{
-			continue; // Continue when cooldown is active. 
-		}
+			const FActivityDefinition& Definition = Definitions[ActivityIndex]; // Alias candidate.
 
-		const bool bWithinWindow = CurrentHour >= Definition.PartOfDayWindow.AllowedStartHour && CurrentHour < Definition.PartOfDayWindow.AllowedEndHour; // Check time window.
-
-		if (Definition.bRequiresSpecificLocation)
-		{
-			FTransform Dummy;
-			if (!ResolveActivityTransform(Definition, Dummy))
+			if (IsActivityInProviderCooldown(Definition.ActivityTag)) // Skip activities blocked by provider cooldown. 
 			{
-				continue; // Skip invalid locations.
+				continue; // Continue when cooldown is active. 
 			}
-		}
-
-		if (bWithinWindow) // Start the first suitable activity.
-		{
-			BeginActivity(Definition); // Begin activity.
-			return true; // Indicate success.
-		}
-	}
 
-	for (const FActivityDefinition& Definition : DailyDefinitions) // Fallback to first valid daily even if off-window.
-	{
-		if (IsActivityInProviderCooldown(Definition.ActivityTag)) // Skip blocked activities. 
-		{
-			continue; // Continue to next candidate. 
-		}
-
-		if (Definition.bRequiresSpecificLocation)
-		{
-			FTransform Dummy;
-			if (!ResolveActivityTransform(Definition, Dummy))
+			if (Definition.bRequiresSpecificLocation && !CanResolveActivityLocation(Definition)) // Skip invalid locations.
 			{
 				continue; // Skip invalid locations.
 			}
-		}
 
-		BeginActivity(Definition);
-		return true;
+			Command.ActivityIndex = ActivityIndex; // Begin activity.
+			return true; // Indicate success.
+		}
 	}
 
 	return false; // No activities available.
@@ -535,6 +946,8 @@ void UVillagerActivityComponent::ClearActivityTimers()
 // Resolves a provider location offering the requested resource.
 bool UVillagerActivityComponent::FindResourceProviderLocation(const FGameplayTag& ResourceTag, FResourceProviderContext& OutProviderContext) const
 {
+	VILLAGE_SIM_SCOPE(ProviderSearch); // Count provider lookup in the simulation benchmark.
+
 	OutProviderContext = FResourceProviderContext(); // Reset output context. 
 
 	if (!GetWorld()) // Validate world.
@@ -542,58 +955,41 @@ bool UVillagerActivityComponent::FindResourceProviderLocation(const FGameplayTag
 		return false; // Abort when world is missing.
 	}
 
-	UVillageLocationRegistry* Registry = GetWorld()->GetSubsystem<UVillageLocationRegistry>(); // Resolve location registry once.
-	if (!Registry) // Validate registry.
+	UVillageProviderRegistry* ProviderRegistry = GetWorld()->GetSubsystem<UVillageProviderRegistry>(); // Resolve provider index once.
+	if (!ProviderRegistry) // Validate provider index.
 	{
-		return false; // Cannot resolve tagged locations without registry.
+		return false; // Cannot find providers without the index.
 	}
 
 	TArray<FResourceProviderContext> PresentCandidates; // Collect providers already at a trade spot. 
 	TArray<FResourceProviderContext> AbsentCandidates; // Collect providers away from their trade spot. 
 
-	for (TActorIterator<AActor> It(GetWorld()); It; ++It) // Iterate actors in the world.
+	for (const FVillageProviderEntry& Provider : ProviderRegistry->GetProviders(ResourceTag)) // Iterate only providers of the requested resource.
 	{
-		if (AActor* Actor = *It) // Validate actor pointer.
+		UVillagerSocialComponent* Social = Provider.SocialComponent.Get(); // Resolve provider component.
+		AActor* Actor = Provider.ProviderActor.Get(); // Resolve provider actor.
+		if (!Social || !Actor || Actor == GetOwner()) // Skip stale entries and self to avoid self-provision loops. 
+		{
+			continue; // Continue searching other providers. 
+		}
+
+		for (const FVillageProviderTradeLocation& TradeLocation : Provider.TradeLocations) // Iterate cached trade locations.
 		{
-			if (Actor == GetOwner()) // Skip self to avoid self-provision loops. 
+			FResourceProviderContext CandidateContext; // Allocate candidate context holder. 
+			CandidateContext.ProviderIdTag = Social->GetVillagerIdTag(); // Cache provider id. 
+			CandidateContext.TradeLocationTag = TradeLocation.LocationTag; // Cache trade tag. 
+			CandidateContext.TradeLocationTransform = TradeLocation.LocationTransform; // Cache trade transform. 
+			CandidateContext.ProviderSocialComponent = Social; // Cache provider social component. 
+			CandidateContext.ProviderActor = Actor; // Cache provider actor for presence checks. 
+			CandidateContext.bWasPresentAtSelection = IsProviderAtTradeLocation(CandidateContext); // Determine presence at selection time. 
+
+			if (CandidateContext.bWasPresentAtSelection) // Prefer providers already waiting at the trade spot. 
 			{
-				continue; // Continue searching other providers. 
+				PresentCandidates.Add(CandidateContext); // Store present candidate. 
 			}
-
-			if (UVillagerSocialComponent* Social = Actor->FindComponentByClass<UVillagerSocialComponent>()) // Resolve social component.
+			else // Track candidates that will require waiting. 
 			{
-				const FGameplayTag Provided = Social->GetProvidedResourceTag(); // Read provided resource.
-				if (Provided != ResourceTag) // Skip non-matching providers.
-				{
-					continue; // Continue searching.
-				}
-
-				const TArray<FGameplayTag> TradeTags = Social->GetTradeLocationTags(); // Fetch trade locations.
-				for (const FGameplayTag& TradeTag : TradeTags) // Iterate trade tags.
-				{
-					FTransform TradeTransform;
-					if (!Registry->TryGetLocation(TradeTag, TradeTransform)) // Resolve transform.
-					{
-						continue; // Skip unresolved trade tag entries.
-					}
-
-					FResourceProviderContext CandidateContext; // Allocate candidate context holder. 
-					CandidateContext.ProviderIdTag = Social->GetVillagerIdTag(); // Cache provider id. 
-					CandidateContext.TradeLocationTag = TradeTag; // Cache trade tag. 
-					CandidateContext.TradeLocationTransform = TradeTransform; // Cache trade transform. 
-					CandidateContext.ProviderSocialComponent = Social; // Cache provider social component. 
-					CandidateContext.ProviderActor = Actor; // Cache provider actor for presence checks. 
-					CandidateContext.bWasPresentAtSelection = IsProviderAtTradeLocation(CandidateContext); // Determine presence at selection time. 
-
-					if (CandidateContext.bWasPresentAtSelection) // Prefer providers already waiting at the trade spot. 
-					{
-						PresentCandidates.Add(CandidateContext); // Store present candidate. 
-					}
-					else // Track candidates that will require waiting. 
-					{
-						AbsentCandidates.Add(CandidateContext); // Store absent candidate. 
-					}
-				}
+				AbsentCandidates.Add(CandidateContext); // Store absent candidate. 
 			}
 		}
 	}
@@ -605,11 +1001,59 @@ bool UVillagerActivityComponent::FindResourceProviderLocation(const FGameplayTag
 		return false; // Abort without fallback transform to enforce tag-only resolution.
 	}
 
-	const int32 Index = FMath::RandRange(0, SelectionPool.Num() - 1); // Choose random candidate.
+	const UVillageNavigationCache* NavigationCache = GetWorld()->GetSubsystem<UVillageNavigationCache>(); // Resolve the travel cost matrix.
+	const FVector Origin = GetOwner() ? GetOwner()->GetActorLocation() : FVector::ZeroVector; // Trips start where the villager stands.
+
+	TArray<float, TInlineAllocator<8>> PathCosts; // Path length to each candidate from the matrix.
+	PathCosts.SetNumUninitialized(SelectionPool.Num()); // One cost per candidate.
+	bool bAllPathCostsKnown = NavigationCache != nullptr; // Path lengths are only comparable when every route is cached.
+	for (int32 CandidateIndex = 0; CandidateIndex < SelectionPool.Num(); ++CandidateIndex) // Look up every candidate.
+	{
+		PathCosts[CandidateIndex] = NavigationCache ? NavigationCache->GetTravelCost(Origin, SelectionPool[CandidateIndex].TradeLocationTransform.GetLocation()) : -1.0f; // Negative while unknown.
+		bAllPathCostsKnown &= PathCosts[CandidateIndex] >= 0.0f; // Route not cached yet or villager away from every registered location.
+	}
+
+	TArray<int32, TInlineAllocator<8>> CheapestIndices; // Candidates sharing the lowest travel cost.
+	float CheapestCost = TNumericLimits<float>::Max(); // Lowest travel cost seen so far.
+	for (int32 CandidateIndex = 0; CandidateIndex < SelectionPool.Num(); ++CandidateIndex) // Rank every candidate.
+	{
+		if (PathCosts[CandidateIndex] == UVillageNavigationCache::UnreachableCost) // Searched without a complete path.
+		{
+			continue; // Never send the villager to a trade spot it cannot reach.
+		}
+
+		// Mixing path lengths with straight-line distances would favour uncached candidates, so rank all by one measure.
+		const float Cost = bAllPathCostsKnown ? PathCosts[CandidateIndex] : FVector::Dist(Origin, SelectionPool[CandidateIndex].TradeLocationTransform.GetLocation());
+
+		if (Cost < CheapestCost - UE_KINDA_SMALL_NUMBER) // Strictly cheaper candidate.
+		{
+			CheapestCost = Cost; // Track new minimum.
+			CheapestIndices.Reset(); // Drop costlier candidates.
+		}
+		if (Cost <= CheapestCost + UE_KINDA_SMALL_NUMBER) // Ties include providers sharing a trade spot.
+		{
+			CheapestIndices.Add(CandidateIndex); // Keep tied candidate.
+		}
+	}
+
+	if (CheapestIndices.Num() == 0) // Every trade spot is unreachable.
+	{
+		return false; // Proceed without fetching, like when no provider exists.
+	}
+
+	const int32 Index = CheapestIndices[DecisionStream.RandRange(0, CheapestIndices.Num() - 1)]; // Break ties from the villager's stream.
 	OutProviderContext = SelectionPool[Index]; // Assign resolved provider context. 
 	return true; // Success.
 }
 
+// Returns whether the activity location may resolve, without scanning the world.
+bool UVillagerActivityComponent::CanResolveActivityLocation(const FActivityDefinition& Definition) const
+{
+	const UWorld* World = GetWorld(); // Registry lives on the world.
+	const UVillageLocationRegistry* Registry = World ? World->GetSubsystem<UVillageLocationRegistry>() : nullptr; // Resolve the registry.
+	return Registry && Registry->MayResolveLocation(Definition.ActivityLocationTag); // Read-only lookup.
+}
+
 // Resolves the target transform for an activity, preferring a tag lookup through the location registry.
 bool UVillagerActivityComponent::ResolveActivityTransform(const FActivityDefinition& Definition, FTransform& OutTransform)
 {
@@ -629,9 +1073,58 @@ bool UVillagerActivityComponent::ResolveActivityTransform(const FActivityDefinit
 	return false;
 }
 
+// Reserves the nearest free instance of the activity location tag.
+bool UVillagerActivityComponent::AcquireActivityLocation(const FActivityDefinition& Definition, FTransform& OutTransform)
+{
+	if (!Definition.ActivityLocationTag.IsValid())
+	{
+		return false;
+	}
+
+	UVillageLocationRegistry* Registry = GetWorld() ? GetWorld()->GetSubsystem<UVillageLocationRegistry>() : nullptr;
+	if (!Registry)
+	{
+		return false;
+	}
+
+	const FVector SearchOrigin = GetOwner() ? GetOwner()->GetActorLocation() : FVector::ZeroVector; // Prefer spots close to the villager.
+	if (Registry->AcquireInstance(Definition.ActivityLocationTag, SearchOrigin, ReservedLocationHandle, OutTransform))
+	{
+		return true;
+	}
+
+	FTransform UnusedTransform;
+	if (!ResolveActivityTransform(Definition, UnusedTransform)) // Rescans once for actors registered outside BeginPlay.
+	{
+		return false;
+	}
+
+	return Registry->AcquireInstance(Definition.ActivityLocationTag, SearchOrigin, ReservedLocationHandle, OutTransform); // Never hand out an unreserved spot.
+}
+
+// Releases the location instance reserved for the current activity.
+void UVillagerActivityComponent::ReleaseActivityLocation()
+{
+	if (!ReservedLocationHandle.IsValid()) // Nothing reserved.
+	{
+		return;
+	}
+
+	if (UVillageLocationRegistry* Registry = GetWorld() ? GetWorld()->GetSubsystem<UVillageLocationRegistry>() : nullptr)
+	{
+		Registry->ReleaseInstance(ReservedLocationHandle); // Decrement occupancy and clear the handle.
+	}
+	else
+	{
+		ReservedLocationHandle.Reset(); // Registry is gone; just forget the handle.
+	}
+}
+
 // Starts movement toward the activity location, respecting throttled retries.
 void UVillagerActivityComponent::StartMovementToActivityLocation(FActivityDefinition Definition)
 {
+	SyncToCurrentMinute(); // Settle deltas accumulated during the trade cooldown.
+
 	if (!MovementComponent) // Validate movement component.
 	{
 		CurrentRuntimeState.bWaitingForMovement = false; // No movement possible.
@@ -649,9 +1142,9 @@ void UVillagerActivityComponent::StartMovementToActivityLocation(FActivityDefini
 		{
 			if (LogComponent)
 			{
-				LogComponent->LogMessage(FString::Printf(TEXT("Activity %s has no valid location; skipping."), *UVillagerLogComponent::GetShortTagString(Definition.ActivityTag)));
+				LogComponent->LogEvent(EVillageEventType::ActivityLocationMissing, FVillageEventParams().SetActivity(Definition.ActivityTag));
 			}
-			bHasActiveActivity = false;
+			MarkActivityInactive();
 			StartNextPlannedActivity();
 			return;
 		}
@@ -665,13 +1158,13 @@ void UVillagerActivityComponent::StartMovementToActivityLocation(FActivityDefini
 			const float RetryDelay = FMath::Max(0.0f, MovementFailureRetryDelaySeconds - static_cast<float>(Elapsed));
 			if (LogComponent)
 			{
-				LogComponent->LogMessage(FString::Printf(TEXT("Delaying activity %s retry for %.1f seconds after navigation failure."), *UVillagerLogComponent::GetShortTagString(Definition.ActivityTag), RetryDelay));
+				LogComponent->LogEvent(EVillageEventType::ActivityRetryDelayed, FVillageEventParams().SetActivity(Definition.ActivityTag).SetValue(0, RetryDelay));
 			}
 			if (UWorld* World = GetWorld())
 			{
 				World->GetTimerManager().SetTimer(MovementFailureRetryHandle, this, &UVillagerActivityComponent::StartNextPlannedActivity, RetryDelay, false);
 			}
-			bHasActiveActivity = false;
+			MarkActivityInactive();
 			return;
 		}
 	}
@@ -714,8 +1207,9 @@ bool UVillagerActivityComponent::IsProviderAtTradeLocation(const FResourceProvid
 void UVillagerActivityComponent::HandleProviderUnavailable()
 {
 	ClearActivityTimers(); // Stop any timers to avoid overlapping retries. 
+	ReleaseActivityLocation(); // Free the spot reserved for the abandoned activity.
 	bFetchingResource = false; // Clear resource acquisition flag.
-	bHasActiveActivity = false; // Mark activity inactive.
+	MarkActivityInactive(); // Mark activity inactive.
 	CurrentRuntimeState.bWaitingForMovement = false; // Clear waiting flag.
 
 	if (SocialComponent && CachedProviderIdTag.IsValid()) // Apply affection loss toward the unavailable provider.
@@ -725,10 +1219,10 @@ void UVillagerActivityComponent::HandleProviderUnavailable()
 
 	if (LogComponent) // Log provider absence for visibility.
 	{
-		LogComponent->LogMessage(FString::Printf(TEXT("Provider %s unavailable at %s; retrying after %.1f seconds."),
-			*UVillagerLogComponent::GetShortTagString(CachedProviderIdTag),
-			*UVillagerLogComponent::GetShortTagString(CachedProviderContext.TradeLocationTag),
-			ProviderFailureCooldownSeconds)); // Compose absence log entry.
+		LogComponent->LogEvent(EVillageEventType::ProviderUnavailable, FVillageEventParams()
+			.SetTarget(CachedProviderIdTag)
+			.SetLocation(CachedProviderContext.TradeLocationTag)
+			.SetValue(0, ProviderFailureCooldownSeconds)); // Record absence log entry.
 	}
 
 	LastProviderFailureTime.FindOrAdd(CurrentRuntimeState.Definition.ActivityTag) = FPlatformTime::Seconds(); // Track provider failure time to throttle retries.
@@ -760,25 +1254,12 @@ EVillagerNeedUrgency UVillagerActivityComponent::ResolveNeedUrgencyForCurrentAct
 		return EVillagerNeedUrgency::Mild; // Default to mild urgency when unknown.
 	}
 
-	const TArray<FNeedRuntimeState>& RuntimeNeeds = NeedsComponent->GetRuntimeNeeds(); // Access runtime needs.
-	for (const FNeedRuntimeState& Need : RuntimeNeeds) // Iterate needs.
+	const int32 NeedCount = NeedsComponent->GetNeedCount(); // Bound the scan to tracked needs.
+	for (int32 NeedIndex = 0; NeedIndex < NeedCount; ++NeedIndex) // Iterate needs.
 	{
-		if (Need.Definition.SatisfyingActivityTag == CurrentRuntimeState.Definition.ActivityTag) // Match by satisfying activity tag.
+		if (NeedsComponent->GetNeedDefinition(NeedIndex).SatisfyingActivityTag == CurrentRuntimeState.Definition.ActivityTag) // Match by satisfying activity tag.
 		{
-			const float Range = FMath::Max(KINDA_SMALL_NUMBER, Need.Definition.MaxValue - Need.Definition.MinValue); // Compute safe range.
-			const float Normalized = (Need.CurrentValue - Need.Definition.MinValue) / Range; // Normalize need value.
-
-			if (Normalized <= Need.Definition.Thresholds.CriticalThreshold) // Check critical band.
-			{
-				return EVillagerNeedUrgency::Critical; // Report critical urgency.
-			}
-
-			if (Normalized <= Need.Definition.Thresholds.MildThreshold) // Check mild band.
-			{
-				return EVillagerNeedUrgency::Mild; // Report mild urgency.
-			}
-
-			return EVillagerNeedUrgency::Satisfied; // Default to satisfied when above thresholds.
+			return NeedsComponent->GetNeedUrgency(NeedIndex); // Report the need's urgency band.
 		}
 	}
 
@@ -792,6 +1273,22 @@ void UVillagerActivityComponent::ResetProviderContext()
 	CachedProviderIdTag = FGameplayTag(); // Clear provider identifier cache.
 }
 
+// Seeds the decision stream from the world seed, the villager id and the villager's serial.
+void UVillagerActivityComponent::InitializeDecisionStream()
+{
+	if (!bHasVillagerSerial && ClockSubsystem) // Claim a serial once; reseeding keeps it.
+	{
+		VillagerSerial = ClockSubsystem->AcquireVillagerSerial(); // Distinguishes villagers sharing an archetype.
+		bHasVillagerSerial = true; // Keep the serial for reseeds.
+	}
+
+	const int32 WorldSeed = ClockSubsystem ? ClockSubsystem->GetWorldSeed() : 0; // Shared world seed.
+	const FGameplayTag VillagerIdTag = Archetype ? Archetype->VillagerIdTag : FGameplayTag(); // Villager identity.
+	const uint32 IdHash = FCrc::StrCrc32(*VillagerIdTag.ToString()); // Hash the tag text; name indices differ between runs.
+	const uint32 InstanceHash = HashCombine(IdHash, GetTypeHash(VillagerSerial)); // Per-villager discriminator.
+	DecisionStream.Initialize(static_cast<int32>(HashCombine(HashCombine(GetTypeHash(WorldSeed), InstanceHash), DecisionStreamSalt))); // Derive the per-villager seed.
+}
+
 // Determines whether the activity is blocked by a provider failure cooldown window.
 bool UVillagerActivityComponent::IsActivityInProviderCooldown(const FGameplayTag& ActivityTag) const
 {
@@ -813,19 +1310,22 @@ bool UVillagerActivityComponent::IsActivityInProviderCooldown(const FGameplayTag
 // Handles completion of resource acquisition movement.
 void UVillagerActivityComponent::HandleResourceMovementFinished(bool bSuccess)
 {
+	SyncToCurrentMinute(); // Settle deltas accumulated while travelling.
+
 	CurrentRuntimeState.bWaitingForMovement = false; // Clear waiting flag.
 
 	if (!bSuccess) // Handle failure.
 	{
 		bFetchingResource = false; // Clear fetch state.
-		bHasActiveActivity = false; // Reset activity state.
+		MarkActivityInactive(); // Reset activity state.
 		ResetProviderContext(); // Clear cached provider references after failure. 
+		ReleaseActivityLocation(); // Do not hold the activity spot through the cooldown.
 
 		if (LogComponent)
 		{
-			LogComponent->LogMessage(FString::Printf(TEXT("Failed to reach provider for %s; reselecting after %.1f seconds."),
-				*UVillagerLogComponent::GetShortTagString(CurrentRuntimeState.Definition.ActivityTag),
-				ProviderFailureCooldownSeconds));
+			LogComponent->LogEvent(EVillageEventType::ProviderUnreachable, FVillageEventParams()
+				.SetActivity(CurrentRuntimeState.Definition.ActivityTag)
+				.SetValue(0, ProviderFailureCooldownSeconds));
 		}
 
 		LastProviderFailureTime.FindOrAdd(CurrentRuntimeState.Definition.ActivityTag) = FPlatformTime::Seconds(); // Record provider failure time.
@@ -860,12 +1360,12 @@ void UVillagerActivityComponent::HandleResourceMovementFinished(bool bSuccess)
 
 	if (LogComponent) // Log resource acquisition details. 
 	{
-		LogComponent->LogMessage(FString::Printf(TEXT("Acquired %.2f of %s from %s at %s; proceeding to %s."),
-			GrantedQuantity,
-			*UVillagerLogComponent::GetShortTagString(CurrentRuntimeState.Definition.RequiredResourceTag),
-			*UVillagerLogComponent::GetShortTagString(CachedProviderIdTag),
-			*UVillagerLogComponent::GetShortTagString(CachedProviderContext.TradeLocationTag),
-			*UVillagerLogComponent::GetShortTagString(CurrentRuntimeState.Definition.ActivityTag))); // Compose acquisition summary. 
+		LogComponent->LogEvent(EVillageEventType::ResourceAcquired, FVillageEventParams()
+			.SetValue(0, GrantedQuantity)
+			.SetResource(CurrentRuntimeState.Definition.RequiredResourceTag)
+			.SetTarget(CachedProviderIdTag)
+			.SetLocation(CachedProviderContext.TradeLocationTag)
+			.SetActivity(CurrentRuntimeState.Definition.ActivityTag)); // Record acquisition summary. 
 	}
 
 	bFetchingResource = false; // Resource acquired.
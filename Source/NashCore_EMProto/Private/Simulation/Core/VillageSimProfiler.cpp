@@ -0,0 +1,120 @@
+// Includes the simulation profiler declaration.
+#include "Simulation/Core/VillageSimProfiler.h"
+
+// Region: Engine includes.
+#pragma region EngineIncludes
+// Provides cycle counters and their conversion to seconds.
+#include "HAL/PlatformTime.h"
+#pragma endregion EngineIncludes
+
+// Collection starts disabled.
+bool FVillageSimProfiler::bEnabled = false;
+
+// Zero-initialized cycle totals.
+uint64 FVillageSimProfiler::BucketCycles[static_cast<int32>(EVillageSimBucket::Count)] = {};
+
+// Zero-initialized call counts.
+uint64 FVillageSimProfiler::BucketCalls[static_cast<int32>(EVillageSimBucket::Count)] = {};
+
+// Zero-initialized scope depths.
+int32 FVillageSimProfiler::BucketDepth[static_cast<int32>(EVillageSimBucket::Count)] = {};
+
+// No scope is recording at startup.
+FVillageSimScope* FVillageSimProfiler::ActiveScope = nullptr;
+
+// Enables or disables sample collection.
+void FVillageSimProfiler::SetEnabled(bool bInEnabled)
+{
+	bEnabled = bInEnabled; // Cache the flag read by scopes.
+}
+
+// Clears every accumulated sample.
+void FVillageSimProfiler::Reset()
+{
+	for (int32 Index = 0; Index < static_cast<int32>(EVillageSimBucket::Count); ++Index) // Reset each bucket.
+	{
+		BucketCycles[Index] = 0; // Clear cycles.
+		BucketCalls[Index] = 0; // Clear calls.
+	}
+}
+
+// Returns the accumulated seconds spent in a bucket, excluding nested scopes of other buckets.
+double FVillageSimProfiler::GetSeconds(EVillageSimBucket Bucket)
+{
+	return FPlatformTime::ToSeconds64(BucketCycles[static_cast<int32>(Bucket)]); // Convert cycles to seconds.
+}
+
+// Returns how many outermost scopes were recorded for a bucket.
+uint64 FVillageSimProfiler::GetCallCount(EVillageSimBucket Bucket)
+{
+	return BucketCalls[static_cast<int32>(Bucket)]; // Provide the call count.
+}
+
+// Returns a display name for a bucket.
+const TCHAR* FVillageSimProfiler::GetBucketName(EVillageSimBucket Bucket)
+{
+	switch (Bucket) // Name per bucket.
+	{
+	case EVillageSimBucket::Needs:
+		return TEXT("Needs"); // Needs stage.
+	case EVillageSimBucket::ActivitySelection:
+		return TEXT("ActivitySelection"); // Activity selection.
+	case EVillageSimBucket::ProviderSearch:
+		return TEXT("ProviderSearch"); // Provider search.
+	case EVillageSimBucket::Movement:
+		return TEXT("Movement"); // Movement.
+	case EVillageSimBucket::Logging:
+		return TEXT("Logging"); // Logging.
+	default:
+		return TEXT("Unknown"); // Out of range.
+	}
+}
+
+// Starts timing when enabled and no scope of the same bucket is already open.
+FVillageSimScope::FVillageSimScope(EVillageSimBucket InBucket)
+	: Bucket(InBucket) // Remember the bucket.
+	, StartCycles(0) // Not recording by default.
+	, ChildCycles(0) // No nested samples yet.
+	, ParentScope(nullptr) // Not nested by default.
+	, bEntered(false) // Not entered by default.
+{
+	if (!FVillageSimProfiler::bEnabled || !IsInGameThread()) // Skip all work when profiling is off or on a worker thread.
+	{
+		return; // Nothing to record.
+	}
+
+	int32& Depth = FVillageSimProfiler::BucketDepth[static_cast<int32>(Bucket)]; // Resolve the bucket depth.
+	bEntered = true; // Balance the depth on exit.
+
+	if (Depth++ == 0) // Only the outermost scope measures time.
+	{
+		ParentScope = FVillageSimProfiler::ActiveScope; // Charge our time against the enclosing stage.
+		FVillageSimProfiler::ActiveScope = this; // Nested stages charge against us.
+		StartCycles = FPlatformTime::Cycles64(); // Capture the start time.
+	}
+}
+
+// Stops timing and records the sample.
+FVillageSimScope::~FVillageSimScope()
+{
+	if (!bEntered) // Scope never entered the bucket.
+	{
+		return; // Nothing to record.
+	}
+
+	const int32 Index = static_cast<int32>(Bucket); // Resolve the bucket index.
+	--FVillageSimProfiler::BucketDepth[Index]; // Leave the bucket.
+
+	if (StartCycles != 0) // Outermost scope records the sample.
+	{
+		const uint64 ElapsedCycles = FPlatformTime::Cycles64() - StartCycles; // Inclusive duration.
+		FVillageSimProfiler::BucketCycles[Index] += ElapsedCycles - FMath::Min(ChildCycles, ElapsedCycles); // Accumulate exclusive cycles.
+		++FVillageSimProfiler::BucketCalls[Index]; // Count the call.
+
+		if (ParentScope) // Nested inside another stage.
+		{
+			ParentScope->ChildCycles += ElapsedCycles; // Exclude our time from the enclosing stage.
+		}
+		FVillageSimProfiler::ActiveScope = ParentScope; // Restore the enclosing stage.
+	}
+}
@@ -0,0 +1,45 @@
+// Includes the curve lookup table declaration.
+#include "Simulation/Data/VillagerCurveLUT.h"
+
+// Region: Engine includes.
+#pragma region EngineIncludes
+// Provides the source curve asset.
+#include "Curves/CurveFloat.h"
+#pragma endregion EngineIncludes
+
+// Samples the curve at evenly spaced times.
+void FVillagerCurveLUT::Bake(const UCurveFloat& Curve, float InMinTime, float InMaxTime, int32 SampleCount)
+{
+	SampleCount = FMath::Max(2, SampleCount); // Interpolation needs two samples.
+	MinTime = InMinTime; // First baked time.
+	MaxTime = FMath::Max(InMaxTime, InMinTime + KINDA_SMALL_NUMBER); // Avoid a zero-width range.
+	LastPosition = static_cast<float>(SampleCount - 1); // Index of the last sample.
+	InvStep = LastPosition / (MaxTime - MinTime); // Samples per unit of time.
+
+	Samples.SetNumUninitialized(SampleCount); // One slot per sample.
+	for (int32 Index = 0; Index < SampleCount; ++Index) // Sample evenly spaced times.
+	{
+		Samples[Index] = Curve.GetFloatValue(MinTime + static_cast<float>(Index) / InvStep); // Read the source curve.
+	}
+}
+
+// Compares table reads to the source curve inside the baked range.
+float FVillagerCurveLUT::MeasureMaxError(const UCurveFloat& Curve, int32 ProbesPerInterval) const
+{
+	if (!IsBaked()) // Nothing baked.
+	{
+		return 0.0f; // No error to report.
+	}
+
+	const int32 ProbeCount = (Samples.Num() - 1) * FMath::Max(1, ProbesPerInterval) + 1; // Probe every sample and points between them.
+	const float ProbeStep = (MaxTime - MinTime) / static_cast<float>(ProbeCount - 1); // Time between probes.
+
+	float MaxError = 0.0f; // Largest difference so far.
+	for (int32 Probe = 0; Probe < ProbeCount; ++Probe) // Probe the baked range.
+	{
+		const float Time = MinTime + ProbeStep * static_cast<float>(Probe); // Probe time.
+		MaxError = FMath::Max(MaxError, FMath::Abs(Evaluate(Time) - Curve.GetFloatValue(Time))); // Keep the largest difference.
+	}
+
+	return MaxError; // Provide the largest difference.
+}
@@ -0,0 +1,202 @@
+// Includes the villager data asset declarations.
+#include "Simulation/Data/VillagerDataAssets.h"
+
+// Region: Engine includes.
+#pragma region EngineIncludes
+// Provides the binary search used by rate segment lookups.
+#include "Algo/BinarySearch.h"
+#pragma endregion EngineIncludes
+
+// Local log category for curve table validation.
+DEFINE_LOG_CATEGORY_STATIC(LogVillagerDataAssets, Log, All);
+
+// Upper bound on samples per activity curve; longer curves are baked coarser than one sample per minute.
+static constexpr int32 MaxActivityCurveSamples = 4097;
+
+// Samples across the normalized 0-1 range of force probability curves.
+static constexpr int32 ForceProbabilitySamples = 257;
+
+// Returns the need delta for an elapsed minute.
+float FVillagerCompiledNeedCurve::SampleDelta(float ElapsedMinutes) const
+{
+	if (bLUTCoversAllMinutes || DeltaLUT.Covers(ElapsedMinutes)) // Table is exact inside its range and past a constant tail.
+	{
+		return DeltaLUT.Evaluate(ElapsedMinutes); // Interpolated table read.
+	}
+
+	return Curve->GetFloatValue(ElapsedMinutes); // Non-constant extrapolation needs the source curve.
+}
+
+// Returns the per-minute delta run containing an elapsed minute.
+float FVillagerCompiledNeedCurve::FindRateSegment(int64 ElapsedMinute, int64& OutSegmentEnd) const
+{
+	ElapsedMinute = FMath::Max<int64>(0, ElapsedMinute); // Activities never sample before minute zero.
+
+	if (ElapsedMinute >= RateSegmentsEnd || RateSegmentStarts.Num() == 0) // Past the scanned minutes.
+	{
+		const bool bConstantTail = bLUTCoversAllMinutes && RateSegmentDeltas.Num() > 0; // Last run continues forever.
+		OutSegmentEnd = bConstantTail ? MAX_int64 : ElapsedMinute + 1; // Otherwise re-evaluate every minute.
+		return bConstantTail ? RateSegmentDeltas.Last() : SampleDelta(static_cast<float>(ElapsedMinute)); // Delta applied this minute.
+	}
+
+	const int32 Segment = Algo::UpperBound(RateSegmentStarts, static_cast<int32>(ElapsedMinute)) - 1; // Run starting at or before the minute.
+	const bool bLastSegment = Segment == RateSegmentStarts.Num() - 1; // Last run may extend into the tail.
+	OutSegmentEnd = bLastSegment ? (bLUTCoversAllMinutes ? MAX_int64 : RateSegmentsEnd) : RateSegmentStarts[Segment + 1]; // First minute of the next run.
+	return RateSegmentDeltas[Segment]; // Delta of the run.
+}
+
+// Bakes a table and reports its error against the source curve when the caller collects errors.
+static void BakeCurveLUT(FVillagerCurveLUT& LUT, const UCurveFloat& Curve, float MinTime, float MaxTime, int32 SampleCount, const UObject* Owner, float* OutMaxCurveError)
+{
+	LUT.Bake(Curve, MinTime, MaxTime, SampleCount); // Sample the curve.
+
+	if (OutMaxCurveError) // Optional accuracy check.
+	{
+		const float MaxError = LUT.MeasureMaxError(Curve); // Compare against the source curve.
+		*OutMaxCurveError = FMath::Max(*OutMaxCurveError, MaxError); // Track the worst table of this asset.
+		UE_LOG(LogVillagerDataAssets, Display, TEXT("%s: curve %s baked over [%.2f, %.2f], max error %g"), *GetNameSafe(Owner), *GetNameSafe(&Curve), MinTime, MaxTime, MaxError); // Report per table.
+	}
+}
+
+// Builds the compiled lookup tables as soon as the asset is loaded.
+void UVillagerArchetypeDataAsset::PostLoad()
+{
+	Super::PostLoad(); // Preserve base behavior.
+
+	CompiledArchetype = BuildCompiledArchetype(); // Ready before any villager or worker thread reads it.
+}
+
+// Returns the compiled lookup tables, building them on first use for assets created at runtime.
+const FVillagerCompiledArchetype& UVillagerArchetypeDataAsset::GetCompiledArchetype() const
+{
+	if (!CompiledArchetype.IsValid()) // Build once per asset.
+	{
+		check(IsInGameThread()); // Parallel readers must find the tables already built.
+		CompiledArchetype = BuildCompiledArchetype(); // Cache the tables for every villager sharing this asset.
+	}
+
+	return *CompiledArchetype; // Provide the cached tables.
+}
+
+// Discards the compiled tables.
+void UVillagerArchetypeDataAsset::InvalidateCompiledArchetype()
+{
+	CompiledArchetype.Reset(); // Rebuild on next access; previously returned references are no longer valid.
+}
+
+// Rebuilds the compiled tables while measuring their error.
+float UVillagerArchetypeDataAsset::ValidateCompiledArchetype()
+{
+	float MaxCurveError = 0.0f; // Worst table of this asset.
+	CompiledArchetype = BuildCompiledArchetype(&MaxCurveError); // Replace the tables with measured ones.
+	return MaxCurveError; // Provide the worst error.
+}
+
+#if WITH_EDITOR
+// Rebuilds compiled tables after designers edit the asset.
+void UVillagerArchetypeDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent); // Preserve base behavior.
+
+	InvalidateCompiledArchetype(); // Definitions may have changed.
+}
+#endif
+
+// Builds lookup tables from the authored definitions.
+TSharedRef<FVillagerCompiledArchetype> UVillagerArchetypeDataAsset::BuildCompiledArchetype(float* OutMaxCurveError) const
+{
+	TSharedRef<FVillagerCompiledArchetype> Compiled = MakeShared<FVillagerCompiledArchetype>(); // Fresh tables.
+
+	for (int32 NeedIndex = 0; NeedIndex < NeedDefinitions.Num(); ++NeedIndex) // Index every need.
+	{
+		if (!Compiled->NeedIndexByTag.Contains(NeedDefinitions[NeedIndex].NeedTag)) // Keep the first definition per tag.
+		{
+			Compiled->NeedIndexByTag.Add(NeedDefinitions[NeedIndex].NeedTag, NeedIndex); // Record tag lookup.
+		}
+	}
+
+	Compiled->ForceProbabilityLUTs.SetNum(NeedDefinitions.Num()); // One table slot per need.
+	for (int32 NeedIndex = 0; NeedIndex < NeedDefinitions.Num(); ++NeedIndex) // Bake probability curves.
+	{
+		if (const UCurveFloat* ProbabilityCurve = NeedDefinitions[NeedIndex].ForceActivityProbabilityCurve) // Needs without a curve stay unbaked.
+		{
+			BakeCurveLUT(Compiled->ForceProbabilityLUTs[NeedIndex], *ProbabilityCurve, 0.0f, 1.0f, ForceProbabilitySamples, this, OutMaxCurveError); // Normalized need value domain.
+		}
+	}
+
+	Compiled->ActivityNeedCurves.SetNum(ActivityDefinitions.Num()); // One curve list per activity.
+
+	for (int32 ActivityIndex = 0; ActivityIndex < ActivityDefinitions.Num(); ++ActivityIndex) // Index every activity.
+	{
+		const FActivityDefinition& Definition = ActivityDefinitions[ActivityIndex]; // Alias definition.
+
+		if (!Compiled->ActivityIndexByTag.Contains(Definition.ActivityTag)) // Keep the first definition per tag.
+		{
+			Compiled->ActivityIndexByTag.Add(Definition.ActivityTag, ActivityIndex); // Record tag lookup.
+		}
+
+		if (Definition.bIsPartOfDay) // Collect daily activities.
+		{
+			Compiled->DailyActivityIndices.Add(ActivityIndex); // Record daily index.
+		}
+
+		for (const TPair<FGameplayTag, UCurveFloat*>& Pair : Definition.NeedCurves) // Resolve curve targets once.
+		{
+			const int32 NeedIndex = Compiled->FindNeedIndex(Pair.Key); // Map the need tag to its index.
+			if (!Pair.Value || NeedIndex == INDEX_NONE) // Skip null curves and needs the archetype does not track.
+			{
+				continue; // Nothing to compile.
+			}
+
+			FVillagerCompiledNeedCurve& NeedCurve = Compiled->ActivityNeedCurves[ActivityIndex].AddDefaulted_GetRef(); // Record compiled curve.
+			NeedCurve.NeedIndex = NeedIndex; // Target need.
+			NeedCurve.Curve = Pair.Value; // Source curve for fallback reads.
+
+			float FirstKeyTime = 0.0f; // Curve key range.
+			float LastKeyTime = 0.0f;
+			Pair.Value->FloatCurve.GetTimeRange(FirstKeyTime, LastKeyTime); // Bake until the last key.
+			const float LastMinute = FMath::Max(1.0f, FMath::CeilToFloat(LastKeyTime)); // Whole minutes starting at zero.
+			const int32 SampleCount = FMath::Min(static_cast<int32>(LastMinute) + 1, MaxActivityCurveSamples); // One sample per minute when it fits.
+			BakeCurveLUT(NeedCurve.DeltaLUT, *Pair.Value, 0.0f, LastMinute, SampleCount, this, OutMaxCurveError); // Sample the curve.
+			NeedCurve.bLUTCoversAllMinutes = Pair.Value->FloatCurve.PostInfinityExtrap == RCCE_Constant; // Constant tails match clamped reads.
+
+			NeedCurve.RateSegmentsEnd = static_cast<int32>(LastMinute) + 1; // Scan every whole minute up to the last key.
+			for (int32 Minute = 0; Minute < NeedCurve.RateSegmentsEnd; ++Minute) // Split the curve into runs of equal deltas.
+			{
+				const float Delta = NeedCurve.SampleDelta(static_cast<float>(Minute)); // Delta the per-minute path would apply.
+				if (NeedCurve.RateSegmentDeltas.Num() == 0 || NeedCurve.RateSegmentDeltas.Last() != Delta) // Start a new run on any change.
+				{
+					NeedCurve.RateSegmentStarts.Add(Minute); // Record run start.
+					NeedCurve.RateSegmentDeltas.Add(Delta); // Record run delta.
+				}
+			}
+		}
+	}
+
+	Compiled->DailyActivityIndices.StableSort([this](int32 A, int32 B) // Order by DayOrder, keeping authoring order for ties.
+	{
+		return ActivityDefinitions[A].DayOrder < ActivityDefinitions[B].DayOrder; // Compare day order.
+	});
+
+	for (const int32 ActivityIndex : Compiled->DailyActivityIndices) // Fill the hour table in DayOrder.
+	{
+		const FActivityTimeWindow& Window = ActivityDefinitions[ActivityIndex].PartOfDayWindow; // Alias window.
+		const int32 FirstHour = FMath::Max(0, Window.AllowedStartHour); // Clamp window start.
+		const int32 LastHour = FMath::Min(FVillagerCompiledArchetype::HoursPerDay, Window.AllowedEndHour); // Clamp exclusive window end.
+
+		for (int32 Hour = FirstHour; Hour < LastHour; ++Hour) // Mark each eligible hour.
+		{
+			Compiled->HourlyActivityIndices[Hour].Add(ActivityIndex); // Record eligibility.
+		}
+	}
+
+	for (const FNeedDefinition& NeedDefinition : NeedDefinitions) // Resolve satisfiers once.
+	{
+		if (const int32* ActivityIndex = Compiled->ActivityIndexByTag.Find(NeedDefinition.SatisfyingActivityTag)) // Match satisfying activity.
+		{
+			Compiled->SatisfyingActivityByNeed.Add(NeedDefinition.NeedTag, *ActivityIndex); // Record need lookup.
+		}
+	}
+
+	return Compiled; // Provide the tables.
+}
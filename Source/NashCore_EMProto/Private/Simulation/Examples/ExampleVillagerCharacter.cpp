@@ -7,6 +7,11 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #pragma endregion EngineIncludes
 
+// Region: Simulation includes.
+#pragma region SimulationIncludes
+#include "Simulation/Examples/ExampleVillagerSetup.h"
+#pragma endregion SimulationIncludes
+
 // Constructor creating simulation components.
 AExampleVillagerCharacter::AExampleVillagerCharacter(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer) // Call parent constructor.
@@ -27,39 +32,16 @@ AExampleVillagerCharacter::AExampleVillagerCharacter(const FObjectInitializer& O
 	}
 }
 
+// Stores the archetype asset applied during BeginPlay.
+void AExampleVillagerCharacter::SetArchetypeData(UVillagerArchetypeDataAsset* InArchetypeData)
+{
+	ArchetypeData = InArchetypeData; // Cache for component configuration.
+}
+
 // Applies archetype data to all simulation components.
 void AExampleVillagerCharacter::BeginPlay()
 {
 	Super::BeginPlay(); // Preserve parent initialization.
 
-	if (ArchetypeData && NeedsComponent) // Configure needs component.
-	{
-		NeedsComponent->SetArchetype(ArchetypeData); // Apply archetype.
-	}
-
-	if (ArchetypeData && ActivityComponent) // Configure activity component.
-	{
-		ActivityComponent->SetArchetype(ArchetypeData); // Apply archetype.
-	}
-
-	if (ArchetypeData && SocialComponent) // Configure social component.
-	{
-		SocialComponent->SetArchetype(ArchetypeData); // Apply archetype.
-	}
-
-	if (ArchetypeData && MovementComponent) // Configure movement component.
-	{
-		MovementComponent->ApplyMovementDefinition(ArchetypeData->MovementDefinition); // Apply movement tuning.
-	}
-
-	if (ArchetypeData && LogComponent) // Configure log identity.
-	{
-		LogComponent->SetVillagerIdTag(ArchetypeData->VillagerIdTag);
-	}
-
-	if (NeedsDisplayComponent) // Force widget component creation on begin play.
-	{
-		NeedsDisplayComponent->InitializeWidgetComponent(); // Ensure widget component exists.
-		NeedsDisplayComponent->SetWidgetVisible(true); // Show widget by default to avoid hidden state.
-	}
+	FExampleVillagerSetup::ApplyArchetype(*this, ArchetypeData); // Configure components shared with the other example villager.
 }
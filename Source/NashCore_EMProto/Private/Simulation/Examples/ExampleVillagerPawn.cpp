@@ -0,0 +1,55 @@
+// Includes the lightweight villager pawn declaration.
+#include "Simulation/Examples/ExampleVillagerPawn.h"
+
+// Region: Engine includes.
+#pragma region EngineIncludes
+#include "AIController.h"
+#include "Components/StaticMeshComponent.h"
+#pragma endregion EngineIncludes
+
+// Region: Simulation includes.
+#pragma region SimulationIncludes
+#include "Simulation/Examples/ExampleVillagerSetup.h"
+#pragma endregion SimulationIncludes
+
+// Constructor creating simulation components.
+AExampleVillagerPawn::AExampleVillagerPawn(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer) // Call parent constructor.
+{
+	Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root")); // Instantiate root at the feet.
+	RootComponent = Root; // No collision primitive at the root.
+
+	MeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("MeshComponent")); // Instantiate optional visual.
+	MeshComponent->SetupAttachment(Root); // Follow the root.
+	MeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision); // Visual only.
+	MeshComponent->SetGenerateOverlapEvents(false); // Skip overlap updates on every move.
+	MeshComponent->SetCanEverAffectNavigation(false); // Villagers must not carve the navmesh.
+
+	PathMovementComponent = CreateDefaultSubobject<UVillagerPathMovementComponent>(TEXT("PathMovementComponent")); // Instantiate pawn movement.
+	PathMovementComponent->SetUpdatedComponent(Root); // Move the root.
+
+	NeedsComponent = CreateDefaultSubobject<UVillagerNeedsComponent>(TEXT("NeedsComponent")); // Instantiate needs component.
+	ActivityComponent = CreateDefaultSubobject<UVillagerActivityComponent>(TEXT("ActivityComponent")); // Instantiate activity component.
+	SocialComponent = CreateDefaultSubobject<UVillagerSocialComponent>(TEXT("SocialComponent")); // Instantiate social component.
+	MovementComponent = CreateDefaultSubobject<UVillagerMovementComponent>(TEXT("MovementComponent")); // Instantiate movement component.
+	LogComponent = CreateDefaultSubobject<UVillagerLogComponent>(TEXT("LogComponent")); // Instantiate log component.
+	NeedsDisplayComponent = CreateDefaultSubobject<UVillagerNeedsDisplayComponent>(TEXT("NeedsDisplayComponent")); // Instantiate needs display component.
+
+	AutoPossessAI = EAutoPossessAI::PlacedInWorldOrSpawned; // Ensure AI controller possession in PIE/world.
+	AIControllerClass = AAIController::StaticClass(); // Default AI controller if none specified.
+	bUseControllerRotationYaw = false; // Let movement control rotation.
+}
+
+// Stores the archetype asset applied during BeginPlay.
+void AExampleVillagerPawn::SetArchetypeData(UVillagerArchetypeDataAsset* InArchetypeData)
+{
+	ArchetypeData = InArchetypeData; // Cache for component configuration.
+}
+
+// Applies archetype data to all simulation components.
+void AExampleVillagerPawn::BeginPlay()
+{
+	Super::BeginPlay(); // Preserve parent initialization.
+
+	FExampleVillagerSetup::ApplyArchetype(*this, ArchetypeData); // Configure components shared with the other example villager.
+}
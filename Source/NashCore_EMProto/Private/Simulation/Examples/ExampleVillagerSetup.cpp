@@ -0,0 +1,56 @@
+// Includes the example villager setup declaration.
+#include "Simulation/Examples/ExampleVillagerSetup.h"
+
+// Region: Engine includes.
+#pragma region EngineIncludes
+#include "GameFramework/Actor.h"
+#pragma endregion EngineIncludes
+
+// Region: Simulation includes.
+#pragma region SimulationIncludes
+#include "Simulation/Activities/VillagerActivityComponent.h"
+#include "Simulation/Data/VillagerDataAssets.h"
+#include "Simulation/Logging/VillagerLogComponent.h"
+#include "Simulation/Movement/VillagerMovementComponent.h"
+#include "Simulation/Needs/VillagerNeedsComponent.h"
+#include "Simulation/Social/VillagerSocialComponent.h"
+#include "Simulation/UI/VillagerNeedsDisplayComponent.h"
+#pragma endregion SimulationIncludes
+
+// Applies archetype data to the villager's simulation components and shows its needs display.
+void FExampleVillagerSetup::ApplyArchetype(AActor& Villager, UVillagerArchetypeDataAsset* ArchetypeData)
+{
+	if (ArchetypeData) // Configure simulation components.
+	{
+		if (UVillagerNeedsComponent* NeedsComponent = Villager.FindComponentByClass<UVillagerNeedsComponent>()) // Configure needs component.
+		{
+			NeedsComponent->SetArchetype(ArchetypeData); // Apply archetype.
+		}
+
+		if (UVillagerActivityComponent* ActivityComponent = Villager.FindComponentByClass<UVillagerActivityComponent>()) // Configure activity component.
+		{
+			ActivityComponent->SetArchetype(ArchetypeData); // Apply archetype.
+		}
+
+		if (UVillagerSocialComponent* SocialComponent = Villager.FindComponentByClass<UVillagerSocialComponent>()) // Configure social component.
+		{
+			SocialComponent->SetArchetype(ArchetypeData); // Apply archetype.
+		}
+
+		if (UVillagerMovementComponent* MovementComponent = Villager.FindComponentByClass<UVillagerMovementComponent>()) // Configure movement component.
+		{
+			MovementComponent->ApplyMovementDefinition(ArchetypeData->MovementDefinition); // Apply movement tuning to whichever movement the owner uses.
+		}
+
+		if (UVillagerLogComponent* LogComponent = Villager.FindComponentByClass<UVillagerLogComponent>()) // Configure log identity.
+		{
+			LogComponent->SetVillagerIdTag(ArchetypeData->VillagerIdTag); // Apply identity.
+		}
+	}
+
+	if (UVillagerNeedsDisplayComponent* NeedsDisplayComponent = Villager.FindComponentByClass<UVillagerNeedsDisplayComponent>()) // Force widget component creation on begin play.
+	{
+		NeedsDisplayComponent->InitializeWidgetComponent(); // Ensure widget component exists.
+		NeedsDisplayComponent->SetWidgetVisible(true); // Show widget by default to avoid hidden state.
+	}
+}
@@ -6,8 +6,14 @@
 #include "Components/BillboardComponent.h"
 #include "Engine/CollisionProfile.h"
 #include "UObject/ConstructorHelpers.h"
+#include "Engine/World.h"
 #pragma endregion EngineIncludes
 
+// Region: Simulation includes.
+#pragma region SimulationIncludes
+#include "Simulation/Locations/VillageLocationRegistry.h"
+#pragma endregion SimulationIncludes
+
 // Default constructor disables ticking and adds a simple sprite for editor visibility.
 ATaggedLocationActor::ATaggedLocationActor()
 {
@@ -21,3 +27,25 @@ ATaggedLocationActor::ATaggedLocationActor()
 	RootComponent = Sprite;
 #endif
 }
+
+// Registers with the location registry so lookups never need a world scan.
+void ATaggedLocationActor::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UVillageLocationRegistry* Registry = GetWorld() ? GetWorld()->GetSubsystem<UVillageLocationRegistry>() : nullptr)
+	{
+		Registry->RegisterLocation(this);
+	}
+}
+
+// Unregisters from the location registry.
+void ATaggedLocationActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UVillageLocationRegistry* Registry = GetWorld() ? GetWorld()->GetSubsystem<UVillageLocationRegistry>() : nullptr)
+	{
+		Registry->UnregisterLocation(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
@@ -16,6 +16,21 @@
 // Local log category for registry diagnostics.
 DEFINE_LOG_CATEGORY_STATIC(LogVillageLocationRegistry, Log, All);
 
+// Region: Local constants.
+#pragma region LocalConstants
+namespace
+{
+	// Edge length of a spatial hash cell in centimeters.
+	constexpr float GridCellSize = 2000.0f;
+
+	// Tags with this many instances or fewer are searched linearly.
+	constexpr int32 LinearSearchThreshold = 8;
+
+	// Ring searches wider than this fall back to a linear scan.
+	constexpr int32 MaxSearchRing = 64;
+}
+#pragma endregion LocalConstants
+
 // Initialize and populate the registry at startup.
 void UVillageLocationRegistry::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -23,21 +38,100 @@ void UVillageLocationRegistry::Initialize(FSubsystemCollectionBase& Collection)
 	RefreshRegistry();
 }
 
-// Scans the world for tagged location actors and caches their transforms.
+// Unbinds navigation events on shutdown.
+void UVillageLocationRegistry::Deinitialize()
+{
+	if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSystem->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &UVillageLocationRegistry::HandleNavigationGenerationFinished);
+	}
+
+	Instances.Empty();
+	TagIndices.Reset();
+	InstanceByActor.Reset();
+	MissingTags.Reset();
+
+	Super::Deinitialize();
+}
+
+// Binds navigation rebuild events and re-projects locations registered before navigation was ready.
+void UVillageLocationRegistry::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+	{
+		NavSystem->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &UVillageLocationRegistry::HandleNavigationGenerationFinished);
+	}
+
+	RefreshRegistry();
+}
+
+// Scans the world for tagged location actors that are not registered yet.
 void UVillageLocationRegistry::RefreshRegistry()
 {
-	RegisteredLocations.Reset();
+	const int32 CountBefore = Instances.Num();
 
 	if (UWorld* World = GetWorld())
 	{
 		for (TActorIterator<ATaggedLocationActor> It(World); It; ++It)
 		{
-			AddFromActor(*It);
+			if (!InstanceByActor.Contains(*It))
+			{
+				AddFromActor(*It); // Existing instances keep their occupancy and handles.
+			}
+		}
+	}
+
+	if (Instances.Num() != CountBefore)
+	{
+		NotifyLocationsChanged(false);
+	}
+}
+
+// Adds a tagged location actor as a new instance of its tag.
+void UVillageLocationRegistry::RegisterLocation(ATaggedLocationActor* Actor)
+{
+	if (Actor && InstanceByActor.Contains(Actor))
+	{
+		return; // Already registered by the initial scan.
+	}
+
+	const int32 CountBefore = Instances.Num();
+	AddFromActor(Actor);
+
+	if (Instances.Num() != CountBefore)
+	{
+		NotifyLocationsChanged(false);
+	}
+}
+
+// Removes a tagged location actor's instance.
+void UVillageLocationRegistry::UnregisterLocation(ATaggedLocationActor* Actor)
+{
+	int32 InstanceIndex = INDEX_NONE;
+	if (!Actor || !InstanceByActor.RemoveAndCopyValue(Actor, InstanceIndex) || !Instances.IsValidIndex(InstanceIndex))
+	{
+		return; // Never registered.
+	}
+
+	const FGameplayTag LocationTag = Instances[InstanceIndex].LocationTag;
+	if (FTagIndex* TagIndex = TagIndices.Find(LocationTag))
+	{
+		RemoveFromGrid(*TagIndex, InstanceIndex);
+		TagIndex->Instances.Remove(InstanceIndex);
+
+		if (TagIndex->Instances.Num() == 0)
+		{
+			TagIndices.Remove(LocationTag);
 		}
 	}
+
+	Instances.RemoveAt(InstanceIndex);
+	NotifyLocationsChanged(false);
 }
 
-// Attempts to fetch a transform for a given tag. Refreshes and projects to nav if needed.
+// Returns the first instance of a tag; unknown tags trigger at most one world scan.
 bool UVillageLocationRegistry::TryGetLocation(const FGameplayTag& LocationTag, FTransform& OutTransform)
 {
 	if (!LocationTag.IsValid())
@@ -45,45 +139,171 @@ bool UVillageLocationRegistry::TryGetLocation(const FGameplayTag& LocationTag, F
 		return false;
 	}
 
-	bool bFoundLocation = false;
+	if (const FTagIndex* Found = TagIndices.Find(LocationTag))
+	{
+		OutTransform = Instances[Found->Instances[0]].Transform;
+		return true;
+	}
+
+	if (MissingTags.Contains(LocationTag))
+	{
+		return false; // Already scanned for this tag.
+	}
+
+	// Registration is event-driven; scan once in case an actor was placed without going through BeginPlay.
+	RefreshRegistry();
+
+	if (const FTagIndex* Retry = TagIndices.Find(LocationTag))
+	{
+		OutTransform = Instances[Retry->Instances[0]].Transform;
+		return true;
+	}
+
+	UE_LOG(LogVillageLocationRegistry, Warning, TEXT("No TaggedLocationActor provides %s; further lookups will fail without rescanning."), *LocationTag.ToString());
+	MissingTags.Add(LocationTag);
+	return false;
+}
+
+// Reports whether a lookup may succeed; tags never looked up still count since the first lookup rescans.
+bool UVillageLocationRegistry::MayResolveLocation(const FGameplayTag& LocationTag) const
+{
+	return LocationTag.IsValid() && (TagIndices.Contains(LocationTag) || !MissingTags.Contains(LocationTag));
+}
+
+// Finds the closest instance of a tag with spare capacity.
+bool UVillageLocationRegistry::FindNearestFreeInstance(const FGameplayTag& LocationTag, const FVector& Position, FVillageLocationHandle& OutHandle, FTransform& OutTransform) const
+{
+	const FTagIndex* TagIndex = TagIndices.Find(LocationTag);
+	if (!TagIndex)
+	{
+		return false;
+	}
+
+	const int32 InstanceIndex = FindNearestInstanceIndex(*TagIndex, Position, true);
+	if (InstanceIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutHandle = MakeHandle(InstanceIndex);
+	OutTransform = Instances[InstanceIndex].Transform;
+	return true;
+}
 
-	if (const FTransform* Found = RegisteredLocations.Find(LocationTag))
+// Finds the instance of a tag with the fewest occupants, preferring the closest on ties.
+bool UVillageLocationRegistry::FindLeastOccupiedInstance(const FGameplayTag& LocationTag, const FVector& Position, FVillageLocationHandle& OutHandle, FTransform& OutTransform) const
+{
+	const FTagIndex* TagIndex = TagIndices.Find(LocationTag);
+	if (!TagIndex)
 	{
-		OutTransform = *Found;
-		bFoundLocation = true;
+		return false;
 	}
-	else
+
+	int32 BestIndex = INDEX_NONE;
+	int32 BestOccupancy = MAX_int32;
+	double BestDistanceSq = TNumericLimits<double>::Max();
+
+	for (const int32 InstanceIndex : TagIndex->Instances)
 	{
-		// Registry may not have seen newly placed actors yet; refresh on demand.
-		RefreshRegistry();
+		const FLocationInstance& Instance = Instances[InstanceIndex];
+		const double DistanceSq = FVector::DistSquared(Instance.Transform.GetLocation(), Position);
 
-		if (const FTransform* Retry = RegisteredLocations.Find(LocationTag))
+		if (Instance.Occupancy < BestOccupancy || (Instance.Occupancy == BestOccupancy && DistanceSq < BestDistanceSq))
 		{
-			OutTransform = *Retry;
-			bFoundLocation = true;
+			BestIndex = InstanceIndex;
+			BestOccupancy = Instance.Occupancy;
+			BestDistanceSq = DistanceSq;
 		}
 	}
 
-	if (!bFoundLocation)
+	if (BestIndex == INDEX_NONE)
 	{
 		return false;
 	}
 
-	// Always project to NavMesh to correct vertical offsets from placed actors.
-	if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	OutHandle = MakeHandle(BestIndex);
+	OutTransform = Instances[BestIndex].Transform;
+	return true;
+}
+
+// Picks the nearest free instance, falling back to the least occupied, and reserves it.
+bool UVillageLocationRegistry::AcquireInstance(const FGameplayTag& LocationTag, const FVector& Position, FVillageLocationHandle& OutHandle, FTransform& OutTransform)
+{
+	if (!FindNearestFreeInstance(LocationTag, Position, OutHandle, OutTransform) && !FindLeastOccupiedInstance(LocationTag, Position, OutHandle, OutTransform))
 	{
-		FNavLocation Projected;
-		if (NavSystem->ProjectPointToNavigation(OutTransform.GetLocation(), Projected, FVector(300.0f)))
-		{
-			OutTransform.SetLocation(Projected.Location);
-		}
+		return false;
 	}
 
+	return ReserveInstance(OutHandle);
+}
+
+// Increments the occupancy of an instance.
+bool UVillageLocationRegistry::ReserveInstance(const FVillageLocationHandle& Handle)
+{
+	const int32 InstanceIndex = ResolveHandle(Handle);
+	if (InstanceIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	++Instances[InstanceIndex].Occupancy;
 	return true;
 }
 
+// Decrements the occupancy of an instance and clears the handle.
+void UVillageLocationRegistry::ReleaseInstance(FVillageLocationHandle& Handle)
+{
+	const int32 InstanceIndex = ResolveHandle(Handle);
+	if (InstanceIndex != INDEX_NONE)
+	{
+		FLocationInstance& Instance = Instances[InstanceIndex];
+		Instance.Occupancy = FMath::Max(0, Instance.Occupancy - 1);
+	}
+
+	Handle.Reset();
+}
+
+// Returns the number of occupants of an instance.
+int32 UVillageLocationRegistry::GetInstanceOccupancy(const FVillageLocationHandle& Handle) const
+{
+	const int32 InstanceIndex = ResolveHandle(Handle);
+	return InstanceIndex != INDEX_NONE ? Instances[InstanceIndex].Occupancy : 0;
+}
+
+// Returns how many instances are registered for a tag.
+int32 UVillageLocationRegistry::GetInstanceCount(const FGameplayTag& LocationTag) const
+{
+	const FTagIndex* TagIndex = TagIndices.Find(LocationTag);
+	return TagIndex ? TagIndex->Instances.Num() : 0;
+}
+
+// Returns the first instance transform of every tag.
+TMap<FGameplayTag, FTransform> UVillageLocationRegistry::GetRegisteredLocations() const
+{
+	TMap<FGameplayTag, FTransform> Result;
+	Result.Reserve(TagIndices.Num());
+
+	for (const TPair<FGameplayTag, FTagIndex>& Pair : TagIndices)
+	{
+		Result.Add(Pair.Key, Instances[Pair.Value.Instances[0]].Transform);
+	}
+
+	return Result;
+}
+
+// Appends the projected location of every registered instance.
+void UVillageLocationRegistry::GetInstanceLocations(TArray<FVector>& OutLocations) const
+{
+	OutLocations.Reserve(OutLocations.Num() + Instances.Num());
+
+	for (const FLocationInstance& Instance : Instances)
+	{
+		OutLocations.Add(Instance.Transform.GetLocation());
+	}
+}
+
 // Adds a tagged actor to the registry, projecting to navmesh when available.
-void UVillageLocationRegistry::AddFromActor(const ATaggedLocationActor* Actor)
+void UVillageLocationRegistry::AddFromActor(ATaggedLocationActor* Actor)
 {
 	if (!Actor)
 	{
@@ -96,10 +316,31 @@ void UVillageLocationRegistry::AddFromActor(const ATaggedLocationActor* Actor)
 		return;
 	}
 
+	FLocationInstance NewInstance;
+	NewInstance.Actor = Actor;
+	NewInstance.LocationTag = Actor->LocationTag;
+	NewInstance.Transform = ProjectActorTransform(Actor);
+	NewInstance.Cell = GetCell(NewInstance.Transform.GetLocation());
+	NewInstance.Capacity = Actor->Capacity;
+	NewInstance.Serial = NextSerial++;
+
+	const int32 InstanceIndex = Instances.Add(MoveTemp(NewInstance));
+
+	FTagIndex& TagIndex = TagIndices.FindOrAdd(Actor->LocationTag);
+	TagIndex.Instances.Add(InstanceIndex);
+	AddToGrid(TagIndex, InstanceIndex);
+
+	InstanceByActor.Add(Actor, InstanceIndex);
+	MissingTags.Remove(Actor->LocationTag);
+}
+
+// Projects an actor transform onto the navmesh, falling back to the raw transform.
+FTransform UVillageLocationRegistry::ProjectActorTransform(const ATaggedLocationActor* Actor) const
+{
 	FTransform UseTransform = Actor->GetTaggedTransform();
 
 	UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
-	if (NavSystem)
+	if (NavSystem && NavSystem->GetDefaultNavDataInstance(FNavigationSystem::DontCreate))
 	{
 		FNavLocation Projected;
 		// Project within a generous extent to tolerate slight offsets.
@@ -113,10 +354,186 @@ void UVillageLocationRegistry::AddFromActor(const ATaggedLocationActor* Actor)
 		}
 	}
 
-	if (RegisteredLocations.Contains(Actor->LocationTag))
+	return UseTransform;
+}
+
+// Returns the grid cell containing a position.
+FIntPoint UVillageLocationRegistry::GetCell(const FVector& Position)
+{
+	return FIntPoint(FMath::FloorToInt(Position.X / GridCellSize), FMath::FloorToInt(Position.Y / GridCellSize));
+}
+
+// Files an instance in its tag's grid cell.
+void UVillageLocationRegistry::AddToGrid(FTagIndex& TagIndex, int32 InstanceIndex)
+{
+	const FIntPoint Cell = Instances[InstanceIndex].Cell;
+	TagIndex.Cells.FindOrAdd(Cell).Add(InstanceIndex);
+	TagIndex.MinCell = FIntPoint(FMath::Min(TagIndex.MinCell.X, Cell.X), FMath::Min(TagIndex.MinCell.Y, Cell.Y));
+	TagIndex.MaxCell = FIntPoint(FMath::Max(TagIndex.MaxCell.X, Cell.X), FMath::Max(TagIndex.MaxCell.Y, Cell.Y));
+}
+
+// Removes an instance from its tag's grid cell; bounds stay conservative.
+void UVillageLocationRegistry::RemoveFromGrid(FTagIndex& TagIndex, int32 InstanceIndex)
+{
+	const FIntPoint Cell = Instances[InstanceIndex].Cell;
+	if (TArray<int32>* CellInstances = TagIndex.Cells.Find(Cell))
+	{
+		CellInstances->Remove(InstanceIndex);
+		if (CellInstances->Num() == 0)
+		{
+			TagIndex.Cells.Remove(Cell);
+		}
+	}
+}
+
+// Returns the closest instance of a tag by searching grid rings outward from the query cell.
+int32 UVillageLocationRegistry::FindNearestInstanceIndex(const FTagIndex& TagIndex, const FVector& Position, bool bRequireFreeCapacity) const
+{
+	int32 BestIndex = INDEX_NONE;
+	double BestDistanceSq = TNumericLimits<double>::Max();
+
+	auto ConsiderInstance = [&](int32 InstanceIndex)
+	{
+		const FLocationInstance& Instance = Instances[InstanceIndex];
+		if (bRequireFreeCapacity && !Instance.HasFreeCapacity())
+		{
+			return;
+		}
+
+		const double DistanceSq = FVector::DistSquared(Instance.Transform.GetLocation(), Position);
+		if (DistanceSq < BestDistanceSq)
+		{
+			BestIndex = InstanceIndex;
+			BestDistanceSq = DistanceSq;
+		}
+	};
+
+	const FIntPoint Origin = GetCell(Position);
+	const int32 MaxRing = FMath::Max(
+		FMath::Max(Origin.X - TagIndex.MinCell.X, TagIndex.MaxCell.X - Origin.X),
+		FMath::Max(Origin.Y - TagIndex.MinCell.Y, TagIndex.MaxCell.Y - Origin.Y));
+
+	if (TagIndex.Instances.Num() <= LinearSearchThreshold || MaxRing > MaxSearchRing)
+	{
+		for (const int32 InstanceIndex : TagIndex.Instances)
+		{
+			ConsiderInstance(InstanceIndex);
+		}
+
+		return BestIndex;
+	}
+
+	auto ConsiderCell = [&](int32 CellX, int32 CellY)
+	{
+		if (const TArray<int32>* CellInstances = TagIndex.Cells.Find(FIntPoint(CellX, CellY)))
+		{
+			for (const int32 InstanceIndex : *CellInstances)
+			{
+				ConsiderInstance(InstanceIndex);
+			}
+		}
+	};
+
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		// Everything in this ring is at least (Ring - 1) cells away, so stop once that exceeds the best match.
+		const double RingMinDistance = FMath::Max(0, Ring - 1) * static_cast<double>(GridCellSize);
+		if (BestIndex != INDEX_NONE && RingMinDistance * RingMinDistance > BestDistanceSq)
+		{
+			break;
+		}
+
+		if (Ring == 0)
+		{
+			ConsiderCell(Origin.X, Origin.Y);
+			continue;
+		}
+
+		for (int32 Offset = -Ring; Offset <= Ring; ++Offset)
+		{
+			ConsiderCell(Origin.X + Offset, Origin.Y - Ring);
+			ConsiderCell(Origin.X + Offset, Origin.Y + Ring);
+		}
+
+		for (int32 Offset = -Ring + 1; Offset <= Ring - 1; ++Offset)
+		{
+			ConsiderCell(Origin.X - Ring, Origin.Y + Offset);
+			ConsiderCell(Origin.X + Ring, Origin.Y + Offset);
+		}
+	}
+
+	return BestIndex;
+}
+
+// Returns the instance slot for a handle, or INDEX_NONE when stale.
+int32 UVillageLocationRegistry::ResolveHandle(const FVillageLocationHandle& Handle) const
+{
+	if (!Handle.IsValid() || !Instances.IsValidIndex(Handle.InstanceIndex) || Instances[Handle.InstanceIndex].Serial != Handle.Serial)
+	{
+		return INDEX_NONE;
+	}
+
+	return Handle.InstanceIndex;
+}
+
+// Builds a handle for an instance slot.
+FVillageLocationHandle UVillageLocationRegistry::MakeHandle(int32 InstanceIndex) const
+{
+	FVillageLocationHandle Handle;
+	Handle.InstanceIndex = InstanceIndex;
+	Handle.Serial = Instances[InstanceIndex].Serial;
+	return Handle;
+}
+
+// Re-projects every registered location after the navmesh finished building.
+void UVillageLocationRegistry::HandleNavigationGenerationFinished(ANavigationData* NavData)
+{
+	for (auto It = Instances.CreateIterator(); It; ++It)
+	{
+		FLocationInstance& Instance = *It;
+		const ATaggedLocationActor* Actor = Instance.Actor.Get();
+		if (!Actor)
+		{
+			continue; // Removed below through the tag index.
+		}
+
+		FTagIndex& TagIndex = TagIndices.FindChecked(Instance.LocationTag);
+		RemoveFromGrid(TagIndex, It.GetIndex());
+		Instance.Transform = ProjectActorTransform(Actor);
+		Instance.Cell = GetCell(Instance.Transform.GetLocation());
+		AddToGrid(TagIndex, It.GetIndex());
+	}
+
+	// Drop instances whose actors were destroyed without ending play.
+	for (auto It = Instances.CreateIterator(); It; ++It)
+	{
+		if (!It->Actor.IsValid())
+		{
+			FTagIndex& TagIndex = TagIndices.FindChecked(It->LocationTag);
+			RemoveFromGrid(TagIndex, It.GetIndex());
+			TagIndex.Instances.Remove(It.GetIndex());
+			if (TagIndex.Instances.Num() == 0)
+			{
+				TagIndices.Remove(It->LocationTag);
+			}
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto It = InstanceByActor.CreateIterator(); It; ++It)
 	{
-		UE_LOG(LogVillageLocationRegistry, Warning, TEXT("Duplicate LocationTag %s found; overriding previous entry."), *Actor->LocationTag.ToString());
+		if (!Instances.IsValidIndex(It->Value))
+		{
+			It.RemoveCurrent();
+		}
 	}
 
-	RegisteredLocations.Add(Actor->LocationTag, UseTransform);
+	NotifyLocationsChanged(true);
+}
+
+// Bumps the revision and notifies listeners.
+void UVillageLocationRegistry::NotifyLocationsChanged(bool bNavigationRebuilt)
+{
+	++Revision;
+	OnLocationsChanged.Broadcast(bNavigationRebuilt);
 }
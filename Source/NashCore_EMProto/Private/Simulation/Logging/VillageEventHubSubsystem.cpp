@@ -0,0 +1,138 @@
+// Includes the village event hub declaration.
+#include "Simulation/Logging/VillageEventHubSubsystem.h"
+
+// Region: Simulation includes.
+#pragma region SimulationIncludes
+// Provides per-stage timing buckets.
+#include "Simulation/Core/VillageSimProfiler.h"
+#pragma endregion SimulationIncludes
+
+// Region: Local constants.
+#pragma region LocalConstants
+namespace
+{
+	// Topics hold one bit per event type.
+	static_assert(static_cast<int32>(EVillageEventType::Count) <= 32, "FVillageEventTopic::EventTypeMask holds one bit per event type.");
+}
+#pragma endregion LocalConstants
+
+// Drops subscriptions, villagers and undelivered events.
+void UVillageEventHubSubsystem::Deinitialize()
+{
+	Villagers.Empty(); // Drop villagers.
+	Subscriptions.Empty(); // Drop subscriptions.
+	Pending.Empty(); // Drop queued events.
+	Delivering.Empty(); // Drop the swap buffer.
+	Matches.Empty(); // Drop match scratch.
+
+	Super::Deinitialize(); // Preserve base cleanup.
+}
+
+// Delivers the events published since the last tick.
+void UVillageEventHubSubsystem::Tick(float DeltaTime)
+{
+	if (Pending.Num() == 0) // Nothing published.
+	{
+		return; // Nothing to deliver.
+	}
+
+	VILLAGE_SIM_SCOPE(Logging); // Count delivery in the simulation benchmark.
+
+	Swap(Pending, Delivering); // Events published during delivery wait for the next tick.
+	bDelivering = true; // Defer subscription removal.
+
+	for (int32 Index = 0; Index < Subscriptions.Num(); ++Index) // Visit every subscription, including ones added during delivery.
+	{
+		const FSubscription& Subscription = Subscriptions[Index]; // Subscription being served.
+		if (!Subscription.Delegate.IsBound()) // Skip removed subscriptions.
+		{
+			continue; // Unsubscribed during this delivery.
+		}
+
+		Matches.Reset(); // Reuse the scratch list.
+		for (const FVillageEventNotification& Notification : Delivering) // Filter the batch by topic.
+		{
+			if (Subscription.Topic.Matches(Notification)) // Topic wants the event.
+			{
+				Matches.Add(&Notification); // Record the match.
+			}
+		}
+
+		if (Matches.Num() > 0) // Something matched.
+		{
+			Subscriptions[Index].Delegate.Execute(Matches); // Re-index; callbacks may subscribe and grow the array.
+		}
+	}
+
+	bDelivering = false; // Delivery finished.
+	Subscriptions.RemoveAll([](const FSubscription& Subscription) { return !Subscription.Delegate.IsBound(); }); // Remove unsubscribed entries.
+	Delivering.Reset(); // Keep the allocation.
+}
+
+// Provides the stat identifier used by the tickable object manager.
+TStatId UVillageEventHubSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UVillageEventHubSubsystem, STATGROUP_Tickables); // Provide the tickable stat.
+}
+
+// Adds a villager to the registry.
+void UVillageEventHubSubsystem::RegisterVillager(UVillagerLogComponent* Villager)
+{
+	if (Villager) // Skip null villagers.
+	{
+		Villagers.AddUnique(Villager); // Record once.
+	}
+}
+
+// Removes a villager from the registry; its undelivered events are still delivered.
+void UVillageEventHubSubsystem::UnregisterVillager(UVillagerLogComponent* Villager)
+{
+	Villagers.RemoveAll([Villager](const TWeakObjectPtr<UVillagerLogComponent>& Registered) // Drop the villager and stale entries.
+	{
+		return !Registered.IsValid() || Registered.Get() == Villager; // Stale or the removed villager.
+	});
+}
+
+// Queues a villager's event for the next delivery.
+void UVillageEventHubSubsystem::Publish(UVillagerLogComponent* Source, const FVillagerLogEntry& Entry)
+{
+	if (Subscriptions.Num() == 0 || !Source) // Nobody subscribed or no source.
+	{
+		return; // Nobody listens; skip the copy.
+	}
+
+	FVillageEventNotification& Notification = Pending.AddDefaulted_GetRef(); // New queued event.
+	Notification.Source = Source; // Publishing component.
+	Notification.VillagerIdTag = Source->VillagerIdTag; // Identifier of the villager.
+	Notification.Entry = Entry; // Copy the entry.
+}
+
+// Subscribes to the events of a topic.
+FDelegateHandle UVillageEventHubSubsystem::Subscribe(const FVillageEventTopic& Topic, FOnVillageEventBatch&& Delegate)
+{
+	const FDelegateHandle Handle = Delegate.GetHandle(); // Handle returned to the subscriber.
+	Subscriptions.Add({ Topic, MoveTemp(Delegate) }); // Store the subscription.
+	return Handle; // Provide the handle.
+}
+
+// Removes a subscription.
+void UVillageEventHubSubsystem::Unsubscribe(FDelegateHandle Handle)
+{
+	if (!Handle.IsValid()) // Nothing to remove.
+	{
+		return; // Skip the scan.
+	}
+
+	for (FSubscription& Subscription : Subscriptions) // Look for the subscription.
+	{
+		if (Subscription.Delegate.GetHandle() == Handle) // Found it.
+		{
+			Subscription.Delegate.Unbind(); // Removed after delivery so the delivery loop stays valid.
+		}
+	}
+
+	if (!bDelivering) // Not delivering.
+	{
+		Subscriptions.RemoveAll([](const FSubscription& Subscription) { return !Subscription.Delegate.IsBound(); }); // Remove now.
+	}
+}
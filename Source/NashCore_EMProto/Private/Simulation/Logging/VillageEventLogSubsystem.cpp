@@ -0,0 +1,197 @@
+// Includes the village event log declaration.
+#include "Simulation/Logging/VillageEventLogSubsystem.h"
+
+// Region: Simulation includes.
+#pragma region SimulationIncludes
+// Provides per-stage timing buckets.
+#include "Simulation/Core/VillageSimProfiler.h"
+// Provides the short tag display names.
+#include "Simulation/Logging/VillagerLogComponent.h"
+// Provides the simulation minute of each event.
+#include "Simulation/Time/VillageClockSubsystem.h"
+#pragma endregion SimulationIncludes
+
+// Output log sink; records are formatted for it only at Verbose verbosity.
+DEFINE_LOG_CATEGORY_STATIC(LogVillageEvents, Log, All);
+
+// Region: Local constants.
+#pragma region LocalConstants
+namespace
+{
+	// Events retained village-wide.
+	constexpr int32 EventCapacity = 4096;
+}
+#pragma endregion LocalConstants
+
+// Allocates the ring buffer and resolves the clock.
+void UVillageEventLogSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection); // Preserve base initialization.
+
+	Clock = Collection.InitializeDependency<UVillageClockSubsystem>(); // Ensure the clock exists first.
+
+	Records.SetNum(EventCapacity); // Allocate every record up front.
+	Messages.SetNum(EventCapacity); // One message slot per record.
+
+	Tags.Add(FGameplayTag()); // Index zero stands for no tag.
+	ShortTagNames.Add(UVillagerLogComponent::GetShortTagString(FGameplayTag())); // Display name of the empty tag.
+}
+
+// Releases the ring buffer and tag table.
+void UVillageEventLogSubsystem::Deinitialize()
+{
+	Records.Empty(); // Release records.
+	Messages.Empty(); // Release messages.
+	Tags.Empty(); // Release tags.
+	ShortTagNames.Empty(); // Release display names.
+	TagIndices.Empty(); // Release tag lookups.
+	Clock = nullptr; // Drop the clock.
+
+	Super::Deinitialize(); // Preserve base cleanup.
+}
+
+// Records an event of a villager and returns the stored record.
+const FVillageEventRecord& UVillageEventLogSubsystem::Write(EVillageEventType Type, const FGameplayTag& ActorTag, const FVillageEventParams& Params, const FString& Message)
+{
+	VILLAGE_SIM_SCOPE(Logging); // Count logging in the simulation benchmark.
+
+	const int32 Slot = static_cast<int32>(NextSequence % Records.Num()); // Ring slot of the new record.
+
+	FVillageEventRecord& Record = Records[Slot]; // Record being overwritten.
+	Record.Sequence = NextSequence++; // Assign the sequence number.
+	Record.SimMinute = Clock ? Clock->GetTotalMinutes() : 0; // Stamp the simulation minute.
+	Record.Values[0] = Params.Values[0]; // First value.
+	Record.Values[1] = Params.Values[1]; // Second value.
+	Record.ActorTag = InternTag(ActorTag); // Acting villager.
+	Record.TargetTag = InternTag(Params.Target); // Target villager.
+	Record.ActivityTag = InternTag(Params.Activity); // Activity involved.
+	Record.ResourceTag = InternTag(Params.Resource); // Resource involved.
+	Record.LocationTag = InternTag(Params.Location); // Location involved.
+	Record.Type = Type; // Event type.
+
+	if (Type == EVillageEventType::Message || !Messages[Slot].IsEmpty()) // Free text event or a stale message to clear.
+	{
+		Messages[Slot] = Message; // Store the text.
+	}
+
+	UE_LOG(LogVillageEvents, Verbose, TEXT("%s"), *FormatEvent(Record, Messages[Slot])); // Formatted only when Verbose is enabled.
+
+	return Record; // Provide the stored record.
+}
+
+// Returns a retained record by sequence number.
+const FVillageEventRecord* UVillageEventLogSubsystem::FindEvent(uint64 Sequence) const
+{
+	if (Sequence < GetFirstSequence() || Sequence >= NextSequence) // Overwritten or not written yet.
+	{
+		return nullptr; // Not retained.
+	}
+
+	return &Records[static_cast<int32>(Sequence % Records.Num())]; // Ring slot of the record.
+}
+
+// Returns the text of a retained free text event.
+const FString& UVillageEventLogSubsystem::GetEventMessage(uint64 Sequence) const
+{
+	static const FString Empty; // Returned for missing events.
+	return FindEvent(Sequence) ? Messages[static_cast<int32>(Sequence % Messages.Num())] : Empty; // Text of the retained record.
+}
+
+// Formats a record as "[Actor] text".
+FString UVillageEventLogSubsystem::FormatEvent(const FVillageEventRecord& Record, const FString& Message) const
+{
+	if (Record.TargetTag != 0 && Record.Type == EVillageEventType::Message) // Directed free text.
+	{
+		return FString::Printf(TEXT("[%s] -> [%s] %s"), *GetShortTagName(Record.ActorTag), *GetShortTagName(Record.TargetTag), *Message); // Name both villagers.
+	}
+
+	return FString::Printf(TEXT("[%s] %s"), *GetShortTagName(Record.ActorTag), *FormatBody(Record, Message)); // Actor followed by the body.
+}
+
+// Returns the tag stored at a tag index.
+const FGameplayTag& UVillageEventLogSubsystem::GetTag(uint16 TagIndex) const
+{
+	return Tags.IsValidIndex(TagIndex) ? Tags[TagIndex] : Tags[0]; // Fall back to the empty tag.
+}
+
+// Returns the short display name of the tag stored at a tag index.
+const FString& UVillageEventLogSubsystem::GetShortTagName(uint16 TagIndex) const
+{
+	return ShortTagNames.IsValidIndex(TagIndex) ? ShortTagNames[TagIndex] : ShortTagNames[0]; // Fall back to the empty tag's name.
+}
+
+// Returns the index of a tag, adding it to the table on first use.
+uint16 UVillageEventLogSubsystem::InternTag(const FGameplayTag& Tag)
+{
+	if (!Tag.IsValid()) // Empty tags use index zero.
+	{
+		return 0; // No tag.
+	}
+
+	if (const uint16* Existing = TagIndices.Find(Tag)) // Already interned.
+	{
+		return *Existing; // Reuse the index.
+	}
+
+	if (Tags.Num() > MAX_uint16) // Table cannot address more tags.
+	{
+		return 0; // Table full; the event still records its type and values.
+	}
+
+	const uint16 TagIndex = static_cast<uint16>(Tags.Add(Tag)); // Add the tag.
+	ShortTagNames.Add(UVillagerLogComponent::GetShortTagString(Tag)); // Cache its display name.
+	TagIndices.Add(Tag, TagIndex); // Remember its index.
+	return TagIndex; // Provide the new index.
+}
+
+// Formats the type-specific text of a record.
+FString UVillageEventLogSubsystem::FormatBody(const FVillageEventRecord& Record, const FString& Message) const
+{
+	const FString& Activity = GetShortTagName(Record.ActivityTag); // Activity display name.
+	const FString& Resource = GetShortTagName(Record.ResourceTag); // Resource display name.
+	const FString& Target = GetShortTagName(Record.TargetTag); // Target display name.
+	const FString& Location = GetShortTagName(Record.LocationTag); // Location display name.
+
+	switch (Record.Type) // Text per event type.
+	{
+	case EVillageEventType::ActivityStarted:
+		return Record.LocationTag != 0
+			? FString::Printf(TEXT("Starting activity: %s at %s"), *Activity, *Location)
+			: FString::Printf(TEXT("Starting activity: %s"), *Activity); // Mention the location when known.
+	case EVillageEventType::ActivityCompleted:
+		return FString::Printf(TEXT("Completed activity: %s"), *Activity); // Completion.
+	case EVillageEventType::ActivityLocationReached:
+		return FString::Printf(TEXT("Arrived at activity location for %s."), *Activity); // Arrival.
+	case EVillageEventType::ActivityLocationMissing:
+		return FString::Printf(TEXT("Activity %s has no valid location; skipping."), *Activity); // Missing location.
+	case EVillageEventType::ActivityCooldownDelayed:
+		return FString::Printf(TEXT("Delaying activity %s due to provider cooldown."), *Activity); // Cooldown delay.
+	case EVillageEventType::ActivityCooldownSkipped:
+		return FString::Printf(TEXT("Skipping activity %s due to provider cooldown."), *Activity); // Cooldown skip.
+	case EVillageEventType::ActivityRetryDelayed:
+		return FString::Printf(TEXT("Delaying activity %s retry for %.1f seconds after navigation failure."), *Activity, Record.Values[0]); // Navigation retry.
+	case EVillageEventType::MovementFailed:
+		return FString::Printf(TEXT("Movement failed for activity %s, retrying selection after %.1f seconds."), *Activity, Record.Values[0]); // Movement failure.
+	case EVillageEventType::NeedSwitch:
+		return FString::Printf(TEXT("Switching to satisfy need: %s"), *Resource); // Need switch.
+	case EVillageEventType::NeedInterrupt:
+		return FString::Printf(TEXT("Activity interrupted by need: %s"), *Resource); // Need interrupt.
+	case EVillageEventType::ResourceFetchStarted:
+		return FString::Printf(TEXT("Fetching resource %s from %s at %s before %s."), *Resource, *Target, *Location, *Activity); // Fetch start.
+	case EVillageEventType::ResourceProviderMissing:
+		return FString::Printf(TEXT("No provider found for %s; proceeding to %s without fetch."), *Resource, *Activity); // Missing provider.
+	case EVillageEventType::ResourceAcquired:
+		return FString::Printf(TEXT("Acquired %.2f of %s from %s at %s; proceeding to %s."), Record.Values[0], *Resource, *Target, *Location, *Activity); // Trade.
+	case EVillageEventType::ProviderUnavailable:
+		return FString::Printf(TEXT("Provider %s unavailable at %s; retrying after %.1f seconds."), *Target, *Location, Record.Values[0]); // Provider absent.
+	case EVillageEventType::ProviderUnreachable:
+		return FString::Printf(TEXT("Failed to reach provider for %s; reselecting after %.1f seconds."), *Activity, Record.Values[0]); // Provider unreachable.
+	case EVillageEventType::AffectionMissedTrade:
+		return FString::Printf(TEXT("Affection toward %s decreased to %.3f (missed trade)."), *Target, Record.Values[0]); // Missed trade.
+	case EVillageEventType::AffectionTrade:
+		return FString::Printf(TEXT("Affection toward %s updated to %.3f (trade, %s)."), *Target, Record.Values[0], Record.Values[1] > 0.0f ? TEXT("critical") : TEXT("mild")); // Trade affection.
+	case EVillageEventType::Message:
+	default:
+		return Message; // Free text.
+	}
+}
@@ -5,6 +5,12 @@
 #pragma region EngineIncludes
 // Provides access to engine-wide logging utilities.
 #include "Engine/Engine.h"
+// Provides the world owning the village event log.
+#include "Engine/World.h"
+// Supplies benchmark timing scopes.
+#include "Simulation/Core/VillageSimProfiler.h"
+// Provides the hub events are published to.
+#include "Simulation/Logging/VillageEventHubSubsystem.h"
 #pragma endregion EngineIncludes
 // Region: Gameplay tags.
 #pragma region GameplayTagIncludes
@@ -17,6 +23,31 @@ UVillagerLogComponent::UVillagerLogComponent()
 	PrimaryComponentTick.bCanEverTick = false; // Disable ticking to meet performance constraints.
 }
 
+// Registers with the village event hub.
+void UVillagerLogComponent::BeginPlay()
+{
+	Super::BeginPlay(); // Preserve base initialization.
+
+	const UWorld* World = GetWorld(); // Hub lives on the world.
+	EventHub = World ? World->GetSubsystem<UVillageEventHubSubsystem>() : nullptr; // Cache for publishing.
+	if (EventHub.IsValid()) // Announce this villager to consumers.
+	{
+		EventHub->RegisterVillager(this); // Consumers find villagers without scanning the world.
+	}
+}
+
+// Unregisters from the village event hub.
+void UVillagerLogComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (EventHub.IsValid()) // Remove this villager from the registry.
+	{
+		EventHub->UnregisterVillager(this); // Despawned villagers drop out of the registry.
+	}
+	EventHub = nullptr; // Stop publishing.
+
+	Super::EndPlay(EndPlayReason); // Preserve base cleanup.
+}
+
 // Global toggle for on-screen debug rendering.
 bool UVillagerLogComponent::bOnScreenDebugEnabled = true;
 
@@ -38,26 +69,91 @@ bool UVillagerLogComponent::IsOnScreenDebugEnabled()
 	return bOnScreenDebugEnabled; // Provide the current global flag value.
 }
 
-// Emits a log line, prefixing it with the villager identifier and an optional target.
+// Emits a free text log line with an optional target villager.
 void UVillagerLogComponent::LogAction(const FString& ActionDescription, const FGameplayTag& TargetVillagerTag)
 {
-	const FString ActorLabel = GetShortTagString(VillagerIdTag);
-	const FString TargetSuffix = TargetVillagerTag.IsValid() ? FString::Printf(TEXT(" -> [%s]"), *GetShortTagString(TargetVillagerTag)) : FString();
-	const FString ComposedMessage = FString::Printf(TEXT("[%s]%s %s"), *ActorLabel, *TargetSuffix, *ActionDescription);
+	RecordEvent(EVillageEventType::Message, FVillageEventParams().SetTarget(TargetVillagerTag), ActionDescription); // Free text event.
+}
+
+// Records a structured event.
+void UVillagerLogComponent::LogEvent(EVillageEventType Type, const FVillageEventParams& Params)
+{
+	RecordEvent(Type, Params, FString()); // Structured event without text.
+}
+
+// Formats an entry as a log line.
+FString UVillagerLogComponent::FormatEntry(const FVillagerLogEntry& Entry) const
+{
+	const UVillageEventLogSubsystem* EventLog = GetEventLog(); // Tag names live in the village log.
+	return EventLog ? EventLog->FormatEvent(Entry.Record, Entry.Message) : Entry.Message; // Format on demand.
+}
+
+// Formats the buffered log lines for UI consumption.
+TArray<FString> UVillagerLogComponent::GetRecentMessages() const
+{
+	TArray<FString> Lines; // Formatted lines.
+	Lines.Reserve(GetEntryCount()); // One line per event.
+	ForEachEntry(0, [this, &Lines](const FVillagerLogEntry& Entry) // Oldest first.
+	{
+		Lines.Add(FormatEntry(Entry)); // Format on demand.
+	});
+	return Lines; // Provide formatted lines.
+}
 
-	if (GEngine && bOnScreenDebugEnabled) // Verify engine availability and debug setting.
+// Visits buffered entries newer than a sequence number, oldest first.
+void UVillagerLogComponent::ForEachEntry(uint64 AfterSequence, TFunctionRef<void(const FVillagerLogEntry&)> Visitor) const
+{
+	const uint64 Capacity = History.Num(); // Ring size.
+	const uint64 OldestSequence = NextSequence - GetEntryCount(); // Oldest retained entry.
+	for (uint64 Sequence = FMath::Max(AfterSequence + 1, OldestSequence); Sequence < NextSequence; ++Sequence) // Skip entries already seen.
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Yellow, ComposedMessage); // Draw message for a short duration.
+		Visitor(History[static_cast<int32>((Sequence - 1) % Capacity)]); // Hand out the slot by reference.
 	}
+}
+
+// Writes an event to the village event log, buffers it and notifies consumers.
+void UVillagerLogComponent::RecordEvent(EVillageEventType Type, const FVillageEventParams& Params, const FString& Message)
+{
+	VILLAGE_SIM_SCOPE(Logging); // Count event recording in the simulation benchmark.
 
-	RecentMessages.Add(ComposedMessage); // Buffer the message for UI.
+	UVillageEventLogSubsystem* EventLog = GetEventLog(); // Resolve the village log.
+	if (!EventLog) // No world to log into.
+	{
+		return;
+	}
 
-	if (RecentMessages.Num() > MaxStoredMessages) // Trim old entries.
+	if (History.Num() == 0) // Size the ring on first use so MaxStoredMessages can be configured before play.
 	{
-		RecentMessages.RemoveAt(0);
+		History.SetNum(FMath::Max(1, MaxStoredMessages)); // Fixed capacity from here on.
 	}
 
-	OnLogLineAdded.Broadcast(this, ComposedMessage); // Notify UI listeners with source context.
+	FVillagerLogEntry& Entry = History[static_cast<int32>((NextSequence - 1) % History.Num())]; // Overwrite the oldest slot.
+	Entry.Sequence = NextSequence++; // Stamp the per-villager sequence.
+	Entry.Record = EventLog->Write(Type, VillagerIdTag, Params, Message); // Store the compact record.
+	Entry.Message = Message; // Empty for structured events.
+
+	if (UVillageEventHubSubsystem* Hub = EventHub.Get()) // Publish to subscribed consumers.
+	{
+		Hub->Publish(this, Entry); // Delivered as part of the next frame's batch.
+	}
+
+	const bool bDrawOnScreen = GEngine && bOnScreenDebugEnabled; // Verify engine availability and debug setting.
+	if (bDrawOnScreen || OnLogLineAdded.IsBound()) // Format only when someone consumes the text.
+	{
+		const FString ComposedMessage = EventLog->FormatEvent(Entry.Record, Entry.Message); // Build the line once.
+		if (bDrawOnScreen)
+		{
+			GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Yellow, ComposedMessage); // Draw message for a short duration.
+		}
+		OnLogLineAdded.Broadcast(this, ComposedMessage); // Notify UI listeners with source context.
+	}
+}
+
+// Resolves the village event log.
+UVillageEventLogSubsystem* UVillagerLogComponent::GetEventLog() const
+{
+	const UWorld* World = GetWorld(); // Event log lives on the world.
+	return World ? World->GetSubsystem<UVillageEventLogSubsystem>() : nullptr; // May be null outside a world.
 }
 
 // Returns the resolved log text color for this villager.
@@ -0,0 +1,506 @@
+// Includes the Mass villager subsystem declaration.
+#include "Simulation/Mass/VillageMassSubsystem.h"
+
+// Region: Engine includes.
+#pragma region EngineIncludes
+// Provides the camera location used for representation.
+#include "Camera/PlayerCameraManager.h"
+// Provides world access for subsystem lookups.
+#include "Engine/World.h"
+// Provides the local player's camera manager.
+#include "GameFramework/PlayerController.h"
+// Provides entity creation and fragment access.
+#include "MassEntityManager.h"
+// Provides the world's entity manager.
+#include "MassEntitySubsystem.h"
+// Provides processor execution.
+#include "MassExecutor.h"
+// Provides the processing context.
+#include "MassProcessingTypes.h"
+#pragma endregion EngineIncludes
+
+// Region: Simulation includes.
+#pragma region SimulationIncludes
+// Provides per-stage timing buckets.
+#include "Simulation/Core/VillageSimProfiler.h"
+// Provides archetype definitions copied into entities.
+#include "Simulation/Data/VillagerDataAssets.h"
+// Provides the actor spawned for represented villagers.
+#include "Simulation/Examples/ExampleVillagerCharacter.h"
+// Provides activity and trade locations.
+#include "Simulation/Locations/VillageLocationRegistry.h"
+// Provides the villager fragments.
+#include "Simulation/Mass/VillagerMassFragments.h"
+// Provides the villager processors.
+#include "Simulation/Mass/VillagerMassProcessors.h"
+// Provides the per-minute hook driving the entities.
+#include "Simulation/Time/VillageClockSubsystem.h"
+#pragma endregion SimulationIncludes
+
+// Log category for the Mass villager simulation.
+DEFINE_LOG_CATEGORY_STATIC(LogVillageMass, Log, All);
+
+// Region: Local constants.
+#pragma region LocalConstants
+namespace
+{
+	// Real seconds between representation refreshes.
+	constexpr float RepresentationIntervalSeconds = 0.25f;
+
+	// Represented villagers are released only past this multiple of the radius, so villagers on the edge do not flicker.
+	constexpr float ReleaseRadiusScale = 1.2f;
+
+	// Salt separating Mass decision streams from the actor components' streams.
+	constexpr uint32 MassDecisionStreamSalt = 0x4D415353;
+}
+#pragma endregion LocalConstants
+
+// Binds to the clock's per-minute hook.
+void UVillageMassSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection); // Preserve base initialization.
+
+	Collection.InitializeDependency<UMassEntitySubsystem>(); // Entities live in the Mass entity manager.
+
+	if (UVillageClockSubsystem* Clock = Collection.InitializeDependency<UVillageClockSubsystem>()) // Ensure the clock exists first.
+	{
+		MinuteProcessedHandle = Clock->OnMinuteProcessed.AddUObject(this, &UVillageMassSubsystem::ProcessMinute); // Step entities after each minute's wakeups.
+	}
+
+	RepresentationActorClass = AExampleVillagerCharacter::StaticClass(); // Default representation actor.
+}
+
+// Unbinds from the clock and drops entity bookkeeping.
+void UVillageMassSubsystem::Deinitialize()
+{
+	if (UVillageClockSubsystem* Clock = GetWorld() ? GetWorld()->GetSubsystem<UVillageClockSubsystem>() : nullptr) // Resolve the clock if it still exists.
+	{
+		Clock->OnMinuteProcessed.Remove(MinuteProcessedHandle); // Stop receiving minutes.
+	}
+
+	Villagers.Reset(); // Drop entity handles.
+	ProvidersByResource.Reset(); // Drop trade spots.
+	SharedValuesByArchetype.Reset(); // Drop shared fragment values.
+	RepresentedEntities.Reset(); // Drop represented entities.
+	RepresentedEntitySet.Reset(); // Drop the represented lookup.
+	RepresentedActors.Reset(); // Drop represented actors.
+
+	Super::Deinitialize(); // Preserve base cleanup.
+}
+
+// Refreshes the actors representing villagers near the camera.
+void UVillageMassSubsystem::Tick(float DeltaTime)
+{
+	RepresentationCountdown -= DeltaTime; // Real time, independent of the simulation time scale.
+	if (RepresentationCountdown > 0.0f) // Refreshed recently.
+	{
+		return; // Wait for the next refresh.
+	}
+
+	RepresentationCountdown = RepresentationIntervalSeconds; // Restart the interval.
+	UpdateRepresentation(); // Hand villagers between Mass and actors.
+}
+
+// Provides the stat identifier used by the tickable object manager.
+TStatId UVillageMassSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UVillageMassSubsystem, STATGROUP_Tickables); // Tickable stat for the subsystem.
+}
+
+// Spawns a villager entity of an archetype at a location.
+bool UVillageMassSubsystem::SpawnVillager(UVillagerArchetypeDataAsset* Archetype, const FVector& Location)
+{
+	if (!Archetype || Archetype->NeedDefinitions.Num() == 0 || !EnsureMassSetup()) // Validate the archetype and Mass setup.
+	{
+		return false; // Nothing to spawn.
+	}
+
+	UE_CLOG(Archetype->NeedDefinitions.Num() > FVillagerMassNeedsFragment::MaxNeeds, LogVillageMass, Warning, TEXT("Archetype %s has %d needs; Mass villagers simulate the first %d."), *Archetype->GetName(), Archetype->NeedDefinitions.Num(), FVillagerMassNeedsFragment::MaxNeeds); // Needs past the fragment capacity are dropped.
+
+	FMassEntityManager& EntityManager = GetWorld()->GetSubsystem<UMassEntitySubsystem>()->GetMutableEntityManager(); // Resolve the entity manager.
+	const FMassEntityHandle Entity = EntityManager.CreateEntity(EntityArchetype, FindOrAddSharedValues(Archetype)); // Create the entity with its archetype's shared values.
+
+	FVillagerMassNeedsFragment& Needs = EntityManager.GetFragmentDataChecked<FVillagerMassNeedsFragment>(Entity); // Needs fragment of the new entity.
+	Needs.NeedCount = FMath::Min(Archetype->NeedDefinitions.Num(), FVillagerMassNeedsFragment::MaxNeeds); // Simulated need count.
+	for (int32 NeedIndex = 0; NeedIndex < Needs.NeedCount; ++NeedIndex) // Seed every simulated need.
+	{
+		const FNeedDefinition& Definition = Archetype->NeedDefinitions[NeedIndex]; // Definition of the need.
+		Needs.Values[NeedIndex] = FMath::Clamp(Definition.StartingValue, Definition.MinValue, Definition.MaxValue); // Clamped starting value.
+	}
+
+	FVillagerMassActivityFragment& Activity = EntityManager.GetFragmentDataChecked<FVillagerMassActivityFragment>(Entity); // Activity fragment of the new entity.
+	Activity.Location = Location; // Spawn position.
+	Activity.Destination = Location; // Standing still.
+
+	FVillagerMassSocialFragment& Social = EntityManager.GetFragmentDataChecked<FVillagerMassSocialFragment>(Entity); // Social fragment of the new entity.
+	for (const FApprovalEntry& Approval : Archetype->SocialDefinition.Approvals) // Seed authored affection.
+	{
+		Social.AddAffection(Approval.VillagerIdTag, Approval.AffectionValue); // Affection toward the peer.
+	}
+
+	const UVillageClockSubsystem* Clock = GetWorld()->GetSubsystem<UVillageClockSubsystem>(); // Resolve the clock for the world seed.
+	const int32 WorldSeed = Clock ? Clock->GetWorldSeed() : 0; // Seed shared by the world.
+	FVillagerMassScheduleFragment& Schedule = EntityManager.GetFragmentDataChecked<FVillagerMassScheduleFragment>(Entity); // Schedule fragment of the new entity.
+	Schedule.DecisionStream.Initialize(static_cast<int32>(HashCombine(HashCombine(HashCombine(GetTypeHash(WorldSeed), FCrc::StrCrc32(*Archetype->VillagerIdTag.ToString())), GetTypeHash(SpawnSerial++)), MassDecisionStreamSalt))); // Same inputs for the same world seed and spawn order.
+	Schedule.NextPlanMinute = 0; // Plan on the first step.
+
+	RegisterProvider(*Archetype, Entity); // Offer the villager's trade spots.
+	Villagers.Add(Entity); // Simulate the villager.
+	return true; // Spawned.
+}
+
+// Returns the trade spots offering a resource.
+TConstArrayView<FVillageMassProvider> UVillageMassSubsystem::GetProviders(const FGameplayTag& ResourceTag) const
+{
+	const TArray<FVillageMassProvider>* Providers = ProvidersByResource.Find(ResourceTag); // Trade spots of the resource, if any.
+	return Providers ? TConstArrayView<FVillageMassProvider>(*Providers) : TConstArrayView<FVillageMassProvider>(); // Empty view when nobody offers it.
+}
+
+// Sets the actor class spawned for villagers near the camera.
+void UVillageMassSubsystem::SetRepresentationActorClass(TSubclassOf<AExampleVillagerCharacter> InActorClass)
+{
+	RepresentationActorClass = InActorClass; // Store the class.
+}
+
+// Sets the camera distance within which villagers are represented by actors.
+void UVillageMassSubsystem::SetRepresentationRadius(float InRadius)
+{
+	RepresentationRadius = InRadius; // Store the radius.
+}
+
+// Sets the maximum number of villagers represented by actors at once.
+void UVillageMassSubsystem::SetMaxRepresentedVillagers(int32 InMaxRepresented)
+{
+	MaxRepresentedVillagers = FMath::Max(0, InMaxRepresented); // Negative limits represent nobody.
+}
+
+// Creates the entity archetype and processors on first use.
+bool UVillageMassSubsystem::EnsureMassSetup()
+{
+	UMassEntitySubsystem* EntitySubsystem = GetWorld() ? GetWorld()->GetSubsystem<UMassEntitySubsystem>() : nullptr; // Resolve the entity subsystem.
+	if (!EntitySubsystem) // Mass is unavailable in this world.
+	{
+		return false; // Cannot simulate.
+	}
+
+	if (EntityArchetype.IsValid()) // Already set up.
+	{
+		return true; // Reuse the archetype and processors.
+	}
+
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager(); // Manager owning the entities.
+
+	const UScriptStruct* Fragments[] = // Fragments of every villager entity.
+	{
+		FVillagerMassNeedsFragment::StaticStruct(), // Need values.
+		FVillagerMassActivityFragment::StaticStruct(), // Activity, travel and trade state.
+		FVillagerMassSocialFragment::StaticStruct(), // Affection toward peers.
+		FVillagerMassScheduleFragment::StaticStruct() // Decision stream and next plan minute.
+	};
+	EntityArchetype = EntityManager.CreateArchetype(MakeArrayView(Fragments)); // Create the shared archetype.
+
+	ActivityProcessor = NewObject<UVillagerMassActivityProcessor>(this); // Create the activity processor.
+	ActivityProcessor->CallInitialize(this, EntityManager.AsShared()); // Bind it to the entity manager.
+
+	NeedsProcessor = NewObject<UVillagerMassNeedsProcessor>(this); // Create the needs processor.
+	NeedsProcessor->CallInitialize(this, EntityManager.AsShared()); // Bind it to the entity manager.
+
+	return EntityArchetype.IsValid(); // Report whether setup succeeded.
+}
+
+// Returns the shared fragment values of an archetype asset, resolving its locations on first use.
+const FMassArchetypeSharedFragmentValues& UVillageMassSubsystem::FindOrAddSharedValues(UVillagerArchetypeDataAsset* Archetype)
+{
+	if (const FMassArchetypeSharedFragmentValues* Found = SharedValuesByArchetype.Find(Archetype)) // Reuse values built for this asset.
+	{
+		return *Found; // Provide the cached values.
+	}
+
+	Archetype->GetCompiledArchetype(); // Bake tables on the game thread before processors read them in parallel.
+
+	UVillageLocationRegistry* Registry = GetWorld()->GetSubsystem<UVillageLocationRegistry>(); // Resolve the registry for activity locations.
+
+	FVillagerMassArchetypeFragment Fragment; // Shared data of every entity using this asset.
+	Fragment.Archetype = Archetype; // Source asset.
+	for (const FActivityDefinition& Definition : Archetype->ActivityDefinitions) // Resolve each activity's location once.
+	{
+		FTransform LocationTransform; // Resolved location, if any.
+		const bool bAvailable = !Definition.bRequiresSpecificLocation
+			|| (Registry && Definition.ActivityLocationTag.IsValid() && Registry->TryGetLocation(Definition.ActivityLocationTag, LocationTransform)); // Free-standing activities or resolvable locations.
+		Fragment.ActivityLocations.Add(LocationTransform.GetLocation()); // Location indexed by activity.
+		Fragment.ActivityAvailable.Add(bAvailable); // Availability indexed by activity.
+	}
+
+	FMassEntityManager& EntityManager = GetWorld()->GetSubsystem<UMassEntitySubsystem>()->GetMutableEntityManager(); // Manager owning the shared fragments.
+	FMassArchetypeSharedFragmentValues& SharedValues = SharedValuesByArchetype.Add(Archetype); // Cache the values for this asset.
+	SharedValues.AddConstSharedFragment(EntityManager.GetOrCreateConstSharedFragment(Fragment)); // Share one fragment instance between entities.
+	SharedValues.Sort(); // Shared values must be sorted before use.
+	return SharedValues; // Provide the new values.
+}
+
+// Adds the trade spots of a spawned provider villager.
+void UVillageMassSubsystem::RegisterProvider(const UVillagerArchetypeDataAsset& Archetype, FMassEntityHandle Entity)
+{
+	const FSocialDefinition& Social = Archetype.SocialDefinition; // Alias the social definition.
+	UVillageLocationRegistry* Registry = GetWorld()->GetSubsystem<UVillageLocationRegistry>(); // Resolve the registry for trade spots.
+	if (!Social.ProvidedResourceTag.IsValid() || !Registry) // Not a provider or no registry.
+	{
+		return; // Nothing to register.
+	}
+
+	for (const FTaggedLocation& TradeLocation : Social.TradeLocations) // Register each trade spot.
+	{
+		FTransform TradeTransform; // Resolved trade spot.
+		if (Registry->TryGetLocation(TradeLocation.LocationTag, TradeTransform)) // Tag-only resolution, like the provider registry.
+		{
+			ProvidersByResource.FindOrAdd(Social.ProvidedResourceTag).Add({ Entity, Archetype.VillagerIdTag, TradeTransform.GetLocation() }); // Offer the spot.
+		}
+	}
+}
+
+// Steps every simulated villager by one minute.
+void UVillageMassSubsystem::ProcessMinute(int64 Minute)
+{
+	if (Villagers.Num() == 0 || !ActivityProcessor || !NeedsProcessor) // Nothing to simulate.
+	{
+		return; // Skip the step.
+	}
+
+	const UVillageClockSubsystem* Clock = GetWorld()->GetSubsystem<UVillageClockSubsystem>(); // Resolve the clock for the time of day.
+	UMassEntitySubsystem* EntitySubsystem = GetWorld()->GetSubsystem<UMassEntitySubsystem>(); // Resolve the entity subsystem.
+	if (!Clock || !EntitySubsystem) // World is shutting down.
+	{
+		return; // Skip the step.
+	}
+
+	StepContext.Minute = Minute; // Minute being processed.
+	StepContext.Hour = Clock->GetCurrentHour(); // Hour of day.
+	StepContext.MinuteOfHour = Clock->GetCurrentMinute(); // Minute within the hour.
+	StepContext.SecondsPerGameMinute = Clock->GetSecondsPerGameMinute(); // Real seconds per game minute.
+
+	FMassProcessingContext ProcessingContext(EntitySubsystem->GetMutableEntityManager(), 0.0f); // Context shared by both processors.
+
+	{
+		VILLAGE_SIM_SCOPE(ActivitySelection); // Count selection in the simulation benchmark.
+		UE::Mass::Executor::Run(*ActivityProcessor, ProcessingContext); // Activities first, like wakeups before the needs stage.
+	}
+
+	{
+		VILLAGE_SIM_SCOPE(Needs); // Count needs in the simulation benchmark.
+		UE::Mass::Executor::Run(*NeedsProcessor, ProcessingContext); // Flushes deaths.
+	}
+
+	PruneDeadVillagers(); // Forget villagers that died this minute.
+}
+
+// Drops dead villagers from the entity and provider lists.
+void UVillageMassSubsystem::PruneDeadVillagers()
+{
+	const FMassEntityManager& EntityManager = GetWorld()->GetSubsystem<UMassEntitySubsystem>()->GetEntityManager(); // Manager owning the entities.
+
+	const int32 PreviousCount = Villagers.Num(); // Count before pruning.
+	Villagers.RemoveAll([&EntityManager](const FMassEntityHandle& Entity) { return !EntityManager.IsEntityValid(Entity); }); // Drop destroyed entities.
+	if (Villagers.Num() == PreviousCount) // Nobody died.
+	{
+		return; // Providers are unchanged.
+	}
+
+	for (TPair<FGameplayTag, TArray<FVillageMassProvider>>& Pair : ProvidersByResource) // Visit every resource.
+	{
+		Pair.Value.RemoveAll([&EntityManager](const FVillageMassProvider& Provider) { return !EntityManager.IsEntityValid(Provider.Entity); }); // Keeps pick order stable.
+	}
+}
+
+// Hands villagers entering the camera radius to actors and villagers leaving it back to Mass.
+void UVillageMassSubsystem::UpdateRepresentation()
+{
+	UMassEntitySubsystem* EntitySubsystem = GetWorld() ? GetWorld()->GetSubsystem<UMassEntitySubsystem>() : nullptr; // Resolve the entity subsystem.
+	if (!EntitySubsystem || (Villagers.Num() == 0 && RepresentedEntities.Num() == 0)) // Nothing to represent.
+	{
+		return; // Skip the update.
+	}
+
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager(); // Manager owning the entities.
+
+	FVector ViewLocation; // Camera location.
+	const bool bHasView = RepresentationRadius > 0.0f && GetViewLocation(ViewLocation); // Villagers are represented only with a camera and radius.
+
+	bool bActorDied = false; // Whether a represented villager died.
+	for (int32 Index = RepresentedEntities.Num() - 1; Index >= 0; --Index) // Walk backwards so swap removal is safe.
+	{
+		AExampleVillagerCharacter* Actor = RepresentedActors[Index]; // Actor of this entity.
+		if (!IsValid(Actor)) // The villager died while represented.
+		{
+			if (EntityManager.IsEntityValid(RepresentedEntities[Index])) // Entity survived its actor.
+			{
+				EntityManager.DestroyEntity(RepresentedEntities[Index]); // Destroy the orphaned entity.
+			}
+			RepresentedEntitySet.Remove(RepresentedEntities[Index]); // Forget the entity.
+			RepresentedEntities.RemoveAtSwap(Index); // Drop the entity.
+			RepresentedActors.RemoveAtSwap(Index); // Drop the actor.
+			bActorDied = true; // Prune after the loop.
+			continue; // Next represented villager.
+		}
+
+		if (!bHasView || FVector::DistSquared(Actor->GetActorLocation(), ViewLocation) > FMath::Square(RepresentationRadius * ReleaseRadiusScale)) // Camera moved away or is gone.
+		{
+			ReleaseRepresentation(Index); // Hand the villager back to Mass.
+		}
+	}
+
+	if (bActorDied) // Entities were destroyed.
+	{
+		PruneDeadVillagers(); // Forget dead villagers.
+	}
+
+	if (!bHasView) // No camera.
+	{
+		return; // Nobody else to represent.
+	}
+
+	const float RadiusSquared = FMath::Square(RepresentationRadius); // Compare squared distances.
+	for (const FMassEntityHandle& Entity : Villagers) // Visit every simulated villager.
+	{
+		if (RepresentedEntities.Num() >= MaxRepresentedVillagers) // Actor budget reached.
+		{
+			break; // Stop spawning.
+		}
+
+		const FVillagerMassActivityFragment& Activity = EntityManager.GetFragmentDataChecked<FVillagerMassActivityFragment>(Entity); // Activity fragment of the villager.
+		if (FVector::DistSquared(Activity.Location, ViewLocation) <= RadiusSquared && !RepresentedEntitySet.Contains(Entity)) // Near the camera and not yet represented.
+		{
+			SpawnRepresentation(Entity); // Continue the entity as an actor.
+		}
+	}
+}
+
+// Spawns an actor continuing an entity's state.
+bool UVillageMassSubsystem::SpawnRepresentation(FMassEntityHandle Entity)
+{
+	FMassEntityManager& EntityManager = GetWorld()->GetSubsystem<UMassEntitySubsystem>()->GetMutableEntityManager(); // Manager owning the entities.
+	const FVillagerMassArchetypeFragment* Shared = EntityManager.GetConstSharedFragmentDataPtr<FVillagerMassArchetypeFragment>(Entity); // Shared data of the entity.
+	if (!Shared || !Shared->Archetype || !RepresentationActorClass) // Missing data or actor class.
+	{
+		return false; // Cannot represent.
+	}
+
+	const FVillagerMassActivityFragment& Activity = EntityManager.GetFragmentDataChecked<FVillagerMassActivityFragment>(Entity); // Activity fragment of the entity.
+	const FTransform SpawnTransform(Activity.Location); // Spawn at the entity's location.
+	AExampleVillagerCharacter* Actor = GetWorld()->SpawnActorDeferred<AExampleVillagerCharacter>(RepresentationActorClass, SpawnTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn); // Defer so state is applied before BeginPlay.
+	if (!Actor) // Spawn failed.
+	{
+		return false; // Keep the entity simulated.
+	}
+
+	Actor->SetArchetypeData(Shared->Archetype); // Apply the archetype before BeginPlay.
+	UVillagerActivityComponent* ActivityComponent = Actor->FindComponentByClass<UVillagerActivityComponent>(); // Activity component of the actor.
+	if (ActivityComponent && Activity.IsActive()) // Entity is mid-activity.
+	{
+		ActivityComponent->SetAutoStartEnabled(false); // The entity's activity is resumed below; planning another would reserve a second spot.
+	}
+	Actor->FinishSpawning(SpawnTransform); // Run BeginPlay.
+
+	if (UVillagerNeedsComponent* NeedsComponent = Actor->FindComponentByClass<UVillagerNeedsComponent>()) // Copy needs into the actor.
+	{
+		const FVillagerMassNeedsFragment& Needs = EntityManager.GetFragmentDataChecked<FVillagerMassNeedsFragment>(Entity); // Needs fragment of the entity.
+		FVillagerNeedsBatchScope NeedsBatch(NeedsComponent); // One notification for all needs.
+		const int32 NeedCount = FMath::Min(Needs.NeedCount, NeedsComponent->GetNeedCount()); // Needs present on both sides.
+		for (int32 NeedIndex = 0; NeedIndex < NeedCount; ++NeedIndex) // Copy each need.
+		{
+			NeedsComponent->ApplyNeedDeltaByIndex(NeedIndex, Needs.Values[NeedIndex] - NeedsComponent->GetNeedValue(NeedIndex)); // Apply the difference.
+		}
+	}
+
+	if (UVillagerSocialComponent* SocialComponent = Actor->FindComponentByClass<UVillagerSocialComponent>()) // Copy affection into the actor.
+	{
+		const FVillagerMassSocialFragment& Social = EntityManager.GetFragmentDataChecked<FVillagerMassSocialFragment>(Entity); // Social fragment of the entity.
+		for (int32 PeerIndex = 0; PeerIndex < Social.PeerCount; ++PeerIndex) // Copy each peer.
+		{
+			SocialComponent->SetAffection(Social.PeerIds[PeerIndex], Social.Affection[PeerIndex]); // Set the affection.
+		}
+	}
+
+	if (ActivityComponent && Activity.IsActive()) // Entity was mid-activity.
+	{
+		ActivityComponent->ForceActivityByTag(Shared->Archetype->ActivityDefinitions[Activity.ActivityIndex].ActivityTag); // Resume the entity's activity; elapsed time restarts.
+	}
+
+	EntityManager.AddTagToEntity(Entity, FVillagerMassRepresentedTag::StaticStruct()); // Stop simulating the entity in Mass.
+	RepresentedEntities.Add(Entity); // Remember the entity.
+	RepresentedEntitySet.Add(Entity); // Index the entity for lookups.
+	RepresentedActors.Add(Actor); // Remember the actor.
+	return true; // Represented.
+}
+
+// Copies an actor's state back into its entity and destroys the actor.
+void UVillageMassSubsystem::ReleaseRepresentation(int32 RepresentedIndex)
+{
+	FMassEntityManager& EntityManager = GetWorld()->GetSubsystem<UMassEntitySubsystem>()->GetMutableEntityManager(); // Manager owning the entities.
+	const FMassEntityHandle Entity = RepresentedEntities[RepresentedIndex]; // Entity of the actor.
+	AExampleVillagerCharacter* Actor = RepresentedActors[RepresentedIndex]; // Actor being released.
+
+	const FVillagerMassArchetypeFragment* Shared = EntityManager.IsEntityValid(Entity) ? EntityManager.GetConstSharedFragmentDataPtr<FVillagerMassArchetypeFragment>(Entity) : nullptr; // Shared data while the entity lives.
+	if (Shared && Shared->Archetype) // Entity still valid.
+	{
+		if (const UVillagerNeedsComponent* NeedsComponent = Actor->FindComponentByClass<UVillagerNeedsComponent>()) // Copy needs back.
+		{
+			FVillagerMassNeedsFragment& Needs = EntityManager.GetFragmentDataChecked<FVillagerMassNeedsFragment>(Entity); // Needs fragment of the entity.
+			const int32 NeedCount = FMath::Min(Needs.NeedCount, NeedsComponent->GetNeedCount()); // Needs present on both sides.
+			for (int32 NeedIndex = 0; NeedIndex < NeedCount; ++NeedIndex) // Copy each need.
+			{
+				Needs.Values[NeedIndex] = NeedsComponent->GetNeedValue(NeedIndex); // Store the actor's value.
+			}
+		}
+
+		if (const UVillagerSocialComponent* SocialComponent = Actor->FindComponentByClass<UVillagerSocialComponent>()) // Copy affection back.
+		{
+			FVillagerMassSocialFragment& Social = EntityManager.GetFragmentDataChecked<FVillagerMassSocialFragment>(Entity); // Social fragment of the entity.
+			Social.PeerCount = 0; // Replace the stored peers.
+			for (const TPair<FGameplayTag, float>& Pair : SocialComponent->GetAffectionSnapshot()) // Copy each peer.
+			{
+				Social.AddAffection(Pair.Key, Pair.Value); // Store the affection.
+			}
+		}
+
+		const UVillageClockSubsystem* Clock = GetWorld()->GetSubsystem<UVillageClockSubsystem>(); // Resolve the clock for the current minute.
+		const int64 Now = Clock ? Clock->GetTotalMinutes() : StepContext.Minute; // Current minute.
+
+		FVillagerMassActivityFragment& Activity = EntityManager.GetFragmentDataChecked<FVillagerMassActivityFragment>(Entity); // Activity fragment of the entity.
+		Activity.Location = Actor->GetActorLocation(); // Continue from the actor's location.
+		Activity.Destination = Activity.Location; // Not travelling.
+		Activity.bTravelling = false; // Clear travel.
+		Activity.bTradePending = false; // Actor trades are not carried over.
+		Activity.TradeProvider = FMassEntityHandle(); // Clear the trade partner.
+		Activity.TradeProviderId = FGameplayTag(); // Clear the partner id.
+		Activity.ActivityIndex = INDEX_NONE; // Idle unless the actor is mid-activity.
+
+		const UVillagerActivityComponent* ActivityComponent = Actor->FindComponentByClass<UVillagerActivityComponent>(); // Activity component of the actor.
+		if (ActivityComponent && ActivityComponent->IsActivityActive()) // Actor is mid-activity.
+		{
+			const FActivityRuntimeState& Runtime = ActivityComponent->GetCurrentRuntime(); // Runtime of the actor's activity.
+			Activity.ActivityIndex = Shared->Archetype->GetCompiledArchetype().FindActivityIndex(Runtime.Definition.ActivityTag); // Resume the same activity.
+			Activity.ActivityStartMinute = Now - static_cast<int64>(Runtime.ElapsedMinutes); // Continue the curves where the actor left them.
+		}
+
+		EntityManager.GetFragmentDataChecked<FVillagerMassScheduleFragment>(Entity).NextPlanMinute = 0; // Idle villagers plan on the next step.
+		EntityManager.RemoveTagFromEntity(Entity, FVillagerMassRepresentedTag::StaticStruct()); // Simulate the entity in Mass again.
+	}
+
+	Actor->Destroy(); // Remove the actor.
+	RepresentedEntitySet.Remove(Entity); // Forget the entity.
+	RepresentedEntities.RemoveAtSwap(RepresentedIndex); // Drop the entity.
+	RepresentedActors.RemoveAtSwap(RepresentedIndex); // Drop the actor.
+}
+
+// Returns the point representation distances are measured from.
+bool UVillageMassSubsystem::GetViewLocation(FVector& OutLocation) const
+{
+	const APlayerController* PlayerController = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr; // First local player, if any.
+	if (!PlayerController || !PlayerController->PlayerCameraManager) // No camera.
+	{
+		return false; // Headless runs have no camera and represent nobody.
+	}
+
+	OutLocation = PlayerController->PlayerCameraManager->GetCameraLocation(); // Camera location.
+	return true; // View available.
+}
@@ -0,0 +1,22 @@
+// Includes the Mass villager fragments declaration.
+#include "Simulation/Mass/VillagerMassFragments.h"
+
+// Adds a delta to the affection toward a villager.
+void FVillagerMassSocialFragment::AddAffection(const FGameplayTag& PeerId, float Delta)
+{
+	for (int32 PeerIndex = 0; PeerIndex < PeerCount; ++PeerIndex) // Look for the villager.
+	{
+		if (PeerIds[PeerIndex] == PeerId) // Already tracked.
+		{
+			Affection[PeerIndex] += Delta; // Accumulate.
+			return; // Done.
+		}
+	}
+
+	if (PeerCount < MaxPeers && PeerId.IsValid()) // Track new villagers while there is room.
+	{
+		PeerIds[PeerCount] = PeerId; // Remember the villager.
+		Affection[PeerCount] = Delta; // Start from zero like the social component.
+		++PeerCount; // Grow the list.
+	}
+}
@@ -0,0 +1,500 @@
+// Includes the Mass villager processors declaration.
+#include "Simulation/Mass/VillagerMassProcessors.h"
+
+// Region: Engine includes.
+#pragma region EngineIncludes
+// Provides world access for subsystem lookups.
+#include "Engine/World.h"
+// Provides deferred commands flushed after the step.
+#include "MassCommandBuffer.h"
+// Provides fragment access outside the processors.
+#include "MassEntityManager.h"
+// Provides chunk views and the command buffer.
+#include "MassExecutionContext.h"
+#pragma endregion EngineIncludes
+
+// Region: Simulation includes.
+#pragma region SimulationIncludes
+// Provides the compiled lookup tables.
+#include "Simulation/Data/VillagerCompiledArchetype.h"
+// Provides the archetype definitions.
+#include "Simulation/Data/VillagerDataAssets.h"
+// Provides the step context and trade spots.
+#include "Simulation/Mass/VillageMassSubsystem.h"
+// Provides the villager fragments.
+#include "Simulation/Mass/VillagerMassFragments.h"
+// Provides the need urgency levels.
+#include "Simulation/Needs/VillagerNeedsComponent.h"
+#pragma endregion SimulationIncludes
+
+// Region: Local helpers.
+#pragma region LocalHelpers
+namespace
+{
+	// Trade resolved once the step's commands flush, since it touches the provider's fragments.
+	struct FVillagerMassTrade
+	{
+		// Buying villager.
+		FMassEntityHandle Buyer;
+		// Villager offering the resource.
+		FMassEntityHandle Provider;
+		// Identifier of the buyer.
+		FGameplayTag BuyerId;
+		// Identifier of the provider.
+		FGameplayTag ProviderId;
+		// Trade spot the buyer arrived at.
+		FVector TradeLocation = FVector::ZeroVector;
+		// Whether the buyer's need was critical.
+		bool bCritical = false;
+	};
+
+	// Classifies a need value like UVillagerNeedsComponent::EvaluateUrgency.
+	EVillagerNeedUrgency EvaluateUrgency(const FNeedDefinition& Definition, float Value)
+	{
+		const float Range = FMath::Max(KINDA_SMALL_NUMBER, Definition.MaxValue - Definition.MinValue); // Guard against empty ranges.
+		const float Normalized = (Value - Definition.MinValue) / Range; // Value within the need's range.
+
+		if (Normalized <= Definition.Thresholds.CriticalThreshold) // Critical band.
+		{
+			return EVillagerNeedUrgency::Critical; // Most urgent.
+		}
+
+		return Normalized <= Definition.Thresholds.MildThreshold ? EVillagerNeedUrgency::Mild : EVillagerNeedUrgency::Satisfied; // Mild or satisfied.
+	}
+
+	// Settles a trade: the seller warms to a present buyer, and a buyer finding nobody cools toward the seller.
+	void ResolveTrade(FMassEntityManager& EntityManager, const FVillagerMassTrade& Trade)
+	{
+		if (!EntityManager.IsEntityValid(Trade.Buyer)) // Buyer died this minute.
+		{
+			return; // Nobody to settle.
+		}
+
+		const FVillagerMassActivityFragment* ProviderActivity = EntityManager.IsEntityValid(Trade.Provider) ? EntityManager.GetFragmentDataPtr<FVillagerMassActivityFragment>(Trade.Provider) : nullptr; // Provider's activity while it lives.
+		const FVillagerMassArchetypeFragment* ProviderShared = EntityManager.IsEntityValid(Trade.Provider) ? EntityManager.GetConstSharedFragmentDataPtr<FVillagerMassArchetypeFragment>(Trade.Provider) : nullptr; // Provider's shared data while it lives.
+		const bool bProviderPresent = ProviderActivity && ProviderShared && ProviderShared->Archetype && !ProviderActivity->bTravelling
+			&& FVector::DistSquared(ProviderActivity->Location, Trade.TradeLocation) <= FMath::Square(ProviderShared->Archetype->MovementDefinition.AcceptanceRadius); // Provider standing at the trade spot.
+
+		if (bProviderPresent) // Trade succeeds.
+		{
+			const FSocialDefinition& Social = ProviderShared->Archetype->SocialDefinition; // Alias the provider's social definition.
+			const float Gain = Social.BuyerAffectionGainOnTrade * (Trade.bCritical ? 2.0f : 1.0f) + Social.SellerAffectionGainPerTrade; // Same stacking as ApplyTradeAffectionAdjustments.
+			if (FVillagerMassSocialFragment* ProviderSocial = EntityManager.GetFragmentDataPtr<FVillagerMassSocialFragment>(Trade.Provider)) // Provider's affection table.
+			{
+				ProviderSocial->AddAffection(Trade.BuyerId, Gain); // Provider warms to the buyer.
+			}
+			return; // Settled.
+		}
+
+		const FVillagerMassArchetypeFragment* BuyerShared = EntityManager.GetConstSharedFragmentDataPtr<FVillagerMassArchetypeFragment>(Trade.Buyer); // Buyer's shared data.
+		FVillagerMassSocialFragment* BuyerSocial = EntityManager.GetFragmentDataPtr<FVillagerMassSocialFragment>(Trade.Buyer); // Buyer's affection table.
+		if (BuyerShared && BuyerShared->Archetype && BuyerSocial) // Buyer can record the miss.
+		{
+			BuyerSocial->AddAffection(Trade.ProviderId, -BuyerShared->Archetype->SocialDefinition.AffectionLossOnMiss); // Buyer cools toward the provider.
+		}
+	}
+
+	// One villager's minute, mirroring UVillagerActivityComponent: completion, travel, interruption and planning.
+	struct FVillagerMassActivityStep
+	{
+		// Clock state of the step.
+		const FVillageMassStepContext& Step;
+		// Subsystem owning the trade spots.
+		const UVillageMassSubsystem& Simulation;
+		// Shared data of the villager's archetype.
+		const FVillagerMassArchetypeFragment& Shared;
+		// Archetype asset of the villager.
+		const UVillagerArchetypeDataAsset& Archetype;
+		// Compiled tables of the archetype.
+		const FVillagerCompiledArchetype& Compiled;
+		// Need values of the villager.
+		const FVillagerMassNeedsFragment& Needs;
+		// Activity, travel and trade state of the villager.
+		FVillagerMassActivityFragment& Activity;
+		// Decision stream and next plan minute of the villager.
+		FVillagerMassScheduleFragment& Schedule;
+		// Chunk context receiving deferred commands.
+		FMassExecutionContext& Context;
+		// Entity being stepped.
+		FMassEntityHandle Entity;
+
+		// Runs the minute.
+		void Run()
+		{
+			if (Activity.IsActive()) // Villager is busy.
+			{
+				if (!IsActivityFinished()) // Activity continues this minute.
+				{
+					AdvanceTravel(); // Arrive if the leg ends.
+					TryInterrupt(); // Urgent needs may cut in.
+					return; // Keep the activity.
+				}
+
+				Activity.ActivityIndex = INDEX_NONE; // Become idle.
+				Activity.bTravelling = false; // Stop travel.
+				Activity.bTradePending = false; // Drop the pending trade.
+				Schedule.NextPlanMinute = Step.Minute; // Completion plans the next activity right away.
+			}
+
+			if (Step.Minute < Schedule.NextPlanMinute) // Not yet time to plan.
+			{
+				return; // Stay idle.
+			}
+
+			int32 ActivityIndex = SelectNeedSatisfyingActivity(EVillagerNeedUrgency::Critical); // Critical needs, schedule, then mild needs.
+			if (ActivityIndex == INDEX_NONE) // No critical need to satisfy.
+			{
+				ActivityIndex = SelectScheduledActivity(); // Follow the schedule.
+			}
+			if (ActivityIndex == INDEX_NONE) // Nothing scheduled this hour.
+			{
+				ActivityIndex = SelectNeedSatisfyingActivity(EVillagerNeedUrgency::Mild); // Satisfy mild needs.
+			}
+
+			if (ActivityIndex != INDEX_NONE) // Found a runnable activity.
+			{
+				BeginActivity(ActivityIndex); // Start it.
+			}
+			else
+			{
+				Schedule.NextPlanMinute = Step.Minute + (60 - Step.MinuteOfHour); // Idle needs do not change, so only the next hour offers new candidates.
+			}
+		}
+
+		// Returns whether the running activity ends this minute.
+		bool IsActivityFinished() const
+		{
+			const FActivityDefinition& Definition = Archetype.ActivityDefinitions[Activity.ActivityIndex]; // Definition of the running activity.
+			if (Definition.bIsPartOfDay) // Daily activities end with their window.
+			{
+				return Step.Hour >= Definition.PartOfDayWindow.AllowedEndHour || Step.Hour < Definition.PartOfDayWindow.AllowedStartHour; // Outside the window.
+			}
+
+			return static_cast<float>(Step.Minute - Activity.ActivityStartMinute - 1) >= Definition.NonDailyDurationMinutes; // Elapsed minutes as counted by the component.
+		}
+
+		// Completes travel legs that arrive this minute.
+		void AdvanceTravel()
+		{
+			if (!Activity.bTravelling || Step.Minute < Activity.ArrivalMinute) // Not travelling or still on the way.
+			{
+				return; // Nothing to complete.
+			}
+
+			Activity.Location = Activity.Destination; // Arrive at the destination.
+			Activity.bTravelling = false; // Stop travel.
+
+			if (!Activity.bTradePending) // Arrived at the activity itself.
+			{
+				return; // Nothing else to do.
+			}
+
+			Activity.bTradePending = false; // Trade once.
+			QueueTrade(); // Settle it after the step.
+			StartTravel(Shared.ActivityLocations[Activity.ActivityIndex]); // Continue to the activity after trading.
+		}
+
+		// Defers the trade with the chosen provider to the command flush.
+		void QueueTrade()
+		{
+			FVillagerMassTrade Trade; // Trade settled after the step.
+			Trade.Buyer = Entity; // Buyer entity.
+			Trade.Provider = Activity.TradeProvider; // Chosen provider.
+			Trade.BuyerId = Archetype.VillagerIdTag; // Buyer identifier.
+			Trade.ProviderId = Activity.TradeProviderId; // Provider identifier.
+			Trade.TradeLocation = Activity.Location; // Arrival location.
+
+			const FGameplayTag& ActivityTag = Archetype.ActivityDefinitions[Activity.ActivityIndex].ActivityTag; // Tag of the running activity.
+			for (int32 NeedIndex = 0; NeedIndex < Needs.NeedCount; ++NeedIndex) // Urgency of the need the activity satisfies.
+			{
+				const FNeedDefinition& Definition = Archetype.NeedDefinitions[NeedIndex]; // Definition of this need.
+				if (Definition.SatisfyingActivityTag == ActivityTag) // Need satisfied by the activity.
+				{
+					Trade.bCritical = EvaluateUrgency(Definition, Needs.Values[NeedIndex]) == EVillagerNeedUrgency::Critical; // Critical trades give double buyer affection.
+					break; // One satisfied need per activity.
+				}
+			}
+
+			Context.Defer().PushCommand<FMassDeferredSetCommand>([Trade](FMassEntityManager& EntityManager) // Touches the provider's fragments after the parallel step.
+			{
+				ResolveTrade(EntityManager, Trade); // Settle the trade.
+			});
+		}
+
+		// Rolls whether an urgent need interrupts the running PartOfDay activity.
+		void TryInterrupt()
+		{
+			if (Activity.bTravelling || !Archetype.ActivityDefinitions[Activity.ActivityIndex].bIsPartOfDay) // Travelling or not a daily activity.
+			{
+				return; // Cannot be interrupted.
+			}
+
+			const int32 CriticalNeed = FindHighestPriorityNeed(EVillagerNeedUrgency::Critical); // Most important critical need.
+			const int32 UrgentNeed = CriticalNeed != INDEX_NONE ? CriticalNeed : FindHighestPriorityNeed(EVillagerNeedUrgency::Mild); // Fall back to mild needs.
+			if (UrgentNeed == INDEX_NONE || !ShouldForceNeedActivity(UrgentNeed)) // No urgent need or the roll failed.
+			{
+				return; // Keep the activity.
+			}
+
+			const int32 ActivityIndex = SelectSatisfierForNeed(UrgentNeed); // Satisfier of the urgent need.
+			if (ActivityIndex != INDEX_NONE) // Satisfier is runnable.
+			{
+				BeginActivity(ActivityIndex); // Switch activities.
+			}
+		}
+
+		// Returns the highest priority need at or above an urgency, or INDEX_NONE.
+		int32 FindHighestPriorityNeed(EVillagerNeedUrgency MinimumUrgency) const
+		{
+			float BestWeight = -1.0f; // Highest weight so far.
+			int32 BestIndex = INDEX_NONE; // Need with that weight.
+
+			for (int32 NeedIndex = 0; NeedIndex < Needs.NeedCount; ++NeedIndex) // Visit every need.
+			{
+				const FNeedDefinition& Definition = Archetype.NeedDefinitions[NeedIndex]; // Definition of this need.
+				if (EvaluateUrgency(Definition, Needs.Values[NeedIndex]) >= MinimumUrgency && Definition.PriorityWeight > BestWeight) // Urgent enough and more important.
+				{
+					BestWeight = Definition.PriorityWeight; // Record weight.
+					BestIndex = NeedIndex; // Record index.
+				}
+			}
+
+			return BestIndex; // Provide the best need.
+		}
+
+		// Rolls the need's force probability on the villager's stream.
+		bool ShouldForceNeedActivity(int32 NeedIndex) const
+		{
+			const FNeedDefinition& Definition = Archetype.NeedDefinitions[NeedIndex]; // Definition of this need.
+			const float Range = FMath::Max(KINDA_SMALL_NUMBER, Definition.MaxValue - Definition.MinValue); // Guard against empty ranges.
+			const float Probability = Compiled.GetForceProbability(NeedIndex, FMath::Clamp((Needs.Values[NeedIndex] - Definition.MinValue) / Range, 0.0f, 1.0f)); // Probability for the normalized value.
+
+			if (Probability <= 0.0f) // Never forced.
+			{
+				return false; // Skip the roll.
+			}
+
+			return Probability >= 1.0f || Schedule.DecisionStream.FRand() <= Probability; // Always forced or rolled.
+		}
+
+		// Selects the satisfier of the most important need at an urgency, after a force roll.
+		int32 SelectNeedSatisfyingActivity(EVillagerNeedUrgency UrgencyThreshold) const
+		{
+			const int32 NeedIndex = FindHighestPriorityNeed(UrgencyThreshold); // Most important need at the urgency.
+			if (NeedIndex == INDEX_NONE || !ShouldForceNeedActivity(NeedIndex)) // No need or the roll failed.
+			{
+				return INDEX_NONE; // Nothing to satisfy.
+			}
+
+			return SelectSatisfierForNeed(NeedIndex); // Satisfier of the need.
+		}
+
+		// Returns the runnable activity satisfying a need, or INDEX_NONE.
+		int32 SelectSatisfierForNeed(int32 NeedIndex) const
+		{
+			const int32 ActivityIndex = Compiled.FindSatisfyingActivityIndex(Archetype.NeedDefinitions[NeedIndex].NeedTag); // Activity satisfying the need.
+			return Shared.ActivityAvailable.IsValidIndex(ActivityIndex) && Shared.ActivityAvailable[ActivityIndex] ? ActivityIndex : INDEX_NONE; // Only runnable activities.
+		}
+
+		// Returns the first runnable daily activity for this hour, then any daily activity, or INDEX_NONE.
+		int32 SelectScheduledActivity() const
+		{
+			for (const TConstArrayView<int32> Candidates : { Compiled.GetActivitiesForHour(Step.Hour), TConstArrayView<int32>(Compiled.DailyActivityIndices) }) // This hour's activities, then every daily activity.
+			{
+				for (const int32 ActivityIndex : Candidates) // Visit each candidate.
+				{
+					if (Shared.ActivityAvailable[ActivityIndex]) // Location resolved.
+					{
+						return ActivityIndex; // Run it.
+					}
+				}
+			}
+
+			return INDEX_NONE; // Nothing runnable.
+		}
+
+		// Starts an activity, fetching its resource first when it needs a location and a provider exists.
+		void BeginActivity(int32 ActivityIndex)
+		{
+			const FActivityDefinition& Definition = Archetype.ActivityDefinitions[ActivityIndex]; // Definition of the new activity.
+
+			Activity.ActivityIndex = ActivityIndex; // Start the activity.
+			Activity.ActivityStartMinute = Step.Minute; // Deltas start on the next minute.
+			Activity.bTravelling = false; // Not travelling yet.
+			Activity.bTradePending = false; // No trade yet.
+			Activity.TradeProvider = FMassEntityHandle(); // Clear the trade partner.
+			Activity.TradeProviderId = FGameplayTag(); // Clear the partner id.
+
+			if (!Definition.bRequiresSpecificLocation) // Runs where the villager stands.
+			{
+				return; // No travel needed.
+			}
+
+			if (Definition.RequiredResourceTag.IsValid()) // Activity consumes a resource.
+			{
+				TArray<const FVillageMassProvider*, TInlineAllocator<16>> Candidates; // Providers other than the villager.
+				for (const FVillageMassProvider& Provider : Simulation.GetProviders(Definition.RequiredResourceTag)) // Visit each trade spot.
+				{
+					if (Provider.Entity != Entity) // Skip the villager's own spots.
+					{
+						Candidates.Add(&Provider); // Record candidate.
+					}
+				}
+
+				if (Candidates.Num() > 0) // Someone offers the resource.
+				{
+					const FVillageMassProvider& Provider = *Candidates[Schedule.DecisionStream.RandRange(0, Candidates.Num() - 1)]; // Pick a provider on the villager's stream.
+					Activity.TradeProvider = Provider.Entity; // Trade partner.
+					Activity.TradeProviderId = Provider.ProviderId; // Partner identifier.
+					Activity.bTradePending = true; // Trade on arrival.
+					StartTravel(Provider.TradeLocation); // Walk to the trade spot.
+					return; // Activity follows the trade.
+				}
+			}
+
+			StartTravel(Shared.ActivityLocations[ActivityIndex]); // Walk to the activity.
+		}
+
+		// Starts an abstract travel leg timed from distance and walk speed.
+		void StartTravel(const FVector& Destination)
+		{
+			const float CentimetersPerMinute = FMath::Max(KINDA_SMALL_NUMBER, Archetype.MovementDefinition.WalkSpeed * Step.SecondsPerGameMinute); // Walk distance per game minute.
+			const float Distance = FMath::Max(0.0f, FVector::Dist(Activity.Location, Destination) - Archetype.MovementDefinition.AcceptanceRadius); // Distance left after the acceptance radius.
+
+			Activity.Destination = Destination; // Store the destination.
+			Activity.ArrivalMinute = Step.Minute + FMath::CeilToInt64(Distance / CentimetersPerMinute); // Round up to whole minutes.
+			Activity.bTravelling = true; // Arrival is processed on the arrival minute's step.
+		}
+	};
+}
+#pragma endregion LocalHelpers
+
+// Configures the processor to run only when the village Mass subsystem executes it.
+UVillagerMassActivityProcessor::UVillagerMassActivityProcessor()
+	: EntityQuery(*this)
+{
+	bAutoRegisterWithProcessingPhases = false; // Executed by the village Mass subsystem only.
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::AllNetModes); // Run in every net mode.
+}
+
+// Declares fragment access.
+void UVillagerMassActivityProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddRequirement<FVillagerMassNeedsFragment>(EMassFragmentAccess::ReadOnly); // Needs drive selection.
+	EntityQuery.AddRequirement<FVillagerMassActivityFragment>(EMassFragmentAccess::ReadWrite); // Activity is advanced.
+	EntityQuery.AddRequirement<FVillagerMassScheduleFragment>(EMassFragmentAccess::ReadWrite); // Schedule is advanced.
+	EntityQuery.AddConstSharedRequirement<FVillagerMassArchetypeFragment>(); // Archetype data per chunk.
+	EntityQuery.AddTagRequirement<FVillagerMassRepresentedTag>(EMassFragmentPresence::None); // Represented villagers run as actors.
+}
+
+// Processes one minute for every simulated villager.
+void UVillagerMassActivityProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	const UWorld* World = EntityManager.GetWorld(); // World owning the entities.
+	const UVillageMassSubsystem* Simulation = World ? World->GetSubsystem<UVillageMassSubsystem>() : nullptr; // Subsystem owning the step context.
+	if (!Simulation) // World is shutting down.
+	{
+		return; // Skip the step.
+	}
+
+	EntityQuery.ParallelForEachEntityChunk(Context, [Simulation](FMassExecutionContext& ChunkContext) // Chunks are independent; cross-entity writes are deferred.
+	{
+		const FVillagerMassArchetypeFragment& Shared = ChunkContext.GetConstSharedFragment<FVillagerMassArchetypeFragment>(); // Shared data of the chunk.
+		if (!Shared.Archetype) // Archetype missing.
+		{
+			return; // Skip the chunk.
+		}
+
+		const FVillagerCompiledArchetype& Compiled = Shared.Archetype->GetCompiledArchetype(); // Built when the archetype was first spawned.
+		const TConstArrayView<FVillagerMassNeedsFragment> NeedsList = ChunkContext.GetFragmentView<FVillagerMassNeedsFragment>(); // Need values of the chunk.
+		const TArrayView<FVillagerMassActivityFragment> Activities = ChunkContext.GetMutableFragmentView<FVillagerMassActivityFragment>(); // Activities of the chunk.
+		const TArrayView<FVillagerMassScheduleFragment> Schedules = ChunkContext.GetMutableFragmentView<FVillagerMassScheduleFragment>(); // Schedules of the chunk.
+
+		for (int32 EntityIndex = 0; EntityIndex < ChunkContext.GetNumEntities(); ++EntityIndex) // Step each villager.
+		{
+			FVillagerMassActivityStep VillagerStep{ Simulation->GetStepContext(), *Simulation, Shared, *Shared.Archetype, Compiled, NeedsList[EntityIndex], Activities[EntityIndex], Schedules[EntityIndex], ChunkContext, ChunkContext.GetEntity(EntityIndex) }; // Per-villager state.
+			VillagerStep.Run(); // Run the minute.
+		}
+	});
+}
+
+// Configures the processor to run only when the village Mass subsystem executes it.
+UVillagerMassNeedsProcessor::UVillagerMassNeedsProcessor()
+	: EntityQuery(*this)
+{
+	bAutoRegisterWithProcessingPhases = false; // Executed by the village Mass subsystem only.
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::AllNetModes); // Run in every net mode.
+}
+
+// Declares fragment access.
+void UVillagerMassNeedsProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddRequirement<FVillagerMassNeedsFragment>(EMassFragmentAccess::ReadWrite); // Needs are integrated.
+	EntityQuery.AddRequirement<FVillagerMassActivityFragment>(EMassFragmentAccess::ReadOnly); // Activity selects the curves.
+	EntityQuery.AddConstSharedRequirement<FVillagerMassArchetypeFragment>(); // Archetype data per chunk.
+	EntityQuery.AddTagRequirement<FVillagerMassRepresentedTag>(EMassFragmentPresence::None); // Represented villagers run as actors.
+}
+
+// Integrates one minute for every simulated villager.
+void UVillagerMassNeedsProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	const UWorld* World = EntityManager.GetWorld(); // World owning the entities.
+	const UVillageMassSubsystem* Simulation = World ? World->GetSubsystem<UVillageMassSubsystem>() : nullptr; // Subsystem owning the step context.
+	if (!Simulation) // World is shutting down.
+	{
+		return; // Skip the step.
+	}
+
+	const int64 Minute = Simulation->GetStepContext().Minute; // Minute being processed.
+
+	EntityQuery.ParallelForEachEntityChunk(Context, [Minute](FMassExecutionContext& ChunkContext) // Chunks are independent.
+	{
+		const FVillagerMassArchetypeFragment& Shared = ChunkContext.GetConstSharedFragment<FVillagerMassArchetypeFragment>(); // Shared data of the chunk.
+		if (!Shared.Archetype) // Archetype missing.
+		{
+			return; // Skip the chunk.
+		}
+
+		const UVillagerArchetypeDataAsset& Archetype = *Shared.Archetype; // Alias the archetype.
+		const FVillagerCompiledArchetype& Compiled = Archetype.GetCompiledArchetype(); // Built when the archetype was first spawned.
+		const TArrayView<FVillagerMassNeedsFragment> NeedsList = ChunkContext.GetMutableFragmentView<FVillagerMassNeedsFragment>(); // Need values of the chunk.
+		const TConstArrayView<FVillagerMassActivityFragment> Activities = ChunkContext.GetFragmentView<FVillagerMassActivityFragment>(); // Activities of the chunk.
+
+		for (int32 EntityIndex = 0; EntityIndex < ChunkContext.GetNumEntities(); ++EntityIndex) // Integrate each villager.
+		{
+			const FVillagerMassActivityFragment& Activity = Activities[EntityIndex]; // Activity of the villager.
+			if (!Activity.IsActive()) // Idle villagers keep their needs.
+			{
+				continue; // Next villager.
+			}
+
+			const int64 Elapsed = Minute - Activity.ActivityStartMinute - 1; // Same elapsed minute as the needs stage.
+			const FActivityDefinition& Definition = Archetype.ActivityDefinitions[Activity.ActivityIndex]; // Definition of the running activity.
+			if (Elapsed < 0 || (!Definition.bIsPartOfDay && static_cast<float>(Elapsed) >= Definition.NonDailyDurationMinutes)) // Before the first minute or past the duration.
+			{
+				continue; // No deltas this minute.
+			}
+
+			FVillagerMassNeedsFragment& Needs = NeedsList[EntityIndex]; // Need values of the villager.
+			bool bBottomedOut = false; // Whether any need reached its minimum.
+
+			for (const FVillagerCompiledNeedCurve& NeedCurve : Compiled.GetNeedCurvesForActivity(Activity.ActivityIndex)) // One delta per curve.
+			{
+				if (NeedCurve.NeedIndex >= Needs.NeedCount) // Need beyond the fragment.
+				{
+					continue; // Past the fragment's capacity.
+				}
+
+				const FNeedDefinition& NeedDefinition = Archetype.NeedDefinitions[NeedCurve.NeedIndex]; // Definition of the target need.
+				float& Value = Needs.Values[NeedCurve.NeedIndex]; // Value being integrated.
+				Value = FMath::Clamp(Value + NeedCurve.SampleDelta(static_cast<float>(Elapsed)), NeedDefinition.MinValue, NeedDefinition.MaxValue); // Apply and clamp the delta.
+				bBottomedOut |= Value <= NeedDefinition.MinValue + KINDA_SMALL_NUMBER; // Track bottomed-out needs.
+			}
+
+			if (bBottomedOut) // A need bottomed out.
+			{
+				ChunkContext.Defer().DestroyEntity(ChunkContext.GetEntity(EntityIndex)); // The villager dies when a need bottoms out.
+			}
+		}
+	});
+}
@@ -0,0 +1,93 @@
+// Includes the move completion queue declaration.
+#include "Simulation/Movement/VillageMoveCompletionQueue.h"
+
+// Region: Engine includes.
+#pragma region EngineIncludes
+// Provides the persistent level owning the tick function.
+#include "Engine/Level.h"
+// Provides the world passed at begin play.
+#include "Engine/World.h"
+#pragma endregion EngineIncludes
+
+// Region: Simulation includes.
+#pragma region SimulationIncludes
+// Provides per-stage timing buckets.
+#include "Simulation/Core/VillageSimProfiler.h"
+// Provides the components receiving completions.
+#include "Simulation/Movement/VillagerMovementComponent.h"
+#pragma endregion SimulationIncludes
+
+// Drains the queue.
+void FVillageMoveCompletionTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target) // Queue still bound.
+	{
+		Target->Drain(); // Deliver queued records.
+	}
+}
+
+// Names the tick function in tick diagnostics.
+FString FVillageMoveCompletionTickFunction::DiagnosticMessage()
+{
+	return TEXT("UVillageMoveCompletionQueue::Drain"); // Name shown in tick diagnostics.
+}
+
+// Registers the drain tick function with the world's persistent level.
+void UVillageMoveCompletionQueue::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld); // Preserve base behavior.
+
+	DrainTickFunction.Target = this; // Queue drained by the tick.
+	DrainTickFunction.bCanEverTick = true; // Tick function is active.
+	DrainTickFunction.bStartWithTickEnabled = true; // Tick from the first frame.
+	DrainTickFunction.bRunOnAnyThread = false; // Callbacks touch actors on the game thread.
+	DrainTickFunction.TickGroup = TG_PostUpdateWork; // Drain after movement finished for the frame.
+	DrainTickFunction.RegisterTickFunction(InWorld.PersistentLevel); // Tick with the persistent level.
+}
+
+// Unregisters the tick function and drops undelivered records.
+void UVillageMoveCompletionQueue::Deinitialize()
+{
+	if (DrainTickFunction.IsTickFunctionRegistered()) // Registered at begin play.
+	{
+		DrainTickFunction.UnRegisterTickFunction(); // Stop ticking.
+	}
+	DrainTickFunction.Target = nullptr; // Unbind the queue.
+
+	Pending.Empty(); // Drop undelivered records.
+	Draining.Empty(); // Drop the swap buffer.
+
+	Super::Deinitialize(); // Preserve base cleanup.
+}
+
+// Queues the result of a component's move for delivery at the next drain.
+void UVillageMoveCompletionQueue::Push(UVillagerMovementComponent* Component, uint32 MoveSerial, bool bSuccess)
+{
+	FCompletion& Completion = Pending.AddDefaulted_GetRef(); // New record.
+	Completion.Component = Component; // Component whose move finished.
+	Completion.MoveSerial = MoveSerial; // Move the record belongs to.
+	Completion.bSuccess = bSuccess; // Outcome of the move.
+}
+
+// Delivers every record queued before the call.
+void UVillageMoveCompletionQueue::Drain()
+{
+	if (Pending.Num() == 0) // Nothing queued.
+	{
+		return; // Nothing to deliver.
+	}
+
+	VILLAGE_SIM_SCOPE(Movement); // Count delivery in the simulation benchmark.
+
+	Swap(Pending, Draining); // Callbacks may push again; those records wait for the next frame.
+
+	for (const FCompletion& Completion : Draining) // Deliver in push order.
+	{
+		if (UVillagerMovementComponent* Component = Completion.Component.Get()) // Component still exists.
+		{
+			Component->ExecuteMoveFinished(Completion.MoveSerial, Completion.bSuccess); // Run the completion on the component.
+		}
+	}
+
+	Draining.Reset(); // Keep the allocation.
+}
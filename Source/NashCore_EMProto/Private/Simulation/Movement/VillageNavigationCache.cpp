@@ -0,0 +1,245 @@
+// Includes the navigation cache declaration.
+#include "Simulation/Movement/VillageNavigationCache.h"
+
+// Region: Engine includes.
+#pragma region EngineIncludes
+// Provides world access for subsystem lookups.
+#include "Engine/World.h"
+// Provides synchronous path queries.
+#include "NavigationSystem.h"
+#pragma endregion EngineIncludes
+
+// Region: Simulation includes.
+#pragma region SimulationIncludes
+// Provides per-stage timing buckets.
+#include "Simulation/Core/VillageSimProfiler.h"
+// Provides the registered locations.
+#include "Simulation/Locations/VillageLocationRegistry.h"
+#pragma endregion SimulationIncludes
+
+// Region: Local constants.
+#pragma region LocalConstants
+namespace
+{
+	// Path queries run per frame while the matrix is rebuilt.
+	constexpr int32 RoutesPerTick = 32;
+
+	// Horizontal distance within which a point counts as standing at a registered location; covers acceptance radii.
+	constexpr float NodeSnapRadius = 200.0f;
+
+	// Vertical distance within which a point counts as standing at a registered location; covers capsule half heights.
+	constexpr float NodeSnapHeight = 200.0f;
+
+	// Horizontal distance below which the real endpoint is treated as the snapped location.
+	constexpr float EndpointTolerance = 1.0f;
+}
+#pragma endregion LocalConstants
+
+// Binds to location registry changes.
+void UVillageNavigationCache::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection); // Preserve base initialization.
+
+	if (UVillageLocationRegistry* Registry = Collection.InitializeDependency<UVillageLocationRegistry>()) // Ensure the registry exists first.
+	{
+		LocationsChangedHandle = Registry->OnLocationsChanged.AddUObject(this, &UVillageNavigationCache::HandleLocationsChanged); // Rebuild when locations change.
+	}
+}
+
+// Unbinds from the registry and drops cached routes.
+void UVillageNavigationCache::Deinitialize()
+{
+	if (UVillageLocationRegistry* Registry = GetWorld() ? GetWorld()->GetSubsystem<UVillageLocationRegistry>() : nullptr) // Resolve the registry if it still exists.
+	{
+		Registry->OnLocationsChanged.Remove(LocationsChangedHandle); // Stop receiving changes.
+	}
+
+	Nodes.Reset(); // Drop locations.
+	Routes.Reset(); // Drop routes.
+	NextRouteIndex = 0; // Nothing left to find.
+
+	Super::Deinitialize(); // Preserve base cleanup.
+}
+
+// Finds the next batch of routes while the matrix is incomplete.
+void UVillageNavigationCache::Tick(float DeltaTime)
+{
+	if (IsComplete()) // Every route found.
+	{
+		return; // Nothing to do.
+	}
+
+	UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()); // Resolve the navigation system.
+	const ANavigationData* NavData = NavSystem ? NavSystem->GetDefaultNavDataInstance(FNavigationSystem::DontCreate) : nullptr; // Default navmesh, if built.
+	if (!NavData || NavSystem->IsNavigationBuildInProgress()) // Navigation not ready.
+	{
+		return; // The registry re-projects and notifies again once the build finishes.
+	}
+
+	VILLAGE_SIM_SCOPE(Movement); // Count route finding in the simulation benchmark.
+
+	const int32 NodeCount = Nodes.Num(); // Matrix width.
+	int32 Budget = RoutesPerTick; // Path queries left this frame.
+	while (!IsComplete() && Budget > 0) // Visit routes until the budget runs out.
+	{
+		const int32 FromIndex = NextRouteIndex / NodeCount; // Row of the route.
+		const int32 ToIndex = NextRouteIndex % NodeCount; // Column of the route.
+		FRoute& Route = Routes[NextRouteIndex++]; // Route being visited.
+		if (Route.bResolved)
+		{
+			continue; // Kept from before the registry changed.
+		}
+
+		Route.bResolved = true; // Searched from now on.
+		if (FromIndex == ToIndex) // Route to itself.
+		{
+			Route.Cost = 0.0f; // Nothing to walk.
+			continue; // No query needed.
+		}
+
+		--Budget; // Spend one query.
+		const FPathFindingQuery Query(this, *NavData, Nodes[FromIndex], Nodes[ToIndex]); // Query between the two locations.
+		const FPathFindingResult Result = NavSystem->FindPathSync(Query); // Find the path now.
+
+		// Partial paths stay uncached so movement keeps its live query behaviour for them.
+		if (Result.IsSuccessful() && !Result.IsPartial() && Result.Path.IsValid() && Result.Path->GetPathPoints().Num() > 0)
+		{
+			Route.Path = Result.Path; // Cache the path.
+			Route.Cost = Result.Path->GetLength(); // Cache its length.
+		}
+		else // No complete path between the locations.
+		{
+			Route.Cost = UnreachableCost; // Keep planners from sending villagers there.
+		}
+	}
+}
+
+// Provides the stat identifier used by the tickable object manager.
+TStatId UVillageNavigationCache::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UVillageNavigationCache, STATGROUP_Tickables); // Provide the tickable stat.
+}
+
+// Returns a copy of the cached path between the locations nearest two points.
+FNavPathSharedPtr UVillageNavigationCache::FindPath(const FVector& From, const FVector& To) const
+{
+	const FRoute* Route = FindRoute(From, To); // Route between the snapped locations.
+	if (!Route || !Route->Path.IsValid()) // Unknown or unreachable.
+	{
+		return nullptr; // Movement queries the navmesh itself.
+	}
+
+	TArray<FVector> Points; // Points of the copy.
+	Points.Reserve(Route->Path->GetPathPoints().Num() + 1); // Room for the final leg.
+	for (const FNavPathPoint& PathPoint : Route->Path->GetPathPoints()) // Copy each point.
+	{
+		Points.Add(PathPoint.Location); // Keep the point's location.
+	}
+
+	const FVector Endpoint(To.X, To.Y, Points.Last().Z); // Keep the navmesh height; the destination may sit at a capsule's centre.
+	if (FVector::DistSquared2D(Endpoint, Points.Last()) > FMath::Square(EndpointTolerance)) // Snapped location is off the requested point.
+	{
+		Points.Add(Endpoint); // Walk the last leg to the requested point instead of stopping at the snapped location.
+	}
+
+	return MakeShareable(new FNavigationPath(Points)); // Fresh path owned by the caller.
+}
+
+// Returns the cached path length between the locations nearest two points, plus the final leg to To, or UnreachableCost.
+float UVillageNavigationCache::GetTravelCost(const FVector& From, const FVector& To) const
+{
+	const FRoute* Route = FindRoute(From, To); // Route between the snapped locations.
+	if (!Route || !Route->Path.IsValid()) // Unknown, unreachable or a location to itself.
+	{
+		return Route ? Route->Cost : -1.0f; // Negative while unknown.
+	}
+
+	return Route->Cost + FVector::Dist2D(Route->Path->GetEndLocation(), To); // Add the final leg.
+}
+
+// Collects the registry's locations, keeps the routes between unchanged locations and schedules the rest.
+void UVillageNavigationCache::HandleLocationsChanged(bool bNavigationRebuilt)
+{
+	TArray<FVector> OldNodes = MoveTemp(Nodes); // Previous locations.
+	TArray<FRoute> OldRoutes = MoveTemp(Routes); // Previous routes.
+
+	Nodes.Reset(); // Collect the new locations.
+	if (const UVillageLocationRegistry* Registry = GetWorld() ? GetWorld()->GetSubsystem<UVillageLocationRegistry>() : nullptr) // Resolve the registry if it still exists.
+	{
+		Registry->GetInstanceLocations(Nodes); // Projected instance locations.
+	}
+
+	const int32 NodeCount = Nodes.Num(); // Matrix width.
+	Routes.Reset(); // Drop moved-from state.
+	Routes.SetNum(NodeCount * NodeCount); // Every route unresolved.
+	NextRouteIndex = 0; // Visit from the start.
+
+	if (bNavigationRebuilt || OldNodes.Num() == 0) // Nothing worth keeping.
+	{
+		return; // Every path may cross rebuilt tiles.
+	}
+
+	TMap<FVector, int32> OldIndexByLocation; // Old index of every previous location.
+	OldIndexByLocation.Reserve(OldNodes.Num()); // One entry per location.
+	for (int32 OldIndex = 0; OldIndex < OldNodes.Num(); ++OldIndex) // Index the previous locations.
+	{
+		OldIndexByLocation.Add(OldNodes[OldIndex], OldIndex); // Record the index.
+	}
+
+	TArray<int32> OldIndices; // Old index of every new location.
+	OldIndices.SetNumUninitialized(NodeCount); // One entry per location.
+	for (int32 NodeIndex = 0; NodeIndex < NodeCount; ++NodeIndex) // Match each new location.
+	{
+		const int32* OldIndex = OldIndexByLocation.Find(Nodes[NodeIndex]); // Same location before the change.
+		OldIndices[NodeIndex] = OldIndex ? *OldIndex : INDEX_NONE; // Added or moved locations get their row and column searched.
+	}
+
+	for (int32 FromIndex = 0; FromIndex < NodeCount; ++FromIndex) // Visit rows of unchanged locations.
+	{
+		if (OldIndices[FromIndex] == INDEX_NONE) // Added or moved.
+		{
+			continue; // Row is searched again.
+		}
+
+		for (int32 ToIndex = 0; ToIndex < NodeCount; ++ToIndex) // Visit columns.
+		{
+			if (OldIndices[ToIndex] != INDEX_NONE) // Both ends unchanged.
+			{
+				Routes[FromIndex * NodeCount + ToIndex] = MoveTemp(OldRoutes[OldIndices[FromIndex] * OldNodes.Num() + OldIndices[ToIndex]]); // Unresolved routes stay scheduled.
+			}
+		}
+	}
+}
+
+// Returns the registered location within snapping distance of a point.
+int32 UVillageNavigationCache::FindNode(const FVector& Position) const
+{
+	int32 BestIndex = INDEX_NONE; // No location found yet.
+	float BestDistanceSquared = FMath::Square(NodeSnapRadius); // Only points within the snap radius count.
+
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex) // Visit every location.
+	{
+		const FVector& Node = Nodes[NodeIndex]; // Location being tested.
+		const float DistanceSquared = FVector::DistSquared2D(Node, Position); // Horizontal distance.
+		if (DistanceSquared <= BestDistanceSquared && FMath::Abs(Node.Z - Position.Z) <= NodeSnapHeight) // Closer and at a similar height.
+		{
+			BestIndex = NodeIndex; // Record index.
+			BestDistanceSquared = DistanceSquared; // Record distance.
+		}
+	}
+
+	return BestIndex; // Provide the nearest location.
+}
+
+// Returns the cached route between two points.
+const UVillageNavigationCache::FRoute* UVillageNavigationCache::FindRoute(const FVector& From, const FVector& To) const
+{
+	const int32 FromIndex = FindNode(From); // Location nearest the start.
+	const int32 ToIndex = FromIndex != INDEX_NONE ? FindNode(To) : INDEX_NONE; // Location nearest the end.
+	if (ToIndex == INDEX_NONE) // Either point is off the location set.
+	{
+		return nullptr; // No route.
+	}
+
+	return &Routes[FromIndex * Nodes.Num() + ToIndex]; // Route of the pair.
+}
@@ -0,0 +1,151 @@
+// Includes the path request queue declaration.
+#include "Simulation/Movement/VillagePathRequestQueue.h"
+
+// Region: Engine includes.
+#pragma region EngineIncludes
+// Provides world access.
+#include "Engine/World.h"
+// Provides the nav agent location and properties.
+#include "GameFramework/Pawn.h"
+// Provides asynchronous path queries.
+#include "NavigationSystem.h"
+#pragma endregion EngineIncludes
+
+// Region: Simulation includes.
+#pragma region SimulationIncludes
+// Provides per-stage timing buckets.
+#include "Simulation/Core/VillageSimProfiler.h"
+// Provides the components receiving paths.
+#include "Simulation/Movement/VillagerMovementComponent.h"
+#pragma endregion SimulationIncludes
+
+// Region: Local constants.
+#pragma region LocalConstants
+namespace
+{
+	// Queries handed to the navigation system per frame.
+	constexpr int32 MaxDispatchPerTick = 16;
+}
+#pragma endregion LocalConstants
+
+// Aborts in-flight queries and drops queued requests.
+void UVillagePathRequestQueue::Deinitialize()
+{
+	if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld())) // Resolve the navigation system if it still exists.
+	{
+		for (const TPair<uint32, FPendingRequest>& Pair : InFlight) // Visit every in-flight query.
+		{
+			NavSystem->AbortAsyncFindPathRequest(Pair.Key); // Abort the query.
+		}
+	}
+
+	Queued.Reset(); // Drop queued requests.
+	InFlight.Reset(); // Drop in-flight requests.
+
+	Super::Deinitialize(); // Preserve base cleanup.
+}
+
+// Dispatches queued requests up to the per-frame budget.
+void UVillagePathRequestQueue::Tick(float DeltaTime)
+{
+	if (Queued.Num() == 0) // Nothing queued.
+	{
+		return; // Nothing to dispatch.
+	}
+
+	VILLAGE_SIM_SCOPE(Movement); // Count dispatch in the simulation benchmark.
+
+	UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()); // Resolve the navigation system.
+	const ANavigationData* NavData = NavSystem ? NavSystem->GetDefaultNavDataInstance(FNavigationSystem::DontCreate) : nullptr; // Default navmesh, if built.
+
+	int32 Dispatched = 0; // Requests handled this frame.
+	for (; Dispatched < Queued.Num() && Dispatched < MaxDispatchPerTick; ++Dispatched) // Dispatch in request order.
+	{
+		const FPendingRequest& Request = Queued[Dispatched]; // Oldest undispatched request.
+		UVillagerMovementComponent* Requester = Request.Requester.Get(); // Component waiting for the path.
+		const APawn* Pawn = Requester ? Cast<APawn>(Requester->GetOwner()) : nullptr; // Pawn moving along the path.
+		if (!Pawn) // Requester gone.
+		{
+			continue; // Villager destroyed while queued.
+		}
+
+		if (!NavData) // No navmesh.
+		{
+			Requester->HandlePathResolved(Request.RequestId, nullptr); // Same failure as a MoveTo without nav data.
+			continue; // Next request.
+		}
+
+		const FPathFindingQuery Query(Requester, *NavData, Pawn->GetNavAgentLocation(), Request.TargetLocation); // Query from the pawn's current location.
+		const uint32 QueryId = NavSystem->FindPathAsync(Pawn->GetNavAgentPropertiesRef(), Query, FNavPathQueryDelegate::CreateUObject(this, &UVillagePathRequestQueue::HandlePathFound)); // Hand the query to the navigation system.
+		if (QueryId == INVALID_NAVQUERYID) // Query rejected.
+		{
+			Requester->HandlePathResolved(Request.RequestId, nullptr); // Report the failure.
+			continue; // Next request.
+		}
+
+		InFlight.Add(QueryId, Request); // Await the result.
+	}
+
+	Queued.RemoveAt(0, Dispatched, EAllowShrinking::No); // Drop the handled requests.
+}
+
+// Provides the stat identifier used by the tickable object manager.
+TStatId UVillagePathRequestQueue::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UVillagePathRequestQueue, STATGROUP_Tickables); // Provide the tickable stat.
+}
+
+// Queues a path from the requester's location at dispatch time to a target.
+uint32 UVillagePathRequestQueue::RequestPath(UVillagerMovementComponent* Requester, const FVector& TargetLocation)
+{
+	FPendingRequest& Request = Queued.AddDefaulted_GetRef(); // New queued request.
+	Request.Requester = Requester; // Component waiting for the path.
+	Request.TargetLocation = TargetLocation; // Requested destination.
+	Request.RequestId = NextRequestId++; // Identifier returned to the requester.
+
+	if (NextRequestId == 0) // Counter wrapped.
+	{
+		NextRequestId = 1; // Zero means no request.
+	}
+
+	return Request.RequestId; // Provide the identifier.
+}
+
+// Drops a queued or in-flight request without notifying its requester.
+void UVillagePathRequestQueue::CancelRequest(uint32 RequestId)
+{
+	const int32 QueuedIndex = Queued.IndexOfByPredicate([RequestId](const FPendingRequest& Request) { return Request.RequestId == RequestId; }); // Position in the queue.
+	if (QueuedIndex != INDEX_NONE) // Not dispatched yet.
+	{
+		Queued.RemoveAt(QueuedIndex); // Drop it.
+		return; // Done.
+	}
+
+	for (auto It = InFlight.CreateIterator(); It; ++It) // Look among in-flight queries.
+	{
+		if (It->Value.RequestId == RequestId) // Found the request.
+		{
+			if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld())) // Resolve the navigation system.
+			{
+				NavSystem->AbortAsyncFindPathRequest(It->Key); // Abort the query.
+			}
+			It.RemoveCurrent(); // Forget the request.
+			return; // Done.
+		}
+	}
+}
+
+// Receives an asynchronous query result on the game thread.
+void UVillagePathRequestQueue::HandlePathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+{
+	FPendingRequest Request; // Request answered by the query.
+	if (!InFlight.RemoveAndCopyValue(QueryId, Request)) // Forget the query.
+	{
+		return; // Cancelled after dispatch.
+	}
+
+	if (UVillagerMovementComponent* Requester = Request.Requester.Get()) // Requester still exists.
+	{
+		Requester->HandlePathResolved(Request.RequestId, Result == ENavigationQueryResult::Success ? Path : nullptr); // Hand over the path; failures arrive as null.
+	}
+}
@@ -7,17 +7,34 @@
 #include "GameFramework/Character.h"
 // Exposes character movement component for speed and acceleration settings.
 #include "GameFramework/CharacterMovementComponent.h"
+// Provides the lightweight pawn movement tuned alongside character movement.
+#include "Simulation/Movement/VillagerPathMovementComponent.h"
 // Supplies path following result structures for move completion callbacks.
 #include "Navigation/PathFollowingComponent.h"
+// Provides the camera used by the travel LOD policy.
+#include "Camera/PlayerCameraManager.h"
+// Provides the local player controller owning the camera.
+#include "GameFramework/PlayerController.h"
+// Provides timers completing abstract moves.
+#include "TimerManager.h"
 // Provides pathfinding request helpers.
 #include "NavigationSystem.h"
-// Enables dispatching callbacks on the game thread without deep recursion.
-#include "Async/Async.h"
+// Supplies benchmark timing scopes.
+#include "Simulation/Core/VillageSimProfiler.h"
+// Supplies precomputed paths between registered locations.
+#include "Simulation/Movement/VillageNavigationCache.h"
+// Supplies frame-batched asynchronous pathfinding.
+#include "Simulation/Movement/VillagePathRequestQueue.h"
+// Supplies frame-coalesced delivery of move results.
+#include "Simulation/Movement/VillageMoveCompletionQueue.h"
 #pragma endregion EngineIncludes
 
 // Local log category for movement diagnostics.
 DEFINE_LOG_CATEGORY_STATIC(LogVillagerMovement, Log, All);
 
+// Abstract travel is on by default.
+bool UVillagerMovementComponent::bAbstractTravelEnabled = true;
+
 // Constructor setting default component properties.
 UVillagerMovementComponent::UVillagerMovementComponent()
 	: PendingDelegate() // Initialize delegate.
@@ -39,7 +56,10 @@ void UVillagerMovementComponent::BeginPlay()
 // Requests navigation to a specific transform.
 void UVillagerMovementComponent::RequestMoveToLocation(const FTransform& TargetTransform, float AcceptanceRadiusOverride, FOnVillagerMovementFinished CompletionDelegate)
 {
+	VILLAGE_SIM_SCOPE(Movement); // Count navigation requests in the simulation benchmark.
+
 	PendingDelegate = CompletionDelegate; // Store delegate for later execution.
+	++MoveSerial; // Results of earlier moves still queued become stale.
 
 	AAIController* Controller = ResolveAIController(); // Fetch controller.
 
@@ -59,33 +79,46 @@ void UVillagerMovementComponent::RequestMoveToLocation(const FTransform& TargetT
 	}
 
 	ClearMoveDelegate(); // Ensure previous bindings are cleared.
+	CancelAbstractTravel(); // A new request replaces a pending abstract move.
+	CancelPathRequest(); // A new request replaces a path still being searched.
 
-	const float UseAcceptance = AcceptanceRadiusOverride > 0.0f ? AcceptanceRadiusOverride : MovementDefinition.AcceptanceRadius; // Choose radius.
-
-	FAIMoveRequest MoveRequest(TargetTransform.GetLocation()); // Build move request from transform.
-	MoveRequest.SetAcceptanceRadius(UseAcceptance); // Apply radius.
-	MoveRequest.SetUsePathfinding(true); // Enable pathfinding.
-
-	FNavPathSharedPtr OutPath; // Placeholder for generated path.
-	const FPathFollowingRequestResult RequestResult = Controller->MoveTo(MoveRequest, &OutPath); // Issue move request.
+	PendingTargetLocation = TargetTransform.GetLocation(); // Remember the target until the path arrives.
+	PendingAcceptanceRadius = AcceptanceRadiusOverride > 0.0f ? AcceptanceRadiusOverride : MovementDefinition.AcceptanceRadius; // Choose radius.
+	bPendingAbstractTravel = ShouldTravelAbstractly(); // Nobody sees the walk, so only its duration matters.
 
-	if (RequestResult.Code == EPathFollowingRequestResult::AlreadyAtGoal) // Handle immediate success when already at destination.
+	if (FVector::Dist2D(GetOwner()->GetActorLocation(), PendingTargetLocation) <= PendingAcceptanceRadius) // Matches MoveTo's already-at-goal shortcut.
 	{
+		Controller->StopMovement(); // Drop any path still being followed; our binding was cleared above.
 		DispatchMoveFinished(true); // Immediately signal success to caller.
 		return; // Skip binding because nothing will move.
 	}
 
-	if (RequestResult.Code == EPathFollowingRequestResult::RequestSuccessful) // Validate success.
+	if (bPendingAbstractTravel) // The villager stands still until the abstract move arrives.
 	{
-		ActiveRequestId = RequestResult.MoveId; // Cache request id.
-		Controller->ReceiveMoveCompleted.AddDynamic(this, &UVillagerMovementComponent::HandleMoveCompleted); // Bind completion delegate.
+		Controller->StopMovement(); // Drop any path still being followed; our binding was cleared above.
 	}
-	else // Handle failure cases.
+
+	if (FNavPathSharedPtr CachedPath = FindCachedPath(PendingTargetLocation)) // Follow the precomputed route instead of querying the navmesh.
 	{
-		ActiveRequestId = FAIRequestID::InvalidRequest; // Reset invalid request id on failure.
-		UE_LOG(LogVillagerMovement, Warning, TEXT("Move request failed for %s with result %s"), *GetNameSafe(GetOwner()), *UEnum::GetValueAsString(RequestResult.Code));
-		DispatchMoveFinished(false); // Defer failure notification to avoid recursion.
+		StartResolvedMove(CachedPath); // Start immediately.
+		return; // Completion arrives from the controller or the timer.
+	}
+
+	UVillagePathRequestQueue* PathQueue = GetWorld()->GetSubsystem<UVillagePathRequestQueue>(); // Frame-batched async pathfinding.
+	if (!PathQueue) // Validate queue availability.
+	{
+		UE_LOG(LogVillagerMovement, Warning, TEXT("Cannot request move: path request queue unavailable for %s"), *GetNameSafe(GetOwner()));
+		DispatchMoveFinished(false); // Fail fast when the queue is missing.
+		return; // Abort request.
+	}
+
+	if (!bPendingAbstractTravel) // Abstract moves already stopped above.
+	{
+		Controller->StopMovement(); // Stand still while the path is searched instead of finishing the previous walk.
 	}
+	ActiveRequestId = FAIRequestID::InvalidRequest; // The previous walk no longer belongs to this villager's requests.
+
+	PendingPathRequestId = PathQueue->RequestPath(this, PendingTargetLocation); // Path arrives through HandlePathResolved.
 }
 
 // Returns the configured acceptance radius.
@@ -109,11 +142,37 @@ void UVillagerMovementComponent::ApplyMovementDefinition(const FMovementDefiniti
 			CharacterMovement->RotationRate = FRotator(0.f, 540.f, 0.f); // Smooth turning speed.
 		}
 	}
+	else if (UVillagerPathMovementComponent* PathMovement = GetOwner() ? GetOwner()->FindComponentByClass<UVillagerPathMovementComponent>() : nullptr) // Lightweight pawn owner.
+	{
+		PathMovement->SetMaxSpeed(MovementDefinition.WalkSpeed); // Apply speed; the path movement has no acceleration phase.
+		PathMovement->SetRotationRate(540.f); // Same turning speed as characters.
+	}
+}
+
+// Returns whether the current move is simulated abstractly.
+bool UVillagerMovementComponent::IsTravellingAbstractly() const
+{
+	const UWorld* World = GetWorld(); // Timers live on the world.
+	return World && World->GetTimerManager().IsTimerActive(AbstractTravelHandle); // Pending abstract arrival.
+}
+
+// Enables or disables abstract travel for every villager.
+void UVillagerMovementComponent::SetAbstractTravelEnabled(bool bInEnabled)
+{
+	bAbstractTravelEnabled = bInEnabled; // Store the global switch.
+}
+
+// Returns whether abstract travel is globally enabled.
+bool UVillagerMovementComponent::IsAbstractTravelEnabled()
+{
+	return bAbstractTravelEnabled; // Provide the global switch.
 }
 
 // Handles move completion from the AI controller.
 void UVillagerMovementComponent::HandleMoveCompleted(FAIRequestID RequestId, EPathFollowingResult::Type Result)
 {
+	VILLAGE_SIM_SCOPE(Movement); // Count navigation requests in the simulation benchmark.
+
 	if (RequestId != ActiveRequestId) // Ignore unrelated requests.
 	{
 		return; // Early exit for mismatched ids.
@@ -157,7 +216,7 @@ AAIController* UVillagerMovementComponent::ResolveAIController()
 	return CachedAIController; // Return controller (may be null).
 }
 
-// Dispatches the pending delegate on the game thread while preventing re-entrancy.
+// Queues the move result for the village's once-per-frame delivery, preventing re-entrancy.
 void UVillagerMovementComponent::DispatchMoveFinished(bool bSuccess)
 {
 	if (!PendingDelegate.IsBound()) // Nothing to execute.
@@ -165,14 +224,166 @@ void UVillagerMovementComponent::DispatchMoveFinished(bool bSuccess)
 		return;
 	}
 
-	const FOnVillagerMovementFinished DelegateCopy = PendingDelegate; // Copy to local to avoid invalidation.
+	if (UVillageMoveCompletionQueue* CompletionQueue = GetWorld() ? GetWorld()->GetSubsystem<UVillageMoveCompletionQueue>() : nullptr) // Resolve queue.
+	{
+		CompletionQueue->Push(this, MoveSerial, bSuccess); // Delivered in TG_PostUpdateWork.
+	}
+}
+
+// Executes the pending delegate for a queued move result.
+void UVillagerMovementComponent::ExecuteMoveFinished(uint32 InMoveSerial, bool bSuccess)
+{
+	if (InMoveSerial != MoveSerial || !PendingDelegate.IsBound()) // Superseded by a newer request or already delivered.
+	{
+		return;
+	}
+
+	const FOnVillagerMovementFinished DelegateCopy = PendingDelegate; // Copy to local so the callback may issue a new move.
 	PendingDelegate.Unbind(); // Clear stored delegate to prevent duplicate calls.
+	DelegateCopy.Execute(bSuccess); // Notify caller of move result.
+}
 
-	AsyncTask(ENamedThreads::GameThread, [DelegateCopy, bSuccess]() mutable // Defer to next tick to avoid recursive call chains.
+// Returns whether nobody can see the villager walk.
+bool UVillagerMovementComponent::ShouldTravelAbstractly() const
+{
+	const AActor* Owner = GetOwner(); // Villager being moved.
+	if (!bAbstractTravelEnabled || !bAllowAbstractTravel || !Owner) // LOD disabled.
 	{
-		if (DelegateCopy.IsBound())
-		{
-			DelegateCopy.Execute(bSuccess); // Notify caller of move result.
-		}
-	});
+		return false; // Walk normally.
+	}
+
+	if (!Owner->WasRecentlyRendered(OffScreenTolerance)) // Outside the frustum, occluded, or rendering is off.
+	{
+		return true; // Off-screen villagers travel abstractly.
+	}
+
+	const APlayerController* PlayerController = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr; // Local viewer.
+	if (!PlayerController || !PlayerController->PlayerCameraManager) // No camera to measure from.
+	{
+		return true; // Nobody is watching.
+	}
+
+	return FVector::DistSquared(PlayerController->PlayerCameraManager->GetCameraLocation(), Owner->GetActorLocation()) > FMath::Square(AbstractTravelDistance); // Too far to notice.
+}
+
+// Times the move from the path length and walk speed.
+void UVillagerMovementComponent::StartAbstractTravel(const FNavPathSharedPtr& Path)
+{
+	UWorld* World = GetWorld(); // Timers live on the world.
+	const FVector StartLocation = GetOwner()->GetActorLocation(); // Current actor location.
+
+	const FVector PathStart = Path->GetPathPoints()[0].Location; // Navmesh-projected start.
+	const FVector PathEnd = Path->GetEndLocation(); // Navmesh-projected end, partial paths included.
+	AbstractTravelDestination = PathEnd + FVector(0.0f, 0.0f, StartLocation.Z - PathStart.Z); // Keep the actor's height above the navmesh.
+
+	const float TravelDistance = FMath::Max(0.0f, Path->GetLength() - PendingAcceptanceRadius); // Walking stops at the acceptance radius.
+	const float TravelSeconds = TravelDistance / FMath::Max(KINDA_SMALL_NUMBER, MovementDefinition.WalkSpeed); // Same speed as the character.
+
+	World->GetTimerManager().SetTimer(AbstractTravelHandle, this, &UVillagerMovementComponent::HandleAbstractTravelArrived, FMath::Max(KINDA_SMALL_NUMBER, TravelSeconds), false); // Arrive after the walk would have taken.
+}
+
+// Starts walking or abstract travel along a resolved path.
+void UVillagerMovementComponent::StartResolvedMove(const FNavPathSharedPtr& Path)
+{
+	if (!Path.IsValid() || Path->GetPathPoints().Num() == 0) // Unreachable target.
+	{
+		UE_LOG(LogVillagerMovement, Warning, TEXT("Move request failed for %s: no path"), *GetNameSafe(GetOwner()));
+		DispatchMoveFinished(false); // Defer failure notification to avoid recursion.
+		return; // Abort request.
+	}
+
+	if (bPendingAbstractTravel) // Nobody sees the walk.
+	{
+		StartAbstractTravel(Path); // Completion arrives from the timer.
+		return; // Skip path following.
+	}
+
+	AAIController* Controller = ResolveAIController(); // Fetch controller.
+	if (!Controller) // Controller lost while the path was searched.
+	{
+		DispatchMoveFinished(false); // Fail like a rejected move.
+		return; // Abort request.
+	}
+
+	FAIMoveRequest MoveRequest(PendingTargetLocation); // Build move request from the target.
+	MoveRequest.SetAcceptanceRadius(PendingAcceptanceRadius); // Apply radius.
+	MoveRequest.SetUsePathfinding(true); // Navigation move, so path following accepts the resolved path.
+	Path->EnableRecalculationOnInvalidation(true); // Repath like MoveTo when the navmesh invalidates the path; cached copies are refreshed by the navigation cache's rebuild instead.
+
+	ActiveRequestId = Controller->RequestMove(MoveRequest, Path); // Start path following on the resolved path.
+	if (ActiveRequestId.IsValid()) // Path following accepted the path.
+	{
+		Controller->ReceiveMoveCompleted.AddDynamic(this, &UVillagerMovementComponent::HandleMoveCompleted); // Bind completion delegate.
+	}
+	else // Handle failure cases.
+	{
+		ActiveRequestId = FAIRequestID::InvalidRequest; // Reset invalid request id on failure.
+		UE_LOG(LogVillagerMovement, Warning, TEXT("Move request rejected by path following for %s"), *GetNameSafe(GetOwner()));
+		DispatchMoveFinished(false); // Defer failure notification to avoid recursion.
+	}
+}
+
+// Receives the path found for a queued request.
+void UVillagerMovementComponent::HandlePathResolved(uint32 RequestId, FNavPathSharedPtr Path)
+{
+	VILLAGE_SIM_SCOPE(Movement); // Count navigation requests in the simulation benchmark.
+
+	if (RequestId != PendingPathRequestId) // Ignore superseded requests.
+	{
+		return; // Early exit for mismatched ids.
+	}
+
+	PendingPathRequestId = 0; // Request answered.
+	StartResolvedMove(Path); // Walk or travel abstractly.
+}
+
+// Drops a path request still waiting in the queue.
+void UVillagerMovementComponent::CancelPathRequest()
+{
+	if (PendingPathRequestId == 0) // Nothing pending.
+	{
+		return;
+	}
+
+	if (UVillagePathRequestQueue* PathQueue = GetWorld() ? GetWorld()->GetSubsystem<UVillagePathRequestQueue>() : nullptr) // Resolve queue.
+	{
+		PathQueue->CancelRequest(PendingPathRequestId); // Stop the search.
+	}
+
+	PendingPathRequestId = 0; // Forget the request.
+}
+
+// Places the villager at the destination and reports success.
+void UVillagerMovementComponent::HandleAbstractTravelArrived()
+{
+	VILLAGE_SIM_SCOPE(Movement); // Count navigation requests in the simulation benchmark.
+
+	if (AActor* Owner = GetOwner()) // Validate owner.
+	{
+		Owner->SetActorLocation(AbstractTravelDestination, false, nullptr, ETeleportType::TeleportPhysics); // Teleport to the arrival point.
+	}
+
+	DispatchMoveFinished(true); // Same completion path as a walked move.
+}
+
+// Stops a pending abstract move without notifying.
+void UVillagerMovementComponent::CancelAbstractTravel()
+{
+	if (UWorld* World = GetWorld()) // Timers live on the world.
+	{
+		World->GetTimerManager().ClearTimer(AbstractTravelHandle); // Drop the pending arrival.
+	}
+}
+
+// Returns the village navigation cache's path from the villager to a target.
+FNavPathSharedPtr UVillagerMovementComponent::FindCachedPath(const FVector& TargetLocation) const
+{
+	const UWorld* World = GetWorld(); // Cache lives on the world.
+	const UVillageNavigationCache* NavigationCache = World ? World->GetSubsystem<UVillageNavigationCache>() : nullptr; // Resolve the cache.
+	if (!NavigationCache || !GetOwner()) // Nothing to look up.
+	{
+		return nullptr; // Caller queries the navmesh instead.
+	}
+
+	return NavigationCache->FindPath(GetOwner()->GetActorLocation(), TargetLocation); // Copy of the cached route, if any.
 }
@@ -0,0 +1,95 @@
+// Includes the path movement component declaration.
+#include "Simulation/Movement/VillagerPathMovementComponent.h"
+
+// Region: Engine includes.
+#pragma region EngineIncludes
+// Provides navmesh projection.
+#include "NavigationSystem.h"
+#pragma endregion EngineIncludes
+
+// Constructor configuring a walking nav agent.
+UVillagerPathMovementComponent::UVillagerPathMovementComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true; // Ticks only while moving; see TickComponent.
+	bUpdateOnlyIfRendered = false; // Off-screen villagers still walk.
+	NavAgentProps.bCanWalk = true; // Walk along navmesh paths.
+	NavAgentProps.bCanJump = false; // No jumping or falling support.
+	NavAgentProps.bCanFly = false; // Ground-bound.
+}
+
+// Moves the updated component along the requested velocity.
+void UVillagerPathMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction); // Preserve base behavior.
+
+	if (ShouldSkipUpdate(DeltaTime) || !UpdatedComponent) // Nothing to move.
+	{
+		return;
+	}
+
+	Velocity = Velocity.GetClampedToMaxSize(MaxSpeed); // Never exceed the walk speed.
+	if (Velocity.IsNearlyZero()) // Path following stopped the pawn.
+	{
+		Velocity = FVector::ZeroVector; // Settle.
+		SetComponentTickEnabled(false); // Sleep until the next path following request.
+		return;
+	}
+
+	FVector NewLocation = UpdatedComponent->GetComponentLocation() + Velocity * DeltaTime; // Integrate without sweeping.
+
+	ProjectionCountdown -= DeltaTime; // Advance re-projection timer.
+	if (ProjectionCountdown <= 0.0f) // Time to correct drift from the navmesh.
+	{
+		ProjectionCountdown = ProjectionInterval; // Restart timer.
+		ProjectToNavigation(NewLocation); // Keep the pawn's feet on the navmesh.
+	}
+
+	FRotator NewRotation = UpdatedComponent->GetComponentRotation(); // Current facing.
+	NewRotation.Yaw = FMath::FixedTurn(NewRotation.Yaw, Velocity.Rotation().Yaw, RotationRate * DeltaTime); // Face direction of travel.
+
+	UpdatedComponent->SetWorldLocationAndRotation(NewLocation, NewRotation, false, nullptr, ETeleportType::None); // Apply move without collision.
+	UpdateComponentVelocity(); // Publish velocity for animation and avoidance queries.
+}
+
+// Stores the path following velocity and resumes ticking.
+void UVillagerPathMovementComponent::RequestDirectMove(const FVector& MoveVelocity, bool bForceMaxSpeed)
+{
+	Super::RequestDirectMove(MoveVelocity, bForceMaxSpeed); // Stores the velocity.
+
+	if (bForceMaxSpeed) // Path following asks for full speed.
+	{
+		Velocity = Velocity.GetSafeNormal() * MaxSpeed; // Keep direction, use walk speed.
+	}
+
+	if (!Velocity.IsNearlyZero() && !IsComponentTickEnabled()) // Woken by a new move.
+	{
+		ProjectionCountdown = 0.0f; // Re-project on the first step.
+		SetComponentTickEnabled(true); // Resume moving.
+	}
+}
+
+// Applies the walk speed.
+void UVillagerPathMovementComponent::SetMaxSpeed(float InMaxSpeed)
+{
+	MaxSpeed = FMath::Max(0.0f, InMaxSpeed); // Store clamped speed.
+}
+
+// Applies the yaw turn rate.
+void UVillagerPathMovementComponent::SetRotationRate(float InRotationRate)
+{
+	RotationRate = FMath::Max(0.0f, InRotationRate); // Store clamped rate.
+}
+
+// Snaps a location onto the navmesh.
+bool UVillagerPathMovementComponent::ProjectToNavigation(FVector& InOutLocation) const
+{
+	const UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()); // Access nav system.
+	FNavLocation NavLocation; // Projected point.
+	if (!NavSystem || !NavSystem->ProjectPointToNavigation(InOutLocation, NavLocation, ProjectionExtent)) // No navmesh nearby.
+	{
+		return false; // Keep the integrated location.
+	}
+
+	InOutLocation = NavLocation.Location; // Snap onto the navmesh.
+	return true; // Projected.
+}
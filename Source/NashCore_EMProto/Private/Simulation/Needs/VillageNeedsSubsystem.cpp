@@ -0,0 +1,238 @@
+// Includes the needs stage declaration.
+#include "Simulation/Needs/VillageNeedsSubsystem.h"
+
+// Region: Engine includes.
+#pragma region EngineIncludes
+// Provides the parallel row kernel.
+#include "Async/ParallelFor.h"
+// Provides world access for subsystem lookups.
+#include "Engine/World.h"
+#pragma endregion EngineIncludes
+
+// Region: Simulation includes.
+#pragma region SimulationIncludes
+// Provides the villagers feeding the stage.
+#include "Simulation/Activities/VillagerActivityComponent.h"
+// Provides per-stage timing buckets.
+#include "Simulation/Core/VillageSimProfiler.h"
+// Provides the needs components receiving results.
+#include "Simulation/Needs/VillagerNeedsComponent.h"
+// Provides the per-minute hook driving the stage.
+#include "Simulation/Time/VillageClockSubsystem.h"
+#pragma endregion SimulationIncludes
+
+// Region: Local constants.
+#pragma region LocalConstants
+namespace
+{
+	// Rows handed to each parallel task; small populations run inline.
+	constexpr int32 KernelBatchSize = 1024;
+
+	// Row flag set when the urgency band changed.
+	constexpr uint8 RowBandCrossed = 1 << 0;
+
+	// Row flag set when the value reached the minimum.
+	constexpr uint8 RowBottomedOut = 1 << 1;
+
+	// Classifies a normalized value exactly like UVillagerNeedsComponent::EvaluateUrgency.
+	FORCEINLINE uint8 ClassifyBand(float Normalized, float Mild, float Critical)
+	{
+		return Normalized <= Critical ? 2 : (Normalized <= Mild ? 1 : 0); // Critical, mild or satisfied.
+	}
+}
+#pragma endregion LocalConstants
+
+// Binds to the clock's per-minute hook.
+void UVillageNeedsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection); // Preserve base initialization.
+
+	if (UVillageClockSubsystem* Clock = Collection.InitializeDependency<UVillageClockSubsystem>()) // Ensure the clock exists first.
+	{
+		MinuteProcessedHandle = Clock->OnMinuteProcessed.AddUObject(this, &UVillageNeedsSubsystem::ProcessMinute); // Run after each minute's wakeups.
+	}
+}
+
+// Unbinds from the clock and drops registrations.
+void UVillageNeedsSubsystem::Deinitialize()
+{
+	if (UVillageClockSubsystem* Clock = GetWorld() ? GetWorld()->GetSubsystem<UVillageClockSubsystem>() : nullptr) // Resolve the clock if it still exists.
+	{
+		Clock->OnMinuteProcessed.Remove(MinuteProcessedHandle); // Stop receiving minutes.
+	}
+
+	Villagers.Reset(); // Drop registrations.
+	VillagerSlots.Reset(); // Drop slot lookups.
+	StepVillagers.Reset(); // Drop step data.
+	StepNeeds.Reset(); // Drop step needs.
+
+	Super::Deinitialize(); // Preserve base cleanup.
+}
+
+// Adds a villager to the stage.
+void UVillageNeedsSubsystem::RegisterVillager(UVillagerActivityComponent* ActivityComponent)
+{
+	if (!ActivityComponent || VillagerSlots.Contains(ActivityComponent)) // Skip null and duplicate registrations.
+	{
+		return; // Nothing to add.
+	}
+
+	VillagerSlots.Add(ActivityComponent, Villagers.Add(ActivityComponent)); // Remember the slot for swap removal.
+}
+
+// Removes a villager from the stage.
+void UVillageNeedsSubsystem::UnregisterVillager(UVillagerActivityComponent* ActivityComponent)
+{
+	int32 Slot = INDEX_NONE; // Slot of the removed villager.
+	if (!VillagerSlots.RemoveAndCopyValue(ActivityComponent, Slot)) // Look up and forget the slot.
+	{
+		return; // Not registered.
+	}
+
+	Villagers.RemoveAtSwap(Slot); // Fill the hole with the last villager.
+	if (Villagers.IsValidIndex(Slot)) // Fix up the villager moved into the freed slot.
+	{
+		VillagerSlots.Add(Villagers[Slot], Slot); // Record its new slot.
+	}
+}
+
+// Enables or disables the stage.
+void UVillageNeedsSubsystem::SetStageEnabled(bool bInEnabled)
+{
+	bStageEnabled = bInEnabled; // Store the switch.
+}
+
+// Integrates one minute for every registered villager.
+void UVillageNeedsSubsystem::ProcessMinute(int64 Minute)
+{
+	if (!bStageEnabled) // Stage disabled; villagers integrate themselves.
+	{
+		return; // Nothing to process.
+	}
+
+	VILLAGE_SIM_SCOPE(Needs); // Count the stage in the simulation benchmark.
+
+	GatherRows(Minute); // Flatten inputs on the game thread.
+	RunKernel(); // Integrate rows in parallel.
+	ScatterRows(); // Write results back.
+	DispatchEvents(); // Wake villagers whose bands changed.
+}
+
+// Collects one row per active need curve into the flat arrays.
+void UVillageNeedsSubsystem::GatherRows(int64 Minute)
+{
+	StepVillagers.Reset(); // Reuse allocations across minutes.
+	StepNeeds.Reset(); // Clear step needs.
+	StepFirstRow.Reset(); // Clear row ranges.
+	RowNeed.Reset(); // Clear need indices.
+	RowCurve.Reset(); // Clear curves.
+	RowElapsed.Reset(); // Clear elapsed minutes.
+	RowValue.Reset(); // Clear values.
+	RowMin.Reset(); // Clear minimums.
+	RowMax.Reset(); // Clear maximums.
+	RowMild.Reset(); // Clear mild thresholds.
+	RowCritical.Reset(); // Clear critical thresholds.
+
+	for (const TObjectKey<UVillagerActivityComponent>& VillagerKey : Villagers) // Visit every registered villager.
+	{
+		UVillagerActivityComponent* Villager = VillagerKey.ResolveObjectPtr(); // Null once the component is destroyed.
+		float ElapsedMinutes = 0.0f; // Minute of the activity being sampled.
+		TConstArrayView<FVillagerCompiledNeedCurve> Curves; // Curves of the active activity.
+		if (!Villager || !Villager->GetNeedsStageInput(Minute, ElapsedMinutes, Curves)) // Sample the active curves.
+		{
+			continue; // Idle, destroyed or without curves this minute.
+		}
+
+		UVillagerNeedsComponent* Needs = Villager->GetNeedsComponent(); // Needs receiving the results.
+		StepVillagers.Add(Villager); // Remember the villager for wakeups.
+		StepNeeds.Add(Needs); // Remember its needs for the scatter.
+		StepFirstRow.Add(RowNeed.Num()); // First row of this villager.
+
+		for (const FVillagerCompiledNeedCurve& Curve : Curves) // One row per curve.
+		{
+			const FNeedDefinition& Definition = Needs->GetNeedDefinition(Curve.NeedIndex); // Bounds and thresholds of the target need.
+			RowNeed.Add(Curve.NeedIndex); // Target need.
+			RowCurve.Add(&Curve); // Curve sampled by the kernel.
+			RowElapsed.Add(ElapsedMinutes); // Elapsed activity minute.
+			RowValue.Add(Needs->GetNeedValue(Curve.NeedIndex)); // Current value.
+			RowMin.Add(Definition.MinValue); // Lower bound.
+			RowMax.Add(Definition.MaxValue); // Upper bound.
+			RowMild.Add(Definition.Thresholds.MildThreshold); // Mild threshold.
+			RowCritical.Add(Definition.Thresholds.CriticalThreshold); // Critical threshold.
+		}
+	}
+
+	StepFirstRow.Add(RowNeed.Num()); // Sentinel closing the last villager's range.
+}
+
+// Clamps, classifies and flags every row in parallel.
+void UVillageNeedsSubsystem::RunKernel()
+{
+	const int32 RowCount = RowNeed.Num(); // Rows gathered this minute.
+	RowResult.SetNumUninitialized(RowCount); // One result per row.
+	RowFlags.SetNumUninitialized(RowCount); // One flag set per row.
+
+	ParallelFor(TEXT("VillageNeedsStage"), RowCount, KernelBatchSize, [this](int32 Row) // Rows are independent.
+	{
+		const float Min = RowMin[Row]; // Lower bound.
+		const float Max = RowMax[Row]; // Upper bound.
+		const float InvRange = 1.0f / FMath::Max(KINDA_SMALL_NUMBER, Max - Min); // Normalizes values for band checks.
+		const float OldValue = RowValue[Row]; // Value before this minute.
+		const float NewValue = FMath::Clamp(OldValue + RowCurve[Row]->SampleDelta(RowElapsed[Row]), Min, Max); // Apply and clamp the delta.
+
+		const uint8 OldBand = ClassifyBand((OldValue - Min) * InvRange, RowMild[Row], RowCritical[Row]); // Band before this minute.
+		const uint8 NewBand = ClassifyBand((NewValue - Min) * InvRange, RowMild[Row], RowCritical[Row]); // Band after this minute.
+
+		RowResult[Row] = NewValue; // Store the new value.
+		RowFlags[Row] = (NewBand != OldBand ? RowBandCrossed : 0) | (NewValue <= Min + KINDA_SMALL_NUMBER ? RowBottomedOut : 0); // Flag crossings and bottomed-out needs.
+	});
+}
+
+// Writes results back per villager and compacts the event list.
+void UVillageNeedsSubsystem::ScatterRows()
+{
+	Events.Reset(); // Keep the allocation.
+
+	for (int32 StepIndex = 0; StepIndex < StepVillagers.Num(); ++StepIndex) // Scatter per villager.
+	{
+		UVillagerNeedsComponent* Needs = StepNeeds[StepIndex]; // Needs of this villager.
+		if (!IsValid(Needs)) // Skip destroyed components.
+		{
+			continue; // Destroyed by an earlier villager's callbacks.
+		}
+
+		FVillagerNeedsBatchScope NeedsBatch(Needs); // One notification per villager.
+
+		for (int32 Row = StepFirstRow[StepIndex]; Row < StepFirstRow[StepIndex + 1]; ++Row)
+		{
+			const uint8 Flags = RowFlags[Row]; // Flags computed by the kernel.
+			Needs->StoreStageResult(RowNeed[Row], RowResult[Row], (Flags & RowBandCrossed) != 0, (Flags & RowBottomedOut) != 0); // Store without another notification.
+
+			if (Flags & RowBandCrossed) // Urgency band changed.
+			{
+				Events.Add({ StepIndex, RowNeed[Row], EVillageNeedsStageEvent::BandCrossed }); // Wake the villager after the scatter.
+			}
+		}
+	}
+}
+
+// Delivers crossing events to the affected villagers; deaths were resolved when each villager's batch flushed.
+void UVillageNeedsSubsystem::DispatchEvents()
+{
+	int32 LastWokenVillager = INDEX_NONE; // Villager woken most recently.
+
+	for (const FVillageNeedsStageEventRecord& Event : Events) // Events in villager order.
+	{
+		if (Event.Type != EVillageNeedsStageEvent::BandCrossed || Event.VillagerIndex == LastWokenVillager) // Skip other events and repeated wakeups.
+		{
+			continue; // Events are grouped per villager, so one wakeup per villager suffices.
+		}
+
+		UVillagerActivityComponent* Villager = StepVillagers[Event.VillagerIndex]; // Villager that owns the event.
+		if (IsValid(Villager) && !Villager->IsBeingDestroyed()) // Skip villagers being removed.
+		{
+			Villager->HandleNeedBandCrossed(); // Re-plan the next wakeup.
+		}
+		LastWokenVillager = Event.VillagerIndex; // Remember the woken villager.
+	}
+}
@@ -7,6 +7,10 @@
 #include "Engine/Engine.h"
 // Provides access to AActor for destruction checks.
 #include "GameFramework/Actor.h"
+// Supplies benchmark timing scopes.
+#include "Simulation/Core/VillageSimProfiler.h"
+// Provides the clock minute lazy needs are evaluated at.
+#include "Simulation/Time/VillageClockSubsystem.h"
 #pragma endregion EngineIncludes
 
 // Default constructor configuring component defaults.
@@ -14,6 +18,16 @@ UVillagerNeedsComponent::UVillagerNeedsComponent()
 {
 	// Disable ticking to avoid per-frame work as per performance guidelines.
 	PrimaryComponentTick.bCanEverTick = false;
+
+	bWantsInitializeComponent = true; // Resolve the clock before sibling components begin play.
+}
+
+// Resolves the clock before any component's BeginPlay can anchor lazy needs.
+void UVillagerNeedsComponent::InitializeComponent()
+{
+	Super::InitializeComponent(); // Preserve parent initialization.
+
+	ClockSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UVillageClockSubsystem>() : nullptr; // Cache clock for lazy evaluation.
 }
 
 // BeginPlay initializes runtime needs from the archetype asset.
@@ -24,65 +38,315 @@ void UVillagerNeedsComponent::BeginPlay()
 	BuildRuntimeNeeds(); // Instantiate runtime needs.
 }
 
-// Applies a delta to the specified need and clamps it within bounds.
+// Applies a delta to the need with the specified tag.
 void UVillagerNeedsComponent::ApplyNeedDelta(const FGameplayTag& NeedTag, float Delta)
 {
-	for (FNeedRuntimeState& NeedState : RuntimeNeeds) // Iterate through runtime needs.
+	ApplyNeedDeltaByIndex(FindNeedIndex(NeedTag), Delta); // Resolve the tag through the compiled index.
+}
+
+// Applies a delta to the specified need and clamps it within bounds.
+void UVillagerNeedsComponent::ApplyNeedDeltaByIndex(int32 NeedIndex, float Delta)
+{
+	VILLAGE_SIM_SCOPE(Needs); // Count need updates in the simulation benchmark.
+
+	if (!IsValidNeedIndex(NeedIndex)) // Ignore needs the villager does not track.
+	{
+		return; // Nothing to apply.
+	}
+
+	if (bLazyEvaluation) // Fold the accrued rate in before adding the delta.
+	{
+		AnchorNeed(NeedIndex, GetCurrentSimMinute()); // Re-anchor at the current minute.
+	}
+
+	const FNeedDefinition& Definition = Archetype->NeedDefinitions[NeedIndex]; // Shared static definition.
+	float& Value = NeedValues[NeedIndex]; // Alias the runtime value.
+	const float PreviousValue = Value; // Remember the value for change detection.
+	Value = FMath::Clamp(Value + Delta, Definition.MinValue, Definition.MaxValue); // Clamp to configured range.
+
+	if (Value != PreviousValue) // Only real changes are reported.
+	{
+		DirtyNeeds[NeedIndex] = true; // Mark the need for the next notification.
+		bPendingUrgencyBandCrossed |= EvaluateUrgency(Definition, PreviousValue) != EvaluateUrgency(Definition, Value); // Track band crossings.
+	}
+
+	if (Value <= Definition.MinValue + KINDA_SMALL_NUMBER) // The villager dies when a need bottoms out.
+	{
+		bPendingDeathCheck = true; // Resolve death once the batch is flushed.
+	}
+
+	if (NeedsBatchDepth == 0) // Unbatched deltas notify immediately.
+	{
+		FlushNeedChanges(); // Deliver this change.
+	}
+}
+
+// Stores a value integrated by the village needs stage, which already clamped and classified it.
+void UVillagerNeedsComponent::StoreStageResult(int32 NeedIndex, float NewValue, bool bBandCrossed, bool bBottomedOut)
+{
+	if (!IsValidNeedIndex(NeedIndex)) // Ignore needs the villager does not track.
+	{
+		return; // Nothing to store.
+	}
+
+	if (NeedValues[NeedIndex] != NewValue) // Only real changes are reported.
+	{
+		NeedValues[NeedIndex] = NewValue; // Write the integrated value.
+		DirtyNeeds[NeedIndex] = true; // Mark the need for the next notification.
+	}
+
+	bPendingUrgencyBandCrossed |= bBandCrossed; // Classified by the stage.
+	bPendingDeathCheck |= bBottomedOut; // Resolve death once the batch is flushed.
+
+	if (NeedsBatchDepth == 0) // Unbatched writes notify immediately.
+	{
+		FlushNeedChanges(); // Deliver this change.
+	}
+}
+
+// Opens a batch deferring change notifications.
+void UVillagerNeedsComponent::BeginNeedsBatch()
+{
+	++NeedsBatchDepth; // Nested batches flush with the outermost one.
+}
+
+// Closes a batch and flushes when the outermost batch ends.
+void UVillagerNeedsComponent::EndNeedsBatch()
+{
+	if (!ensure(NeedsBatchDepth > 0)) // Catch unbalanced calls.
 	{
-		if (NeedState.NeedTag == NeedTag) // Match by tag.
+		return; // Ignore the extra end.
+	}
+
+	if (--NeedsBatchDepth == 0) // Outermost batch closed.
+	{
+		FlushNeedChanges(); // Deliver accumulated changes once.
+	}
+}
+
+// Broadcasts accumulated changes and applies deferred villager death.
+void UVillagerNeedsComponent::FlushNeedChanges()
+{
+	FVillagerNeedsChangeSet ChangeSet; // Summary delivered to listeners.
+	for (TConstSetBitIterator<> It(DirtyNeeds); It; ++It) // Collect dirty needs in index order.
+	{
+		ChangeSet.ChangedNeedIndices.Add(It.GetIndex()); // Record changed index.
+	}
+	ChangeSet.bUrgencyBandCrossed = bPendingUrgencyBandCrossed; // Report band crossings.
+	ChangeSet.bNeedsRebuilt = bPendingRebuild; // Report rebuilds.
+
+	const bool bCheckDeath = bPendingDeathCheck; // Capture before clearing.
+
+	DirtyNeeds.Init(false, NeedValues.Num()); // Clear dirty flags.
+	bPendingUrgencyBandCrossed = false; // Reset crossing flag.
+	bPendingRebuild = false; // Reset rebuild flag.
+	bPendingDeathCheck = false; // Reset death flag.
+
+	if (ChangeSet.ChangedNeedIndices.Num() > 0 || ChangeSet.bNeedsRebuilt) // Skip empty notifications.
+	{
+		OnNeedsChanged.Broadcast(this, ChangeSet); // Notify native listeners with details.
+		OnNeedsUpdated.Broadcast(this); // Notify Blueprint listeners.
+	}
+
+	if (!bCheckDeath) // No need bottomed out.
+	{
+		return; // Villager survives.
+	}
+
+	const int32 NeedCount = GetNeedCount(); // Bound the scan to tracked needs.
+	for (int32 NeedIndex = 0; NeedIndex < NeedCount; ++NeedIndex) // Later deltas in the batch may have recovered the need.
+	{
+		if (NeedValues[NeedIndex] > Archetype->NeedDefinitions[NeedIndex].MinValue + KINDA_SMALL_NUMBER) // Need still above its floor.
 		{
-			const float NewValue = NeedState.CurrentValue + Delta; // Compute unclamped value.
-			NeedState.CurrentValue = FMath::Clamp(NewValue, NeedState.Definition.MinValue, NeedState.Definition.MaxValue); // Clamp to configured range.
-			OnNeedsUpdated.Broadcast(this); // Notify listeners that needs have changed.
+			continue; // Check the next need.
+		}
 
-			if (NeedState.CurrentValue <= NeedState.Definition.MinValue + KINDA_SMALL_NUMBER) // Destroy the villager when a need bottoms out.
+		if (AActor* OwnerActor = GetOwner())
+		{
+			if (OwnerActor->HasAuthority() && !OwnerActor->IsActorBeingDestroyed())
 			{
-				if (AActor* OwnerActor = GetOwner())
-				{
-					if (OwnerActor->HasAuthority() && !OwnerActor->IsActorBeingDestroyed())
-					{
-						OwnerActor->Destroy(); // Trigger villager death on the authoritative instance.
-					}
-				}
+				OwnerActor->Destroy(); // Trigger villager death on the authoritative instance.
 			}
-
-			return; // Exit after applying the delta.
 		}
+		return; // One death is enough.
 	}
 }
 
-// Returns the highest priority need meeting the required urgency.
-bool UVillagerNeedsComponent::GetHighestPriorityNeed(EVillagerNeedUrgency MinimumUrgency, FNeedRuntimeState& OutNeed) const
+// Returns the index of the highest priority need meeting the required urgency.
+int32 UVillagerNeedsComponent::FindHighestPriorityNeed(EVillagerNeedUrgency MinimumUrgency) const
 {
+	VILLAGE_SIM_SCOPE(Needs); // Count need updates in the simulation benchmark.
+
 	float BestWeight = -1.0f; // Tracks the highest priority found.
-	bool bFound = false; // Tracks whether a candidate exists.
+	int32 BestIndex = INDEX_NONE; // Tracks the best candidate.
 
-	for (const FNeedRuntimeState& NeedState : RuntimeNeeds) // Iterate through needs.
+	const int32 NeedCount = GetNeedCount(); // Bound the scan to tracked needs.
+	for (int32 NeedIndex = 0; NeedIndex < NeedCount; ++NeedIndex) // Iterate through needs.
 	{
-		const EVillagerNeedUrgency Urgency = EvaluateUrgency(NeedState); // Compute urgency.
+		const FNeedDefinition& Definition = Archetype->NeedDefinitions[NeedIndex]; // Shared static definition.
 
-		if (Urgency < MinimumUrgency) // Skip needs below the requested urgency.
+		if (EvaluateUrgency(Definition, GetNeedValue(NeedIndex)) < MinimumUrgency) // Skip needs below the requested urgency.
 		{
 			continue; // Continue to next need.
 		}
 
-		const float Weight = NeedState.Definition.PriorityWeight; // Retrieve priority weight.
-
-		if (Weight > BestWeight) // Select the best weight.
+		if (Definition.PriorityWeight > BestWeight) // Select the best weight.
 		{
-			BestWeight = Weight; // Update best weight.
-			OutNeed = NeedState; // Copy the candidate out.
-			bFound = true; // Mark as found.
+			BestWeight = Definition.PriorityWeight; // Update best weight.
+			BestIndex = NeedIndex; // Remember the candidate.
 		}
 	}
 
-	return bFound; // Indicate whether a suitable need was found.
+	return BestIndex; // INDEX_NONE when no need qualifies.
+}
+
+// Returns the number of tracked needs.
+int32 UVillagerNeedsComponent::GetNeedCount() const
+{
+	return Archetype ? FMath::Min(NeedValues.Num(), Archetype->NeedDefinitions.Num()) : 0; // Guard against definitions edited after the build.
 }
 
-// Provides read-only access to runtime needs.
-const TArray<FNeedRuntimeState>& UVillagerNeedsComponent::GetRuntimeNeeds() const
+// Returns whether an index refers to a tracked need.
+bool UVillagerNeedsComponent::IsValidNeedIndex(int32 NeedIndex) const
 {
-	return RuntimeNeeds; // Return the cached array.
+	return NeedIndex >= 0 && NeedIndex < GetNeedCount(); // Bounds check against values and definitions.
+}
+
+// Returns the compiled index of a need tag.
+int32 UVillagerNeedsComponent::FindNeedIndex(const FGameplayTag& NeedTag) const
+{
+	return Archetype ? Archetype->GetCompiledArchetype().FindNeedIndex(NeedTag) : INDEX_NONE; // Precompiled tag lookup.
+}
+
+// Returns the current value of a need.
+float UVillagerNeedsComponent::GetNeedValue(int32 NeedIndex) const
+{
+	if (bLazyEvaluation && IsValidNeedIndex(NeedIndex)) // Lazy needs are evaluated on demand.
+	{
+		return EvaluateLazyValue(NeedIndex, GetCurrentSimMinute()); // Anchor plus accrued rate.
+	}
+
+	return NeedValues.IsValidIndex(NeedIndex) ? NeedValues[NeedIndex] : 0.0f; // Guard invalid indices.
+}
+
+// Returns the need value normalized to 0-1 within its bounds.
+float UVillagerNeedsComponent::GetNormalizedNeedValue(int32 NeedIndex) const
+{
+	if (!IsValidNeedIndex(NeedIndex)) // Guard invalid indices.
+	{
+		return 0.0f; // Report empty.
+	}
+
+	const FNeedDefinition& Definition = Archetype->NeedDefinitions[NeedIndex]; // Shared static definition.
+	const float Range = FMath::Max(KINDA_SMALL_NUMBER, Definition.MaxValue - Definition.MinValue); // Avoid division by zero.
+	return FMath::Clamp((GetNeedValue(NeedIndex) - Definition.MinValue) / Range, 0.0f, 1.0f); // Normalize to 0-1.
+}
+
+// Returns the urgency band of a need.
+EVillagerNeedUrgency UVillagerNeedsComponent::GetNeedUrgency(int32 NeedIndex) const
+{
+	return IsValidNeedIndex(NeedIndex) ? EvaluateUrgency(Archetype->NeedDefinitions[NeedIndex], GetNeedValue(NeedIndex)) : EVillagerNeedUrgency::Satisfied; // Untracked needs never demand attention.
+}
+
+// Returns the shared static definition of a need.
+const FNeedDefinition& UVillagerNeedsComponent::GetNeedDefinition(int32 NeedIndex) const
+{
+	check(IsValidNeedIndex(NeedIndex)); // Callers must pass a tracked index.
+	return Archetype->NeedDefinitions[NeedIndex]; // Definitions are shared by reference from the archetype.
+}
+
+// Provides read-only access to need values.
+const TArray<float>& UVillagerNeedsComponent::GetNeedValues() const
+{
+	return NeedValues; // Return the cached array.
+}
+
+// Selects lazy evaluation before play starts.
+void UVillagerNeedsComponent::SetLazyEvaluation(bool bInLazy)
+{
+	ensure(!HasBegunPlay()); // Activities choose their integration path at BeginPlay.
+	bLazyEvaluation = bInLazy; // Store mode.
+}
+
+// Anchors a need at the current minute and starts a constant rate.
+void UVillagerNeedsComponent::SetNeedRate(int32 NeedIndex, float RatePerMinute, int64 ValidThroughMinute)
+{
+	if (!bLazyEvaluation || !IsValidNeedIndex(NeedIndex)) // Rates only drive lazy needs.
+	{
+		return; // Nothing to set.
+	}
+
+	const int64 Now = GetCurrentSimMinute(); // Rates apply from the next minute.
+	AnchorNeed(NeedIndex, Now); // Settle the previous rate.
+	NeedRates[NeedIndex] = ValidThroughMinute > Now ? RatePerMinute : 0.0f; // Expired rates change nothing.
+	RateValidThrough[NeedIndex] = ValidThroughMinute; // Remember when the rate ends.
+
+	if (NeedsBatchDepth == 0) // Unbatched anchors notify immediately.
+	{
+		FlushNeedChanges(); // Deliver changes accrued under the previous rate.
+	}
+}
+
+// Anchors every need at the current minute and stops all rates.
+void UVillagerNeedsComponent::ClearNeedRates()
+{
+	if (!bLazyEvaluation) // Rates only drive lazy needs.
+	{
+		return; // Nothing to clear.
+	}
+
+	const int64 Now = GetCurrentSimMinute(); // Settle up to this minute.
+	const int32 NeedCount = GetNeedCount(); // Bound the scan to tracked needs.
+	for (int32 NeedIndex = 0; NeedIndex < NeedCount; ++NeedIndex) // Stop every need.
+	{
+		AnchorNeed(NeedIndex, Now); // Fold the accrued rate in.
+		NeedRates[NeedIndex] = 0.0f; // Hold the value.
+	}
+
+	if (NeedsBatchDepth == 0) // Unbatched anchors notify immediately.
+	{
+		FlushNeedChanges(); // Deliver accrued changes.
+	}
+}
+
+// Anchors every need at the current minute.
+void UVillagerNeedsComponent::SyncLazyNeeds()
+{
+	if (!bLazyEvaluation) // Eager needs are always current.
+	{
+		return; // Nothing to sync.
+	}
+
+	const int64 Now = GetCurrentSimMinute(); // Settle up to this minute.
+	const int32 NeedCount = GetNeedCount(); // Bound the scan to tracked needs.
+	for (int32 NeedIndex = 0; NeedIndex < NeedCount; ++NeedIndex) // Settle every need.
+	{
+		AnchorNeed(NeedIndex, Now); // Fold the accrued rate in.
+	}
+
+	if (NeedsBatchDepth == 0) // Unbatched anchors notify immediately.
+	{
+		FlushNeedChanges(); // Deliver accrued changes.
+	}
+}
+
+// Returns the earliest minute any lazy need needs attention.
+int64 UVillagerNeedsComponent::PredictNextNeedEventMinute() const
+{
+	int64 BestMinute = MAX_int64; // No event predicted yet.
+
+	if (!bLazyEvaluation) // Eager needs are integrated minute by minute.
+	{
+		return BestMinute; // Nothing to predict.
+	}
+
+	const int32 NeedCount = GetNeedCount(); // Bound the scan to tracked needs.
+	for (int32 NeedIndex = 0; NeedIndex < NeedCount; ++NeedIndex) // Inspect every need.
+	{
+		BestMinute = FMath::Min(BestMinute, PredictNeedEventMinute(NeedIndex)); // Keep the earliest event.
+	}
+
+	return BestMinute; // Earliest predicted event.
 }
 
 // Returns the archetype pointer for external use.
@@ -95,45 +359,58 @@ UVillagerArchetypeDataAsset* UVillagerNeedsComponent::GetArchetype() const
 void UVillagerNeedsComponent::SetArchetype(UVillagerArchetypeDataAsset* InArchetype)
 {
 	Archetype = InArchetype; // Store provided asset.
-	BuildRuntimeNeeds(); // Recreate runtime state.
-	OnNeedsUpdated.Broadcast(this); // Notify listeners after rebuilding needs.
+	BuildRuntimeNeeds(); // Recreate runtime state and notify listeners.
 }
 
-// Builds runtime need states based on the archetype definitions.
+// Builds runtime need values based on the archetype definitions.
 void UVillagerNeedsComponent::BuildRuntimeNeeds()
 {
-	RuntimeNeeds.Reset(); // Clear previous state.
+	NeedValues.Reset(); // Clear previous state.
+	AnchorMinutes.Reset(); // Clear lazy anchors.
+	NeedRates.Reset(); // Clear lazy rates.
+	RateValidThrough.Reset(); // Clear lazy rate ends.
+	DirtyNeeds.Reset(); // Drop flags for the old indices.
+	bPendingUrgencyBandCrossed = false; // Old crossings no longer apply.
+	bPendingDeathCheck = false; // Old values no longer apply.
+	bPendingRebuild = true; // Listeners must rebuild index caches.
 
 	if (!Archetype) // Validate the archetype asset.
 	{
-		OnNeedsUpdated.Broadcast(this); // Notify listeners that needs have been cleared.
+		if (NeedsBatchDepth == 0) // Defer inside a batch.
+		{
+			FlushNeedChanges(); // Notify listeners that needs have been cleared.
+		}
 		return; // Abort if no data present.
 	}
 
+	NeedValues.Reserve(Archetype->NeedDefinitions.Num()); // One value per definition.
 	for (const FNeedDefinition& Definition : Archetype->NeedDefinitions) // Iterate definitions.
 	{
-		FNeedRuntimeState RuntimeState; // Create runtime entry.
-		RuntimeState.NeedTag = Definition.NeedTag; // Copy tag.
-		RuntimeState.Definition = Definition; // Copy static definition.
-		RuntimeState.CurrentValue = FMath::Clamp(Definition.StartingValue, Definition.MinValue, Definition.MaxValue); // Initialize value within bounds.
-		RuntimeNeeds.Add(RuntimeState); // Add to array.
+		NeedValues.Add(FMath::Clamp(Definition.StartingValue, Definition.MinValue, Definition.MaxValue)); // Initialize value within bounds.
 	}
+	DirtyNeeds.Init(false, NeedValues.Num()); // One dirty flag per need.
+	AnchorMinutes.Init(GetCurrentSimMinute(), NeedValues.Num()); // Starting values hold from now.
+	NeedRates.Init(0.0f, NeedValues.Num()); // No rate until an activity sets one.
+	RateValidThrough.Init(0, NeedValues.Num()); // No rate to expire.
 
-	OnNeedsUpdated.Broadcast(this); // Notify listeners after rebuilding runtime data.
+	if (NeedsBatchDepth == 0) // Defer inside a batch.
+	{
+		FlushNeedChanges(); // Notify listeners after rebuilding runtime data.
+	}
 }
 
 // Computes need urgency based on normalized value and thresholds.
-EVillagerNeedUrgency UVillagerNeedsComponent::EvaluateUrgency(const FNeedRuntimeState& Need) const
+EVillagerNeedUrgency UVillagerNeedsComponent::EvaluateUrgency(const FNeedDefinition& Definition, float Value) const
 {
-	const float Range = FMath::Max(KINDA_SMALL_NUMBER, Need.Definition.MaxValue - Need.Definition.MinValue); // Avoid division by zero.
-	const float Normalized = (Need.CurrentValue - Need.Definition.MinValue) / Range; // Normalize to 0-1.
+	const float Range = FMath::Max(KINDA_SMALL_NUMBER, Definition.MaxValue - Definition.MinValue); // Avoid division by zero.
+	const float Normalized = (Value - Definition.MinValue) / Range; // Normalize to 0-1.
 
-	if (Normalized <= Need.Definition.Thresholds.CriticalThreshold) // Check critical band when satisfaction is very low.
+	if (Normalized <= Definition.Thresholds.CriticalThreshold) // Check critical band when satisfaction is very low.
 	{
 		return EVillagerNeedUrgency::Critical; // Mark as critical.
 	}
 
-	if (Normalized <= Need.Definition.Thresholds.MildThreshold) // Check mild band when satisfaction is moderately low.
+	if (Normalized <= Definition.Thresholds.MildThreshold) // Check mild band when satisfaction is moderately low.
 	{
 		return EVillagerNeedUrgency::Mild; // Mark as mild.
 	}
@@ -141,17 +418,90 @@ EVillagerNeedUrgency UVillagerNeedsComponent::EvaluateUrgency(const FNeedRuntime
 	return EVillagerNeedUrgency::Satisfied; // Default to satisfied when above mild.
 }
 
-// Attempts to get a runtime need by tag.
-bool UVillagerNeedsComponent::TryGetRuntimeNeed(const FGameplayTag& NeedTag, FNeedRuntimeState& OutNeed) const
+// Returns the clock minute lazy needs are evaluated at.
+int64 UVillagerNeedsComponent::GetCurrentSimMinute() const
+{
+	const UVillageClockSubsystem* Clock = ClockSubsystem ? ClockSubsystem.Get() : (GetWorld() ? GetWorld()->GetSubsystem<UVillageClockSubsystem>() : nullptr); // Fall back for components never initialized.
+	return Clock ? Clock->GetTotalMinutes() : 0; // Time stands still without a clock.
+}
+
+// Evaluates a lazy need from its anchor; rates are constant, so clamping once matches per-minute clamping.
+float UVillagerNeedsComponent::EvaluateLazyValue(int32 NeedIndex, int64 Minute) const
 {
-	for (const FNeedRuntimeState& NeedState : RuntimeNeeds) // Iterate runtime collection.
+	const int64 RateMinutes = FMath::Min(Minute, RateValidThrough[NeedIndex]) - AnchorMinutes[NeedIndex]; // Minutes the rate applied since the anchor.
+	if (RateMinutes <= 0 || NeedRates[NeedIndex] == 0.0f) // Nothing accrued.
 	{
-		if (NeedState.NeedTag == NeedTag) // Match tag.
+		return NeedValues[NeedIndex]; // Anchor value.
+	}
+
+	const FNeedDefinition& Definition = Archetype->NeedDefinitions[NeedIndex]; // Shared static definition.
+	return FMath::Clamp(NeedValues[NeedIndex] + NeedRates[NeedIndex] * static_cast<float>(RateMinutes), Definition.MinValue, Definition.MaxValue); // Linear within the rate segment.
+}
+
+// Moves a lazy need's anchor, recording the accrued change.
+void UVillagerNeedsComponent::AnchorNeed(int32 NeedIndex, int64 Minute)
+{
+	const FNeedDefinition& Definition = Archetype->NeedDefinitions[NeedIndex]; // Shared static definition.
+	const float PreviousValue = NeedValues[NeedIndex]; // Value at the old anchor.
+	const float Value = EvaluateLazyValue(NeedIndex, Minute); // Value at the new anchor.
+
+	NeedValues[NeedIndex] = Value; // Store the anchor value.
+	AnchorMinutes[NeedIndex] = Minute; // Store the anchor minute.
+	if (Minute >= RateValidThrough[NeedIndex]) // Rate fully consumed.
+	{
+		NeedRates[NeedIndex] = 0.0f; // Hold the value until a new rate is set.
+	}
+
+	if (Value != PreviousValue) // Only real changes are reported.
+	{
+		DirtyNeeds[NeedIndex] = true; // Mark the need for the next notification.
+		bPendingUrgencyBandCrossed |= EvaluateUrgency(Definition, PreviousValue) != EvaluateUrgency(Definition, Value); // Track band crossings.
+	}
+
+	if (Value <= Definition.MinValue + KINDA_SMALL_NUMBER) // The villager dies when a need bottoms out.
+	{
+		bPendingDeathCheck = true; // Resolve death once the batch is flushed.
+	}
+}
+
+// Solves the anchor line for the first minute at which the need changes band, bottoms out or its rate ends.
+int64 UVillagerNeedsComponent::PredictNeedEventMinute(int32 NeedIndex) const
+{
+	const float Rate = NeedRates[NeedIndex]; // Per-minute change.
+	const int64 AnchorMinute = AnchorMinutes[NeedIndex]; // Start of the line.
+	const int64 ValidThrough = RateValidThrough[NeedIndex]; // End of the line.
+	if (Rate == 0.0f || ValidThrough <= AnchorMinute) // Value holds.
+	{
+		return MAX_int64; // No event.
+	}
+
+	const FNeedDefinition& Definition = Archetype->NeedDefinitions[NeedIndex]; // Shared static definition.
+	const float Value = NeedValues[NeedIndex]; // Anchor value.
+	const float Range = FMath::Max(KINDA_SMALL_NUMBER, Definition.MaxValue - Definition.MinValue); // Safe value range.
+	const float Boundaries[] = { // Values at which urgency or survival changes.
+		Definition.MinValue + Range * Definition.Thresholds.MildThreshold,
+		Definition.MinValue + Range * Definition.Thresholds.CriticalThreshold,
+		Definition.MinValue + KINDA_SMALL_NUMBER
+	};
+
+	int64 BestMinute = ValidThrough; // The rate ending needs attention too.
+	for (const float Boundary : Boundaries) // Find the nearest crossing in the direction of travel.
+	{
+		int64 Minutes = MAX_int64; // Minutes after the anchor.
+		if (Rate < 0.0f && Value > Boundary) // Falling onto or below the boundary.
+		{
+			Minutes = static_cast<int64>(FMath::CeilToDouble(static_cast<double>(Value - Boundary) / -Rate)); // First minute at or below.
+		}
+		else if (Rate > 0.0f && Value <= Boundary) // Rising above the boundary.
+		{
+			Minutes = static_cast<int64>(FMath::FloorToDouble(static_cast<double>(Boundary - Value) / Rate)) + 1; // First minute strictly above.
+		}
+
+		if (Minutes != MAX_int64) // A crossing exists on this side.
 		{
-			OutNeed = NeedState; // Copy state out.
-			return true; // Indicate success.
+			BestMinute = FMath::Min(BestMinute, AnchorMinute + FMath::Max<int64>(1, Minutes)); // Keep the earliest crossing.
 		}
 	}
 
-	return false; // No matching need found.
+	return BestMinute; // Earliest event.
 }
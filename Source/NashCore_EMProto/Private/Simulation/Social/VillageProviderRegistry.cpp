@@ -0,0 +1,117 @@
+// Includes the provider registry declaration.
+#include "Simulation/Social/VillageProviderRegistry.h"
+
+// Region: Engine includes.
+#pragma region EngineIncludes
+// Provides world access for subsystem lookups.
+#include "Engine/World.h"
+// Provides the provider actors.
+#include "GameFramework/Actor.h"
+#pragma endregion EngineIncludes
+
+// Region: Simulation includes.
+#pragma region SimulationIncludes
+// Provides trade location resolution.
+#include "Simulation/Locations/VillageLocationRegistry.h"
+// Provides the registering social components.
+#include "Simulation/Social/VillagerSocialComponent.h"
+#pragma endregion SimulationIncludes
+
+// Drops all providers on shutdown.
+void UVillageProviderRegistry::Deinitialize()
+{
+	ProvidersByResource.Reset(); // Drop providers.
+	ResourceBySocialComponent.Reset(); // Drop reverse lookups.
+
+	Super::Deinitialize(); // Preserve base cleanup.
+}
+
+// Registers a provider under its provided resource, replacing any previous registration.
+void UVillageProviderRegistry::RegisterProvider(UVillagerSocialComponent* SocialComponent)
+{
+	if (!SocialComponent) // Skip null registrations.
+	{
+		return; // Nothing to register.
+	}
+
+	UnregisterProvider(SocialComponent); // The provided resource may have changed with the archetype.
+
+	const FGameplayTag ResourceTag = SocialComponent->GetProvidedResourceTag(); // Resource offered by the villager.
+	if (!ResourceTag.IsValid()) // No resource.
+	{
+		return; // Villager provides nothing.
+	}
+
+	FVillageProviderEntry& Entry = ProvidersByResource.FindOrAdd(ResourceTag).AddDefaulted_GetRef(); // New provider entry.
+	Entry.SocialComponent = SocialComponent; // Component trading the resource.
+	Entry.ProviderActor = SocialComponent->GetOwner(); // Actor standing at the trade spots.
+	Entry.TradeLocationTags = SocialComponent->GetTradeLocationTags(); // Authored trade spots.
+
+	ResourceBySocialComponent.Add(SocialComponent, ResourceTag); // Remember the resource for removal.
+}
+
+// Removes a provider from the index.
+void UVillageProviderRegistry::UnregisterProvider(UVillagerSocialComponent* SocialComponent)
+{
+	FGameplayTag ResourceTag; // Resource the component was registered under.
+	if (!ResourceBySocialComponent.RemoveAndCopyValue(SocialComponent, ResourceTag)) // Look up and forget the registration.
+	{
+		return; // Not registered.
+	}
+
+	if (TArray<FVillageProviderEntry>* Providers = ProvidersByResource.Find(ResourceTag)) // Providers of that resource.
+	{
+		// Stable removal keeps provider order deterministic for random selection.
+		Providers->RemoveAll([SocialComponent](const FVillageProviderEntry& Entry) { return Entry.SocialComponent.Get() == SocialComponent; }); // Drop the component's entry.
+	}
+}
+
+// Returns providers of a resource with trade locations resolved against the current location registry.
+TConstArrayView<FVillageProviderEntry> UVillageProviderRegistry::GetProviders(const FGameplayTag& ResourceTag)
+{
+	TArray<FVillageProviderEntry>* Providers = ProvidersByResource.Find(ResourceTag); // Providers of the resource.
+	if (!Providers) // Nobody offers it.
+	{
+		return TConstArrayView<FVillageProviderEntry>(); // Empty view.
+	}
+
+	Providers->RemoveAll([](const FVillageProviderEntry& Entry) { return !Entry.SocialComponent.IsValid(); }); // Drop providers destroyed without unregistering.
+
+	UVillageLocationRegistry* LocationRegistry = GetWorld() ? GetWorld()->GetSubsystem<UVillageLocationRegistry>() : nullptr; // Resolve the location registry.
+
+	for (FVillageProviderEntry& Entry : *Providers) // Refresh stale trade spots.
+	{
+		// Resolving may refresh the location registry, so re-read the revision for every entry.
+		const int32 Revision = LocationRegistry ? LocationRegistry->GetRevision() : INDEX_NONE; // Current registry revision.
+		if (Entry.ResolvedRevision != Revision || Revision == INDEX_NONE) // Resolved against an older registry or never resolved.
+		{
+			ResolveTradeLocations(Entry, LocationRegistry); // Resolve again.
+		}
+	}
+
+	return *Providers; // Provide the live providers.
+}
+
+// Resolves each authored trade tag through the location registry and caches the transforms.
+void UVillageProviderRegistry::ResolveTradeLocations(FVillageProviderEntry& Entry, UVillageLocationRegistry* LocationRegistry) const
+{
+	Entry.TradeLocations.Reset(); // Drop stale spots.
+
+	if (!LocationRegistry) // No registry.
+	{
+		Entry.ResolvedRevision = INDEX_NONE; // Resolve again next time.
+		return; // Nothing to resolve.
+	}
+
+	for (const FGameplayTag& TradeTag : Entry.TradeLocationTags) // Resolve each authored tag.
+	{
+		FTransform TradeTransform; // Resolved trade spot.
+		if (LocationRegistry->TryGetLocation(TradeTag, TradeTransform)) // Tag is registered.
+		{
+			Entry.TradeLocations.Add({ TradeTag, TradeTransform }); // Record the spot.
+		}
+	}
+
+	// A lookup miss refreshes the registry; record the latest revision so the refresh is not repeated for this entry.
+	Entry.ResolvedRevision = LocationRegistry->GetRevision(); // Remember the revision.
+}
@@ -5,10 +5,13 @@
 #pragma region EngineIncludes
 // Provides access to on-screen debug logging if desired.
 #include "Engine/Engine.h" // Imports engine logging utilities.
+// Provides world access for subsystem lookup.
+#include "Engine/World.h" // Imports UWorld.
 #pragma endregion EngineIncludes
 
 // Region: Simulation includes.
 #include "Simulation/Logging/VillagerLogComponent.h" // Imports logging for affection updates.
+#include "Simulation/Social/VillageProviderRegistry.h" // Imports the provider index.
 
 // Constructor configuring component defaults.
 UVillagerSocialComponent::UVillagerSocialComponent()
@@ -24,6 +27,22 @@ void UVillagerSocialComponent::BeginPlay()
 	LogComponent = GetOwner() ? GetOwner()->FindComponentByClass<UVillagerLogComponent>() : nullptr; // Cache log component for affection updates.
 
 	RebuildAffectionFromArchetype(); // Build affection map.
+
+	RegisterWithProviderRegistry(); // Make this villager discoverable as a provider.
+}
+
+// Removes this villager from the provider index.
+void UVillagerSocialComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld()) // Resolve world.
+	{
+		if (UVillageProviderRegistry* ProviderRegistry = World->GetSubsystem<UVillageProviderRegistry>()) // Resolve provider index.
+		{
+			ProviderRegistry->UnregisterProvider(this); // Stop being offered to buyers.
+		}
+	}
+
+	Super::EndPlay(EndPlayReason); // Preserve base cleanup.
 }
 
 // Requests a resource amount considering affection and urgency.
@@ -63,16 +82,16 @@ void UVillagerSocialComponent::RegisterMissedTrade(const FGameplayTag& OtherVill
 	const float Current = GetOrAddAffection(OtherVillagerId); // Fetch existing affection.
 	const float NewValue = Current - Archetype->SocialDefinition.AffectionLossOnMiss; // Apply loss.
 	AffectionMap.Add(OtherVillagerId, NewValue); // Store updated value.
+	OnAffectionChanged.Broadcast(this); // Notify observers of the loss.
 
+	const FVillageEventParams Event = FVillageEventParams().SetTarget(OtherVillagerId).SetValue(0, NewValue); // Describe the affection loss.
 	if (LogComponent) // Emit affection loss log.
 	{
-		LogComponent->LogMessage(FString::Printf(TEXT("Affection toward %s decreased to %.3f (missed trade)."),
-			*UVillagerLogComponent::GetShortTagString(OtherVillagerId),
-			NewValue)); // Compose affection loss log.
+		LogComponent->LogEvent(EVillageEventType::AffectionMissedTrade, Event); // Record affection loss log.
 	}
-	else // Provide a standard log fallback when no UI log is available.
+	else if (UVillageEventLogSubsystem* EventLog = GetWorld() ? GetWorld()->GetSubsystem<UVillageEventLogSubsystem>() : nullptr) // Record in the village log when no villager log is available.
 	{
-		UE_LOG(LogTemp, Log, TEXT("Affection toward %s decreased to %.3f (missed trade)."), *UVillagerLogComponent::GetShortTagString(OtherVillagerId), NewValue); // Emit log to standard output for debugging. 
+		EventLog->Write(EVillageEventType::AffectionMissedTrade, GetVillagerIdTag(), Event); // Output log sink formats it when verbose.
 	}
 }
 
@@ -81,6 +100,23 @@ void UVillagerSocialComponent::SetArchetype(UVillagerArchetypeDataAsset* InArche
 {
 	Archetype = InArchetype; // Store new archetype.
 	RebuildAffectionFromArchetype(); // Recompute affection from new data.
+
+	if (HasBegunPlay()) // BeginPlay registers components configured before play.
+	{
+		RegisterWithProviderRegistry(); // Refile under the new provided resource.
+	}
+}
+
+// Files this villager in the world provider index.
+void UVillagerSocialComponent::RegisterWithProviderRegistry()
+{
+	if (UWorld* World = GetWorld()) // Resolve world.
+	{
+		if (UVillageProviderRegistry* ProviderRegistry = World->GetSubsystem<UVillageProviderRegistry>()) // Resolve provider index.
+		{
+			ProviderRegistry->RegisterProvider(this); // Register or refresh the registration.
+		}
+	}
 }
 
 // Returns the resource provided by this villager.
@@ -115,6 +151,13 @@ TMap<FGameplayTag, float> UVillagerSocialComponent::GetAffectionSnapshot() const
 	return AffectionMap; // Return snapshot of affection values.
 }
 
+// Overwrites the affection toward another villager.
+void UVillagerSocialComponent::SetAffection(const FGameplayTag& OtherVillagerId, float Value)
+{
+	AffectionMap.Add(OtherVillagerId, Value); // Store the supplied value.
+	OnAffectionChanged.Broadcast(this); // Notify observers of the new value.
+}
+
 // Retrieves affection for a villager, creating an entry if absent.
 float UVillagerSocialComponent::GetOrAddAffection(const FGameplayTag& VillagerId)
 {
@@ -142,17 +185,19 @@ void UVillagerSocialComponent::ApplyTradeAffectionAdjustments(const FGameplayTag
 	const float NewBuyerAffection = CurrentBuyerAffection + Archetype->SocialDefinition.BuyerAffectionGainOnTrade * UrgencyMultiplier; // Compute buyer gain.
 	const float NewSellerAffection = NewBuyerAffection + Archetype->SocialDefinition.SellerAffectionGainPerTrade; // Compute seller gain stacking on buyer gain.
 	AffectionMap.Add(RequesterId, NewSellerAffection); // Store combined affection.
+	OnAffectionChanged.Broadcast(this); // Notify observers of the gain.
 
+	const FVillageEventParams Event = FVillageEventParams()
+		.SetTarget(RequesterId)
+		.SetValue(0, NewSellerAffection)
+		.SetValue(1, NeedUrgency == EVillagerNeedUrgency::Critical ? 1.0f : 0.0f); // Describe the affection update.
 	if (LogComponent) // Emit affection update log.
 	{
-		LogComponent->LogMessage(FString::Printf(TEXT("Affection toward %s updated to %.3f (trade, %s)."),
-			*UVillagerLogComponent::GetShortTagString(RequesterId),
-			NewSellerAffection,
-			NeedUrgency == EVillagerNeedUrgency::Critical ? TEXT("critical") : TEXT("mild"))); // Compose affection log message.
+		LogComponent->LogEvent(EVillageEventType::AffectionTrade, Event); // Record affection log message.
 	}
-	else // Provide standard logging when the UI log component is unavailable.
+	else if (UVillageEventLogSubsystem* EventLog = GetWorld() ? GetWorld()->GetSubsystem<UVillageEventLogSubsystem>() : nullptr) // Record in the village log when no villager log is available.
 	{
-		UE_LOG(LogTemp, Log, TEXT("Affection toward %s updated to %.3f (trade, %s)."), *UVillagerLogComponent::GetShortTagString(RequesterId), NewSellerAffection, NeedUrgency == EVillagerNeedUrgency::Critical ? TEXT("critical") : TEXT("mild")); // Emit log to standard output for debugging. 
+		EventLog->Write(EVillageEventType::AffectionTrade, GetVillagerIdTag(), Event); // Output log sink formats it when verbose.
 	}
 }
 
@@ -161,13 +206,13 @@ void UVillagerSocialComponent::RebuildAffectionFromArchetype()
 {
 	AffectionMap.Reset(); // Clear previous data.
 
-	if (!Archetype) // Validate archetype.
+	if (Archetype) // Validate archetype.
 	{
-		return; // Abort if missing.
+		for (const FApprovalEntry& Approval : Archetype->SocialDefinition.Approvals) // Iterate defaults.
+		{
+			AffectionMap.Add(Approval.VillagerIdTag, Approval.AffectionValue); // Seed map.
+		}
 	}
 
-	for (const FApprovalEntry& Approval : Archetype->SocialDefinition.Approvals) // Iterate defaults.
-	{
-		AffectionMap.Add(Approval.VillagerIdTag, Approval.AffectionValue); // Seed map.
-	}
+	OnAffectionChanged.Broadcast(this); // Notify observers of the rebuilt map.
 }
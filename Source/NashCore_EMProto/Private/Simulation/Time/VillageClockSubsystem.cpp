@@ -3,18 +3,32 @@
 
 // Region: Engine headers.
 #pragma region EngineIncludes
-// Provides access to the world context for timer management.
+// Provides access to the world context.
 #include "Engine/World.h"
-// Grants access to the timer manager for scheduling recurring tasks.
-#include "TimerManager.h"
+// Supplies cycle stat declarations for tickable objects.
+#include "Stats/Stats.h"
+// Provides command line access for the world seed.
+#include "Misc/CommandLine.h"
+// Provides command line value parsing.
+#include "Misc/Parse.h"
 #pragma endregion EngineIncludes
 
+// Local log category for clock diagnostics.
+DEFINE_LOG_CATEGORY_STATIC(LogVillageClock, Log, All);
+
 // Default constructor setting initial time values.
 UVillageClockSubsystem::UVillageClockSubsystem()
 	: CurrentHour(6) // Start the day at 6 AM.
 	, CurrentMinute(0) // Start at minute zero.
 	, CurrentPhase(EVillageDayPhase::Day) // Default to day phase.
+	, TotalMinutes(0) // No minutes have elapsed yet.
 	, SecondsPerGameMinute(1.0f) // One real second equals one in-game minute.
+	, MaxStepsPerFrame(4) // A hitch costs at most a few extra steps on the next frame.
+	, WorldSeed(0) // Fixed seed so runs are reproducible by default.
+	, MaxPendingMinutes(8.0) // Carry frame jitter over; drop the backlog of longer hitches.
+	, PendingMinutes(0.0) // Nothing accumulated yet.
+	, bClockRunning(false) // Started explicitly during initialization.
+	, bDispatchingWakeups(false) // No wakeups running yet.
 {
 }
 
@@ -29,45 +43,136 @@ void UVillageClockSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection); // Call parent to respect lifecycle.
 
+	FParse::Value(FCommandLine::Get(), TEXT("VillageSeed="), WorldSeed); // Allow runs to pick a seed from the command line.
+
 	UpdatePhaseFromHour(); // Ensure phase matches the starting hour.
 
+	WakeupWheel.Reset(TotalMinutes); // Align the scheduler with the starting minute.
+
 	StartClock(); // Begin ticking minutes.
 }
 
-// Tears down timers on subsystem shutdown.
+// Stops the clock on subsystem shutdown.
 void UVillageClockSubsystem::Deinitialize()
 {
-	StopClock(); // Stop timers to avoid dangling callbacks.
+	StopClock(); // Stop accumulating time.
+
+	WakeupWheel.Reset(TotalMinutes); // Drop pending wakeups bound to villagers of this world.
 
 	Super::Deinitialize(); // Run parent cleanup.
 }
 
-// Begins the recurring timer that advances minutes.
-void UVillageClockSubsystem::StartClock()
+// Accumulates real time and advances whole minutes within the step budget.
+void UVillageClockSubsystem::Tick(float DeltaTime)
 {
-	if (UWorld* World = GetWorld()) // Acquire world safely.
+	Super::Tick(DeltaTime); // Run parent validation.
+
+	if (!bClockRunning || DeltaTime <= 0.0f) // Ignore paused clocks and empty frames.
+	{
+		return; // Nothing to accumulate.
+	}
+
+	PendingMinutes += static_cast<double>(DeltaTime) / static_cast<double>(SecondsPerGameMinute); // Convert real time into game minutes.
+
+	if (PendingMinutes > MaxPendingMinutes) // Backlog grew beyond what catch-up should chase.
 	{
-		World->GetTimerManager().SetTimer(ClockTimerHandle, this, &UVillageClockSubsystem::AdvanceOneMinute, SecondsPerGameMinute, true); // Start looping timer.
+		UE_LOG(LogVillageClock, Log, TEXT("Dropping %.1f pending minutes beyond the catch-up limit."), PendingMinutes - MaxPendingMinutes); // Report discarded time.
+		PendingMinutes = MaxPendingMinutes; // Clamp the backlog.
 	}
+
+	const int32 StepCount = static_cast<int32>(FMath::Min(FMath::FloorToDouble(PendingMinutes), static_cast<double>(MaxStepsPerFrame))); // Whole minutes allowed this frame.
+	if (StepCount <= 0) // Less than a minute accumulated.
+	{
+		return; // Wait for more time.
+	}
+
+	PendingMinutes -= StepCount; // Consume the simulated minutes; the remainder carries over.
+
+	AdvanceMinutes(StepCount); // Simulate the batch.
+}
+
+// Provides the stat identifier used by the tickable object manager.
+TStatId UVillageClockSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UVillageClockSubsystem, STATGROUP_Tickables); // Report under tickables.
 }
 
-// Stops the clock timer if it is active.
+// Enables time accumulation on world tick.
+void UVillageClockSubsystem::StartClock()
+{
+	bClockRunning = true; // Resume accumulating real time.
+}
+
+// Disables time accumulation and drops the partial minute.
 void UVillageClockSubsystem::StopClock()
 {
-	if (UWorld* World = GetWorld()) // Ensure world exists.
+	bClockRunning = false; // Stop accumulating real time.
+	PendingMinutes = 0.0; // Discard time that was never simulated.
+}
+
+// Returns whether the clock advances on world tick.
+bool UVillageClockSubsystem::IsClockRunning() const
+{
+	return bClockRunning; // Provide running state.
+}
+
+// Advances a batch of whole minutes immediately.
+void UVillageClockSubsystem::AdvanceMinutes(int32 MinuteCount)
+{
+	for (int32 StepIndex = 0; StepIndex < MinuteCount; ++StepIndex) // Fixed one-minute steps keep results independent of frame rate.
 	{
-		World->GetTimerManager().ClearTimer(ClockTimerHandle); // Clear the timer to halt updates.
+		AdvanceOneMinute(); // Simulate a single minute.
 	}
 }
 
-// Adjusts the real seconds per in-game minute and restarts the timer.
+// Adjusts the real seconds per in-game minute.
 void UVillageClockSubsystem::SetSecondsPerGameMinute(float InSecondsPerGameMinute)
 {
-	SecondsPerGameMinute = FMath::Max(0.1f, InSecondsPerGameMinute); // Clamp to avoid zero or negative values.
+	SecondsPerGameMinute = FMath::Max(KINDA_SMALL_NUMBER, InSecondsPerGameMinute); // Clamp to avoid zero or negative values.
+}
+
+// Returns the real seconds per in-game minute.
+float UVillageClockSubsystem::GetSecondsPerGameMinute() const
+{
+	return SecondsPerGameMinute; // Provide cadence.
+}
 
-	StopClock(); // Stop existing timer to reschedule.
+// Sets the per-frame minute budget.
+void UVillageClockSubsystem::SetMaxStepsPerFrame(int32 InMaxStepsPerFrame)
+{
+	MaxStepsPerFrame = FMath::Max(1, InMaxStepsPerFrame); // Always allow progress.
+	MaxPendingMinutes = FMath::Max(MaxPendingMinutes, static_cast<double>(MaxStepsPerFrame)); // Keep the backlog able to fill a frame.
+}
 
-	StartClock(); // Restart with the new cadence.
+// Returns the per-frame minute budget.
+int32 UVillageClockSubsystem::GetMaxStepsPerFrame() const
+{
+	return MaxStepsPerFrame; // Provide budget.
+}
+
+// Sets the seed villager random streams are derived from.
+void UVillageClockSubsystem::SetWorldSeed(int32 InWorldSeed)
+{
+	WorldSeed = InWorldSeed; // Store seed.
+}
+
+// Returns the seed villager random streams are derived from.
+int32 UVillageClockSubsystem::GetWorldSeed() const
+{
+	return WorldSeed; // Provide seed.
+}
+
+// Returns a serial unique to one villager in this world.
+uint32 UVillageClockSubsystem::AcquireVillagerSerial()
+{
+	return NextVillagerSerial++; // Hand out in begin-play order.
+}
+
+// Returns simulation time including the accumulating fraction of the next minute.
+double UVillageClockSubsystem::GetSimTimeMinutes() const
+{
+	const double Fraction = FMath::Min(PendingMinutes, 1.0 - UE_DOUBLE_KINDA_SMALL_NUMBER); // Backlog beyond one minute has not been simulated yet.
+	return static_cast<double>(TotalMinutes) + Fraction; // Combine whole and fractional minutes.
 }
 
 // Returns the current hour in 24-hour format.
@@ -88,9 +193,34 @@ EVillageDayPhase UVillageClockSubsystem::GetCurrentPhase() const
 	return CurrentPhase; // Provide cached phase.
 }
 
+// Returns the number of minutes elapsed since the clock started.
+int64 UVillageClockSubsystem::GetTotalMinutes() const
+{
+	return TotalMinutes; // Provide the monotonic minute counter.
+}
+
+// Schedules a wakeup callback at an absolute simulation minute.
+FVillageWakeupHandle UVillageClockSubsystem::ScheduleWakeup(int64 DueMinute, FOnVillageWakeup Callback)
+{
+	return WakeupWheel.Schedule(DueMinute, MoveTemp(Callback)); // Delegate to the timing wheel.
+}
+
+// Cancels a pending wakeup.
+void UVillageClockSubsystem::CancelWakeup(FVillageWakeupHandle& Handle)
+{
+	WakeupWheel.Cancel(Handle); // Remove the entry and clear the handle.
+}
+
+// Returns the number of pending wakeups.
+int32 UVillageClockSubsystem::GetPendingWakeupCount() const
+{
+	return WakeupWheel.Num(); // Provide the scheduler size.
+}
+
 // Internal tick that advances one minute and fires events.
 void UVillageClockSubsystem::AdvanceOneMinute()
 {
+	++TotalMinutes; // Advance the monotonic counter.
 	++CurrentMinute; // Increment minute counter.
 
 	if (CurrentMinute >= 60) // Check for hour overflow.
@@ -109,6 +239,27 @@ void UVillageClockSubsystem::AdvanceOneMinute()
 	}
 
 	OnMinuteChanged.Broadcast(CurrentHour, CurrentMinute); // Notify listeners every minute.
+
+	DispatchDueWakeups(); // Run only the villagers that asked for attention this minute.
+
+	OnMinuteProcessed.Broadcast(TotalMinutes); // Run village-wide stages for the minute.
+
+	OnMinuteDecisionPhase.Broadcast(TotalMinutes); // Resolve decisions deferred by this minute's wakeups.
+}
+
+// Executes the wakeups that became due on the current minute.
+void UVillageClockSubsystem::DispatchDueWakeups()
+{
+	DueWakeups.Reset(); // Reuse the scratch allocation.
+	WakeupWheel.Advance(TotalMinutes, DueWakeups); // Collect callbacks due up to now.
+
+	TGuardValue<bool> DispatchGuard(bDispatchingWakeups, true); // Lets villagers defer decisions to the decision phase.
+	for (FOnVillageWakeup& Wakeup : DueWakeups) // Execute in scheduling order for determinism.
+	{
+		Wakeup.ExecuteIfBound(); // Callbacks may schedule new wakeups for later minutes.
+	}
+
+	DueWakeups.Reset(); // Release delegate bindings promptly.
 }
 
 // Updates the day phase and broadcasts change if needed.
@@ -0,0 +1,173 @@
+// Includes the timing wheel declaration.
+#include "Simulation/Time/VillageTimingWheel.h"
+
+// Constructor starting the wheel at minute zero.
+FVillageTimingWheel::FVillageTimingWheel()
+	: CurrentMinute(0) // Start at the beginning of simulation time.
+	, NextId(1) // Reserve zero for unset handles.
+{
+}
+
+// Drops every pending entry and restarts the wheel at the supplied minute.
+void FVillageTimingWheel::Reset(int64 InCurrentMinute)
+{
+	Entries.Reset(); // Forget pending callbacks.
+
+	for (TArray<uint64>& Slot : Slots) // Clear every slot bucket.
+	{
+		Slot.Reset(); // Keep allocations for reuse.
+	}
+
+	Overflow.Reset(); // Clear far-future entries.
+	CurrentMinute = InCurrentMinute; // Restart at the requested minute.
+}
+
+// Schedules a callback for the supplied absolute minute.
+FVillageWakeupHandle FVillageTimingWheel::Schedule(int64 DueMinute, FOnVillageWakeup Callback)
+{
+	FVillageWakeupHandle Handle; // Handle returned to the caller.
+
+	if (!Callback.IsBound()) // Ignore unbound callbacks.
+	{
+		return Handle; // Return an unset handle.
+	}
+
+	const int64 ClampedDue = FMath::Max(DueMinute, CurrentMinute + 1); // Past or current minutes fire on the next advance.
+
+	Handle.Id = NextId++; // Assign a unique identifier.
+
+	FEntry& Entry = Entries.Add(Handle.Id); // Store the pending entry.
+	Entry.DueMinute = ClampedDue; // Record the due minute.
+	Entry.Callback = MoveTemp(Callback); // Take ownership of the callback.
+
+	Insert(Handle.Id, ClampedDue); // Place the identifier in the wheel.
+
+	return Handle; // Provide the handle for cancellation.
+}
+
+// Cancels a pending entry and clears the handle.
+bool FVillageTimingWheel::Cancel(FVillageWakeupHandle& Handle)
+{
+	if (!Handle.IsValid()) // Nothing to cancel.
+	{
+		return false; // Report no removal.
+	}
+
+	const bool bRemoved = Entries.Remove(Handle.Id) > 0; // Drop the entry; its slot reference is skipped lazily.
+	Handle.Reset(); // Invalidate the caller handle.
+	return bRemoved; // Report whether an entry was pending.
+}
+
+// Advances the wheel minute by minute and collects due callbacks.
+void FVillageTimingWheel::Advance(int64 NewMinute, TArray<FOnVillageWakeup>& OutDueCallbacks)
+{
+	while (CurrentMinute < NewMinute) // Step through every intermediate minute so no slot is skipped.
+	{
+		Step(OutDueCallbacks); // Process one minute.
+	}
+}
+
+// Places an identifier into the level and slot matching its due minute.
+void FVillageTimingWheel::Insert(uint64 Id, int64 DueMinute)
+{
+	const int64 Delta = DueMinute - CurrentMinute; // Distance from the current minute.
+
+	int64 LevelSpan = SlotsPerLevel; // Span covered by the current level.
+	for (int32 Level = 0; Level < LevelCount; ++Level) // Find the finest level that covers the distance.
+	{
+		if (Delta < LevelSpan) // The entry fits within this level's window.
+		{
+			const int32 SlotIndex = static_cast<int32>((DueMinute >> (SlotBits * Level)) & SlotMask); // Address the slot for the due minute.
+			GetSlot(Level, SlotIndex).Add(Id); // Append to preserve scheduling order.
+			return; // Done.
+		}
+
+		LevelSpan <<= SlotBits; // Widen the span for the next level.
+	}
+
+	Overflow.Add(Id); // Park far-future entries until the top level wraps.
+}
+
+// Re-inserts every identifier of a higher-level slot so it lands in finer slots.
+void FVillageTimingWheel::CascadeSlot(int32 Level, int32 SlotIndex)
+{
+	TArray<uint64>& Slot = GetSlot(Level, SlotIndex); // Resolve the slot to drain.
+	if (Slot.Num() == 0) // Nothing to cascade.
+	{
+		return; // Skip work.
+	}
+
+	CascadeScratch.Reset(); // Reuse the scratch allocation.
+	CascadeScratch.Append(Slot); // Copy identifiers before the slot is refilled.
+	Slot.Reset(); // Empty the source slot.
+
+	for (const uint64 Id : CascadeScratch) // Re-insert each live identifier.
+	{
+		if (const FEntry* Entry = Entries.Find(Id)) // Skip cancelled entries.
+		{
+			Insert(Id, Entry->DueMinute); // Place relative to the new current minute.
+		}
+	}
+}
+
+// Processes a single minute step.
+void FVillageTimingWheel::Step(TArray<FOnVillageWakeup>& OutDueCallbacks)
+{
+	++CurrentMinute; // Move to the next minute.
+
+	if ((CurrentMinute & SlotMask) == 0) // Level zero wrapped; pull down the next level-one slot.
+	{
+		const int64 LevelOneIndex = CurrentMinute >> SlotBits; // Absolute level-one index.
+
+		if ((LevelOneIndex & SlotMask) == 0) // Level one wrapped as well.
+		{
+			const int64 LevelTwoIndex = LevelOneIndex >> SlotBits; // Absolute level-two index.
+
+			if ((LevelTwoIndex & SlotMask) == 0 && Overflow.Num() > 0) // Top level wrapped; retry overflow entries.
+			{
+				TArray<uint64> PendingOverflow = MoveTemp(Overflow); // Take the overflow list.
+				Overflow.Reset(); // Ensure the moved-from list is empty.
+
+				for (const uint64 Id : PendingOverflow) // Re-insert each live identifier.
+				{
+					if (const FEntry* Entry = Entries.Find(Id)) // Skip cancelled entries.
+					{
+						Insert(Id, Entry->DueMinute); // Place relative to the new current minute.
+					}
+				}
+			}
+
+			CascadeSlot(2, static_cast<int32>(LevelTwoIndex & SlotMask)); // Cascade level two into finer levels.
+		}
+
+		CascadeSlot(1, static_cast<int32>(LevelOneIndex & SlotMask)); // Cascade level one into level zero.
+	}
+
+	TArray<uint64>& DueSlot = GetSlot(0, static_cast<int32>(CurrentMinute & SlotMask)); // Slot holding this minute's entries.
+	if (DueSlot.Num() == 0) // Nothing due this minute.
+	{
+		return; // Skip work.
+	}
+
+	CascadeScratch.Reset(); // Reuse the scratch allocation.
+	CascadeScratch.Append(DueSlot); // Copy identifiers so callbacks can be collected safely.
+	DueSlot.Reset(); // Empty the slot for future minutes.
+
+	for (const uint64 Id : CascadeScratch) // Collect due callbacks in scheduling order.
+	{
+		FEntry* Entry = Entries.Find(Id); // Resolve the entry.
+		if (!Entry) // Entry was cancelled.
+		{
+			continue; // Skip stale identifiers.
+		}
+
+		if (Entry->DueMinute > CurrentMinute) // Defensive guard for entries not yet due.
+		{
+			Insert(Id, Entry->DueMinute); // Put it back into the wheel.
+			continue; // Leave it pending.
+		}
+
+		OutDueCallbacks.Add(MoveTemp(Entry->Callback)); // Hand the callback to the caller.
+		Entries.Remove(Id); // Retire the entry.
+	}
+}
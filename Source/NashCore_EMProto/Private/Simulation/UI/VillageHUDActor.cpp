@@ -3,8 +3,6 @@
 
 // Region: Engine includes.
 #pragma region EngineIncludes
-// Provides actor iteration helpers.
-#include "EngineUtils.h"
 // Access to world context helpers.
 #include "Engine/World.h"
 // Supplies player controller access for widget creation.
@@ -22,6 +20,7 @@
 #pragma region SimulationIncludes
 #include "Simulation/UI/VillageStatusWidget.h"
 #include "Simulation/Logging/VillagerLogComponent.h"
+#include "Simulation/Logging/VillageEventHubSubsystem.h"
 #include "Simulation/Time/VillageClockSubsystem.h"
 #pragma endregion SimulationIncludes
 
@@ -106,7 +105,7 @@ void AVillageHUDActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 // Region: Helpers. 
 #pragma region Helpers // Groups helper functions.
-// Attempts to locate a villager log component from the preferred actor or any actor in the world.
+// Attempts to locate a villager log component from the preferred actor or the villagers registered with the event hub.
 UVillagerLogComponent* AVillageHUDActor::ResolveLogComponent() const
 {
 	if (PreferredVillager)
@@ -117,14 +116,15 @@ UVillagerLogComponent* AVillageHUDActor::ResolveLogComponent() const
 		}
 	}
 
-	if (!bAutoFindVillager || !GetWorld())
+	const UVillageEventHubSubsystem* EventHub = GetWorld() ? GetWorld()->GetSubsystem<UVillageEventHubSubsystem>() : nullptr;
+	if (!bAutoFindVillager || !EventHub)
 	{
 		return nullptr;
 	}
 
-	for (TActorIterator<AActor> It(GetWorld()); It; ++It)
+	for (const TWeakObjectPtr<UVillagerLogComponent>& Villager : EventHub->GetVillagers())
 	{
-		if (UVillagerLogComponent* Comp = It->FindComponentByClass<UVillagerLogComponent>())
+		if (UVillagerLogComponent* Comp = Villager.Get())
 		{
 			return Comp;
 		}
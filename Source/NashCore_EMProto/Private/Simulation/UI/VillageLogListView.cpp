@@ -0,0 +1,75 @@
+// Includes the log list view declarations.
+#include "Simulation/UI/VillageLogListView.h"
+
+// Region: UMG includes.
+#pragma region UMGIncludes
+// Supplies widget tree creation utilities.
+#include "Blueprint/WidgetTree.h"
+// Provides text rendering widget.
+#include "Components/TextBlock.h"
+// Provides slate color type for text styling.
+#include "Styling/SlateColor.h"
+#pragma endregion UMGIncludes
+
+// Fills the item from a villager's log entry.
+void UVillageLogListItem::Initialize(const UVillageEventLogSubsystem* InEventLog, const UVillagerLogComponent* InSource, const FGameplayTag& InVillagerTag, const FVillagerLogEntry& InEntry)
+{
+	EventLog = InEventLog; // Keep the log for lazy formatting.
+	VillagerTag = InVillagerTag; // Filter key.
+	Entry = InEntry; // Copy the structured entry.
+	bHasText = false; // Format on first display.
+	Color = InSource ? InSource->GetResolvedLogTextColor() : FLinearColor::White; // Per-villager color; recycled items drop the previous villager's.
+	FontSize = InSource ? InSource->GetLogFontSize() : 12; // Per-villager font size.
+}
+
+// Returns the formatted line, formatting and caching it on first use.
+const FText& UVillageLogListItem::GetText() const
+{
+	if (!bHasText) // First display.
+	{
+		const UVillageEventLogSubsystem* Log = EventLog.Get(); // Tag names are resolved through the village log.
+		CachedText = FText::FromString(Log ? Log->FormatEvent(Entry.Record, Entry.Message) : Entry.Message); // Format once.
+		bHasText = true; // Cache the line.
+	}
+
+	return CachedText; // Provide cached line.
+}
+
+// Builds a text block layout when the entry was not designed in UMG.
+void UVillageLogEntryWidget::NativeOnInitialized()
+{
+	Super::NativeOnInitialized(); // Preserve base initialization.
+
+	if (!EntryText && WidgetTree) // No designed layout.
+	{
+		EntryText = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass(), TEXT("EntryText")); // Create the line text.
+		EntryText->SetAutoWrapText(true); // Enable wrapping for long messages.
+		WidgetTree->RootWidget = EntryText; // Use the text as the entry root.
+	}
+}
+
+// Shows the item assigned to this recycled entry.
+void UVillageLogEntryWidget::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+	IUserObjectListEntry::NativeOnListItemObjectSet(ListItemObject); // Preserve interface behavior.
+
+	const UVillageLogListItem* Item = Cast<UVillageLogListItem>(ListItemObject); // Resolve the log item.
+	if (!Item || !EntryText) // Nothing to show.
+	{
+		return;
+	}
+
+	EntryText->SetText(Item->GetText()); // Assign the log message text.
+	FSlateFontInfo FontInfo = EntryText->GetFont(); // Copy the existing font info.
+	FontInfo.Size = Item->GetFontSize(); // Apply the villager's font size.
+	EntryText->SetFont(FontInfo); // Update the text font.
+	EntryText->SetColorAndOpacity(FSlateColor(Item->GetColor())); // Apply the villager's text color.
+}
+
+// Sets the entry widget class and disables right-click scrolling.
+UVillageLogListView::UVillageLogListView(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer) // Call parent constructor.
+{
+	EntryWidgetClass = UVillageLogEntryWidget::StaticClass(); // Recycled code-built entries.
+	bEnableRightClickScrolling = false; // Prevent RMB from being captured by the log list.
+}
@@ -5,14 +5,12 @@
 #pragma region EngineIncludes // Groups engine includes. 
 // Provides access to world context for subsystem lookups. 
 #include "Engine/World.h" // Imports UWorld. 
-// Enables actor iteration when auto-binding to the first villager log. 
-#include "EngineUtils.h" // Imports TActorIterator. 
-// Required for the actor type used during iteration. 
-#include "GameFramework/Actor.h" // Imports AActor. 
 // Provides pointer event types for mouse input handling. 
 #include "Input/Events.h" // Imports FPointerEvent. 
 // Provides mouse button key definitions. 
 #include "InputCoreTypes.h" // Imports EKeys. 
+// Provides sorting of newly pulled lines. 
+#include "Algo/Sort.h" // Imports Algo::SortBy. 
 #pragma endregion EngineIncludes // Ends the engine includes region. 
 
 // Region: UMG includes. 
@@ -24,21 +22,31 @@
 #include "Components/VerticalBoxSlot.h" // Imports UVerticalBoxSlot. 
 // Provides text rendering widget. 
 #include "Components/TextBlock.h" // Imports UTextBlock. 
-// Provides scroll box for log lines. 
-#include "Components/ScrollBox.h" // Imports UScrollBox. 
-#include "Components/ScrollBoxSlot.h" // Imports UScrollBoxSlot. 
-// Provides slate color type for text styling. 
-#include "Styling/SlateColor.h" // Imports FSlateColor. 
+// Provides the virtualized list view for log lines. 
+#include "Components/ListView.h" // Imports UListView. 
 #pragma endregion UMGIncludes // Ends the UMG includes region. 
 
 // Region: Simulation includes. 
 #pragma region SimulationIncludes // Groups simulation includes. 
 // Provides access to the log component for UI binding. 
 #include "Simulation/Logging/VillagerLogComponent.h" // Imports UVillagerLogComponent. 
+// Provides the hub delivering new log lines. 
+#include "Simulation/Logging/VillageEventHubSubsystem.h" // Imports UVillageEventHubSubsystem. 
 // Provides access to the clock subsystem for UI binding. 
 #include "Simulation/Time/VillageClockSubsystem.h" // Imports UVillageClockSubsystem. 
+// Provides the log list item, entry and code-built list view. 
+#include "Simulation/UI/VillageLogListView.h" // Imports UVillageLogListView. 
 #pragma endregion SimulationIncludes // Ends the simulation includes region. 
 
+// Region: Local constants. 
+#pragma region LocalConstants // Groups file-local constants. 
+namespace 
+{ 
+	// Event types must fit the hidden type mask. 
+	static_assert(static_cast<int32>(EVillageEventType::Count) <= 32, "HiddenEventTypes holds one bit per event type."); 
+} 
+#pragma endregion LocalConstants // Ends the local constants region. 
+
 // Groups widget lifecycle functions.  
 #pragma region Lifecycle
 // Ensures bindings are established even if the widget is spawned purely from C++. 
@@ -47,33 +55,23 @@ void UVillageStatusWidget::NativeConstruct()
 	Super::NativeConstruct(); // Invoke the base widget construction. 
 	UVillagerLogComponent::SetOnScreenDebugEnabled(false); // Disable on-screen debug while the log UI is visible. 
 
-	if (!ClockText || !LogScrollBox) // Build a simple layout if none was authored in UMG. 
+	if (!ClockText || !LogListView) // Build a simple layout if none was authored in UMG. 
 	{
 		BuildFallbackLayout(); // Build the fallback widget tree. 
 	}
 
-	if (LogScrollBox) // Disable RMB drag scrolling to avoid consuming camera look input. 
-	{
-		LogScrollBox->SetAllowRightClickDragScrolling(false); // Prevent RMB from being captured by the log scroll box. 
-	}
-
-	if (!ClockSubsystem.IsValid()) // Auto-resolve the clock subsystem. 
+	if (UWorld* World = GetWorld()) // Resolve the current world context. 
 	{
-		if (UWorld* World = GetWorld()) // Resolve the current world context. 
+		if (!ClockSubsystem.IsValid()) // Auto-resolve the clock subsystem. 
 		{
 			ClockSubsystem = World->GetSubsystem<UVillageClockSubsystem>(); // Cache the clock subsystem. 
 		}
-	}
 
-	// If no log source was provided, grab the first available villager in the world. 
-	if (UWorld* World = GetWorld()) // Resolve the current world context. 
-	{
-		for (TActorIterator<AActor> It(World); It; ++It) // Iterate all actors in the world. 
+		EventLog = World->GetSubsystem<UVillageEventLogSubsystem>(); // Cache the village log for formatting. 
+		EventHub = World->GetSubsystem<UVillageEventHubSubsystem>(); // Cache the hub delivering new lines. 
+		if (EventHub.IsValid() && !EventBatchHandle.IsValid()) // Subscribe once to every villager's events. 
 		{
-			if (UVillagerLogComponent* Found = It->FindComponentByClass<UVillagerLogComponent>()) // Find the first log component. 
-			{
-				BindToLogComponent(Found); // Bind to the discovered log component. 
-			}
+			EventBatchHandle = EventHub->Subscribe(FVillageEventTopic(), FOnVillageEventBatch::CreateUObject(this, &UVillageStatusWidget::HandleEventBatch)); // Filters run on the retained lines instead. 
 		}
 	}
 
@@ -88,13 +86,11 @@ void UVillageStatusWidget::NativeDestruct()
 		ClockSubsystem->OnMinuteChanged.RemoveDynamic(this, &UVillageStatusWidget::HandleMinuteChanged); // Unbind clock updates. 
 	}
 
-	for (TWeakObjectPtr<UVillagerLogComponent>& LogComp : ObservedLogComponents) // Iterate observed log components. 
+	if (EventHub.IsValid()) // Remove the hub subscription when available. 
 	{
-		if (LogComp.IsValid()) // Validate each log component. 
-		{
-			LogComp->OnLogLineAdded.RemoveDynamic(this, &UVillageStatusWidget::HandleLogLineAdded); // Unbind log updates. 
-		}
+		EventHub->Unsubscribe(EventBatchHandle); // Stop receiving batches. 
 	}
+	EventBatchHandle.Reset(); // Allow resubscribing on the next construct. 
 
 	UVillagerLogComponent::SetOnScreenDebugEnabled(true); // Re-enable on-screen debug after the log UI is removed. 
 	Super::NativeDestruct(); // Invoke the base widget destruction. 
@@ -140,12 +136,30 @@ void UVillageStatusWidget::InitializeFromSources(UVillageClockSubsystem* InClock
 		RefreshClockText(ClockSubsystem->GetCurrentHour(), ClockSubsystem->GetCurrentMinute()); // Initialize the clock display. 
 	}
 
-	if (InLogComponent) // Bind to the provided log component. 
-	{
-		BindToLogComponent(InLogComponent); // Register log bindings. 
-	}
+	RepopulateLog(InLogComponent); // Refresh the log list for all registered villagers. 
+}
+
+// Shows only the lines of one villager. 
+void UVillageStatusWidget::SetVillagerFilter(FGameplayTag InVillagerIdTag)
+{
+	VillagerFilter = InVillagerIdTag; // Store the villager filter. 
+	RefreshVisibleItems(); // Re-filter the retained lines. 
+}
 
-	RepopulateLog(); // Refresh the log list for all observed components. 
+// Shows or hides lines of one event type. 
+void UVillageStatusWidget::SetEventTypeVisible(EVillageEventType EventType, bool bVisible)
+{
+	const uint32 TypeBit = 1u << static_cast<uint32>(EventType); // Resolve the type's mask bit. 
+	HiddenEventTypes = bVisible ? (HiddenEventTypes & ~TypeBit) : (HiddenEventTypes | TypeBit); // Update the mask. 
+	RefreshVisibleItems(); // Re-filter the retained lines. 
+}
+
+// Shows every retained line again. 
+void UVillageStatusWidget::ClearLogFilters()
+{
+	VillagerFilter = FGameplayTag(); // Show all villagers. 
+	HiddenEventTypes = 0; // Show all event types. 
+	RefreshVisibleItems(); // Re-filter the retained lines. 
 }
 // Ends the public API region.
 #pragma endregion PublicAPI  
@@ -166,10 +180,13 @@ void UVillageStatusWidget::BuildFallbackLayout()
 	ClockText->SetText(FText::FromString(TEXT("Clock: --:--"))); // Initialize the clock text placeholder. 
 	ClockText->SetAutoWrapText(true); // Enable wrapping for long strings. 
 
-	LogScrollBox = WidgetTree->ConstructWidget<UScrollBox>(UScrollBox::StaticClass(), TEXT("LogScrollBox")); // Create the log scroll box. 
+	LogListView = WidgetTree->ConstructWidget<UVillageLogListView>(UVillageLogListView::StaticClass(), TEXT("LogListView")); // Create the log list view. 
 
 	Root->AddChildToVerticalBox(ClockText); // Add the clock text to the root. 
-	Root->AddChildToVerticalBox(LogScrollBox); // Add the log scroll box to the root. 
+	if (UVerticalBoxSlot* LogSlot = Root->AddChildToVerticalBox(LogListView)) // Add the log list view to the root. 
+	{
+		LogSlot->SetSize(FSlateChildSize(ESlateSizeRule::Fill)); // Let the list fill the remaining height so it can virtualize. 
+	}
 
 	WidgetTree->RootWidget = Root; // Assign the root widget for the tree. 
 }
@@ -192,87 +209,160 @@ void UVillageStatusWidget::RefreshClockText(int32 Hour, int32 Minute)
 	ClockText->SetText(FText::FromString(TimeString)); // Apply the formatted clock string. 
 }
 
-// Clears and rebuilds the log UI from the buffered messages. 
-void UVillageStatusWidget::RepopulateLog()
+// Clears and rebuilds the retained lines from the buffered messages. 
+void UVillageStatusWidget::RepopulateLog(UVillagerLogComponent* AdditionalSource)
 {
-	if (!LogScrollBox) // Validate the log scroll box. 
+	RetireItems(RetainedItems.Num()); // Recycle previously retained lines. 
+
+	TArray<UVillagerLogComponent*, TInlineAllocator<64>> Sources; // Villagers whose buffers are read. 
+	if (EventHub.IsValid()) // Read every registered villager. 
+	{
+		for (const TWeakObjectPtr<UVillagerLogComponent>& Villager : EventHub->GetVillagers()) // Iterate the registry. 
+		{
+			if (UVillagerLogComponent* Source = Villager.Get()) // Skip villagers being destroyed. 
+			{
+				Sources.Add(Source); // Read this villager. 
+			}
+		}
+	}
+	if (AdditionalSource) // Include a source that has not registered yet. 
 	{
-		return; // Exit when the log scroll box is missing. 
+		Sources.AddUnique(AdditionalSource); // Avoid reading a buffer twice. 
 	}
 
-	LogScrollBox->ClearChildren(); // Remove existing log entries. 
-
-	for (const TWeakObjectPtr<UVillagerLogComponent>& LogComp : ObservedLogComponents) // Iterate observed log components. 
+	TArray<TPair<UVillagerLogComponent*, const FVillagerLogEntry*>> Candidates; // Buffered entries of every source. 
+	for (UVillagerLogComponent* Source : Sources) // Reference each buffered entry. 
 	{
-		if (!LogComp.IsValid()) // Skip invalid components. 
+		Source->ForEachEntry(0, [Source, &Candidates](const FVillagerLogEntry& Entry) // Ring slots stay put while nothing is recorded. 
 		{
-			continue; // Move to the next component. 
-		}
+			Candidates.Emplace(Source, &Entry); // Remember the entry without copying it. 
+		});
+	}
+
+	Algo::SortBy(Candidates, [](const TPair<UVillagerLogComponent*, const FVillagerLogEntry*>& Candidate) // Interleave villagers chronologically. 
+	{
+		return Candidate.Value->Record.Sequence; // Village-wide order. 
+	});
 
-		const TArray<FString> Messages = LogComp->GetRecentMessages(); // Retrieve cached messages for this component. 
-		for (const FString& Message : Messages) // Iterate each buffered message. 
+	const int32 FirstRetained = FMath::Max(0, Candidates.Num() - FMath::Max(RetainedLogLines, 1)); // Only the newest lines fit the retention window. 
+	RetainedItems.Reserve(Candidates.Num() - FirstRetained); // One allocation for the retained lines. 
+	for (int32 Index = FirstRetained; Index < Candidates.Num(); ++Index) // Create items for the retained lines only. 
+	{
+		UVillagerLogComponent* Source = Candidates[Index].Key; // Villager that buffered the entry. 
+		UVillageLogListItem* Item = AcquireItem(); // Reuse a recycled item when one is free. 
+		Item->Initialize(EventLog.Get(), Source, Source->VillagerIdTag, *Candidates[Index].Value); // Text is formatted on first display. 
+		RetainedItems.Add(Item); // Retain the line. 
+	}
+
+	LastRetainedSequence = RetainedItems.Num() > 0 ? RetainedItems.Last()->GetEntry().Record.Sequence : 0; // Skip hub events already read. 
+	TrimAndRefresh(); // Apply the retention window and show the lines. 
+}
+
+// Appends one frame of hub events to the retained lines. 
+void UVillageStatusWidget::HandleEventBatch(TConstArrayView<const FVillageEventNotification*> Notifications)
+{
+	for (const FVillageEventNotification* Notification : Notifications) // Events arrive in village order. 
+	{
+		const uint64 Sequence = Notification->Entry.Record.Sequence; // Village-wide sequence. 
+		if (Sequence <= LastRetainedSequence) // Already read from a buffer during repopulation. 
 		{
-			AddLogEntry(LogComp.Get(), Message); // Add a styled entry for each message. 
+			continue; // Skip the duplicate. 
 		}
+
+		UVillageLogListItem* Item = AcquireItem(); // Reuse a recycled item when one is free. 
+		Item->Initialize(EventLog.Get(), Notification->Source.Get(), Notification->VillagerIdTag, Notification->Entry); // Despawned sources keep their lines. 
+		RetainedItems.Add(Item); // Retain the line. 
+		LastRetainedSequence = Sequence; // Advance the watermark. 
 	}
+
+	TrimAndRefresh(); // Apply the retention window and show the lines. 
 }
 
-// Handles the minute change delegate from the clock subsystem. 
-void UVillageStatusWidget::HandleMinuteChanged(int32 Hour, int32 Minute)
+// Drops lines beyond the retention window and refreshes the list. 
+void UVillageStatusWidget::TrimAndRefresh()
 {
-	RefreshClockText(Hour, Minute); // Update the clock text. 
+	const int32 ExcessCount = RetainedItems.Num() - FMath::Max(RetainedLogLines, 1); // Lines beyond the retention window. 
+	if (ExcessCount > 0) // Trim the oldest lines. 
+	{
+		RetireItems(ExcessCount); // Recycle the oldest lines. 
+	}
+
+	RefreshVisibleItems(); // Hand the filtered lines to the list. 
+}
+
+// Returns a recycled list item, or a new one when the pool is empty. 
+UVillageLogListItem* UVillageStatusWidget::AcquireItem()
+{
+	RecycleRetiredItems(); // Pool lines the list view no longer shows. 
+	return ItemPool.Num() > 0 ? ItemPool.Pop(EAllowShrinking::No) : NewObject<UVillageLogListItem>(this); // Allocate only while the pool is empty. 
 }
 
-// Handles new log messages emitted by a villager. 
-void UVillageStatusWidget::HandleLogLineAdded(UVillagerLogComponent* SourceComponent, const FString& Message)
+// Moves the oldest retained lines to the retired list. 
+void UVillageStatusWidget::RetireItems(int32 Count)
 {
-	AddLogEntry(SourceComponent, Message); // Forward to the shared log entry creation routine. 
+	RecycleRetiredItems(); // Keep every retired line from the same frame. 
+	RetiredItems.Append(RetainedItems.GetData(), Count); // Still referenced by the list view until it refreshes. 
+	RetiredFrame = GFrameCounter; // Remember when they left the list. 
+	RetainedItems.RemoveAt(0, Count, EAllowShrinking::No); // Drop the lines from the retention window. 
 }
 
-// Adds a new line to the visible log list. 
-void UVillageStatusWidget::AddLogEntry(UVillagerLogComponent* SourceComponent, const FString& Message)
+// Pools retired lines that no list view row maps to anymore. 
+void UVillageStatusWidget::RecycleRetiredItems()
 {
-	if (!LogScrollBox) // Validate the log scroll box. 
+	if (RetiredItems.Num() == 0 || GFrameCounter <= RetiredFrame) // Nothing retired, or the list view has not ticked since. 
 	{
-		return; // Exit when the log scroll box is missing. 
+		return; // Keep the lines retired. 
 	}
 
-	UTextBlock* Entry = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass()); // Allocate a new text entry widget. 
-	Entry->SetText(FText::FromString(Message)); // Assign the log message text. 
-	Entry->SetAutoWrapText(true); // Enable wrapping for long messages. 
-	if (SourceComponent) // Apply per-villager styling when available. 
+	for (int32 Index = RetiredItems.Num() - 1; Index >= 0; --Index) // Walk backwards so removals keep indices valid. 
 	{
-		const FLinearColor EntryColor = SourceComponent->GetResolvedLogTextColor(); // Retrieve the configured color. 
-		const int32 EntryFontSize = SourceComponent->GetLogFontSize(); // Retrieve the configured font size. 
-		FSlateFontInfo FontInfo = Entry->GetFont(); // Copy the existing font info. 
-		FontInfo.Size = EntryFontSize; // Apply the configured font size. 
-		Entry->SetFont(FontInfo); // Update the text font. 
-		Entry->SetColorAndOpacity(FSlateColor(EntryColor)); // Apply the configured text color. 
-	}
+		UVillageLogListItem* Item = RetiredItems[Index]; // Retired line to check. 
+		if (LogListView && LogListView->GetEntryWidgetFromItem(Item)) // A row still shows the line until the list regenerates. 
+		{
+			continue; // Retry on a later acquire. 
+		}
 
-	LogScrollBox->AddChild(Entry); // Add the log entry widget to the scroll box. 
-	LogScrollBox->ScrollToEnd(); // Scroll to the latest entry. 
+		ItemPool.Add(Item); // Ready for reuse. 
+		RetiredItems.RemoveAtSwap(Index, 1, EAllowShrinking::No); // Order of retired lines does not matter. 
+	}
 }
 
-// Binds to a log component and avoids duplicate subscriptions. 
-void UVillageStatusWidget::BindToLogComponent(UVillagerLogComponent* InLogComponent)
+// Rebuilds the list view items from the retained lines that pass the filters. 
+void UVillageStatusWidget::RefreshVisibleItems()
 {
-	if (!InLogComponent) // Validate the incoming log component. 
+	if (!LogListView) // Validate the log list view. 
 	{
-		return; // Exit when no log component was provided. 
+		return; // Exit when the log list view is missing. 
 	}
 
-	const bool bAlreadyBound = ObservedLogComponents.ContainsByPredicate([InLogComponent](const TWeakObjectPtr<UVillagerLogComponent>& WeakLog) // Check existing bindings. 
+	VisibleItems.Reset(); // Keep the allocation. 
+	for (UVillageLogListItem* Item : RetainedItems) // Filter the retained lines. 
 	{
-		return WeakLog.Get() == InLogComponent; // Report true when the component is already tracked. 
-	});
+		if (PassesFilters(*Item)) // Keep matching lines. 
+		{
+			VisibleItems.Add(Item); // Show the line. 
+		}
+	}
 
-	if (bAlreadyBound) // Skip duplicate bindings. 
+	LogListView->SetListItems(VisibleItems); // Entries are regenerated only for rows in view. 
+	LogListView->ScrollToBottom(); // Follow the latest entry. 
+}
+
+// Returns whether a retained line passes the villager and event type filters. 
+bool UVillageStatusWidget::PassesFilters(const UVillageLogListItem& Item) const
+{
+	if (VillagerFilter.IsValid() && Item.GetVillagerTag() != VillagerFilter) // Other villager. 
 	{
-		return; // Exit when already bound. 
+		return false; // Filtered out. 
 	}
 
-	InLogComponent->OnLogLineAdded.AddDynamic(this, &UVillageStatusWidget::HandleLogLineAdded); // Bind to log updates. 
-	ObservedLogComponents.Add(InLogComponent); // Track the observed log component. 
+	const uint32 TypeBit = 1u << static_cast<uint32>(Item.GetEntry().Record.Type); // Resolve the type's mask bit. 
+	return (HiddenEventTypes & TypeBit) == 0; // Visible unless the type is hidden. 
+}
+
+// Handles the minute change delegate from the clock subsystem. 
+void UVillageStatusWidget::HandleMinuteChanged(int32 Hour, int32 Minute)
+{
+	RefreshClockText(Hour, Minute); // Update the clock text. 
 }
 #pragma endregion Helpers // Ends the helper methods region. 
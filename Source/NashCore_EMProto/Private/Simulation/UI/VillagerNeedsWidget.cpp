@@ -24,7 +24,7 @@
 // Region: Simulation includes. 
 #pragma region SimulationIncludes
 // Provides access to needs component data. 
-#include "Simulation/Needs/VillagerNeedsComponent.h" // Imports UVillagerNeedsComponent and FNeedRuntimeState. 
+#include "Simulation/Needs/VillagerNeedsComponent.h" // Imports UVillagerNeedsComponent. 
 // Provides access to archetype data for villager id display.
 #include "Simulation/Data/VillagerDataAssets.h" // Imports UVillagerArchetypeDataAsset.
 // Provides formatted tag strings for display consistency.
@@ -33,6 +33,45 @@
 #include "Simulation/Social/VillagerSocialComponent.h" // Imports UVillagerSocialComponent.
 #pragma endregion SimulationIncludes
 
+// Region: Local constants. 
+#pragma region LocalConstants
+namespace
+{
+	// Scale of need values at the displayed precision of three decimals. 
+	constexpr double NeedValueScale = 1000.0;
+
+	// Scale of affection values at the displayed precision of two decimals. 
+	constexpr double AffectionValueScale = 100.0;
+
+	// Returns the cached formatting of need values. 
+	const FNumberFormattingOptions& GetNeedValueFormat()
+	{
+		static const FNumberFormattingOptions Format = FNumberFormattingOptions().SetUseGrouping(false).SetMinimumFractionalDigits(3).SetMaximumFractionalDigits(3); // Built once. 
+		return Format; // Shared by every widget. 
+	}
+
+	// Returns the cached formatting of affection values. 
+	const FNumberFormattingOptions& GetAffectionValueFormat()
+	{
+		static const FNumberFormattingOptions Format = FNumberFormattingOptions().SetUseGrouping(false).SetMinimumFractionalDigits(2).SetMaximumFractionalDigits(2); // Built once. 
+		return Format; // Shared by every widget. 
+	}
+
+	// Updates a value text only when the value differs at the displayed precision. 
+	void SetValueTextIfChanged(UTextBlock* ValueText, int32& DisplayedValue, float Value, double Scale, const FNumberFormattingOptions& Format)
+	{
+		const int32 ScaledValue = FMath::RoundToInt(Value * Scale); // Value as displayed. 
+		if (!ValueText || ScaledValue == DisplayedValue) // Text already shows this value. 
+		{
+			return; // Skip formatting and the text invalidation. 
+		}
+
+		DisplayedValue = ScaledValue; // Remember the displayed value. 
+		ValueText->SetText(FText::AsNumber(ScaledValue / Scale, &Format)); // Format the rounded value. 
+	}
+}
+#pragma endregion LocalConstants
+
 // Region: Lifecycle. 
 #pragma region Lifecycle
 // Ensures the widget is ready to receive data. 
@@ -60,11 +99,36 @@ void UVillagerNeedsWidget::NativeDestruct()
 {
 	if (NeedsComponent.IsValid()) // Remove delegate bindings when component is valid. 
 	{
-		NeedsComponent->OnNeedsUpdated.RemoveDynamic(this, &UVillagerNeedsWidget::HandleNeedsUpdated); // Unbind update callbacks. 
+		NeedsComponent->OnNeedsChanged.Remove(NeedsChangedHandle); // Unbind update callbacks. 
+	}
+
+	if (SocialComponent.IsValid()) // Remove affection bindings when component is valid.
+	{
+		SocialComponent->OnAffectionChanged.Remove(AffectionChangedHandle); // Unbind affection callbacks.
 	}
 
 	Super::NativeDestruct(); // Call the base widget destruction. 
 }
+
+// Applies pending changes at the configured refresh rate. 
+void UVillagerNeedsWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime); // Preserve base ticking. 
+
+	TimeSinceRefresh += InDeltaTime; // Real time, independent of the simulation time scale. 
+	const bool bSampleLazyNeeds = NeedsComponent.IsValid() && NeedsComponent->IsLazyEvaluation(); // Lazy needs drift between anchors without notifications. 
+	if (!bHasPendingChanges && !bSampleLazyNeeds) // Nothing to show. 
+	{
+		return; // Exit without touching the rows. 
+	}
+
+	if (RefreshRateHz > 0.0f && TimeSinceRefresh < 1.0f / RefreshRateHz) // Refreshed too recently. 
+	{
+		return; // Keep coalescing changes. 
+	}
+
+	FlushPendingChanges(); // Apply the coalesced changes. 
+}
 #pragma endregion Lifecycle
 
 // Region: Public API. 
@@ -80,10 +144,18 @@ void UVillagerNeedsWidget::InitializeFromNeedsAndSocial(UVillagerNeedsComponent*
 {
 	if (NeedsComponent.IsValid()) // Remove existing bindings before reassigning. 
 	{
-		NeedsComponent->OnNeedsUpdated.RemoveDynamic(this, &UVillagerNeedsWidget::HandleNeedsUpdated); // Unbind previous updates. 
+		NeedsComponent->OnNeedsChanged.Remove(NeedsChangedHandle); // Unbind previous updates. 
+	}
+
+	if (SocialComponent.IsValid()) // Remove existing affection bindings before reassigning.
+	{
+		SocialComponent->OnAffectionChanged.Remove(AffectionChangedHandle); // Unbind previous affection updates.
 	}
 
 	NeedsComponent = InNeedsComponent; // Cache the new needs component. 
+	DirtyNeeds.Reset(); // Pending changes belonged to the previous component. 
+	bHasPendingChanges = false; // Rows are refreshed below. 
+	bNeedRowsRebuildPending = false; // Rows are rebuilt below. 
 	SocialComponent = InSocialComponent; // Cache the social component. 
 
 	if (!NeedsListBox || !VillagerIdText || !AffectionListBox) // Build fallback layout when required widgets are missing. 
@@ -99,7 +171,12 @@ void UVillagerNeedsWidget::InitializeFromNeedsAndSocial(UVillagerNeedsComponent*
 
 	if (NeedsComponent.IsValid()) // Bind update events when a component is available. 
 	{
-		NeedsComponent->OnNeedsUpdated.AddDynamic(this, &UVillagerNeedsWidget::HandleNeedsUpdated); // Bind to needs updates. 
+		NeedsChangedHandle = NeedsComponent->OnNeedsChanged.AddUObject(this, &UVillagerNeedsWidget::HandleNeedsChanged); // Bind to coalesced needs changes. 
+	}
+
+	if (SocialComponent.IsValid()) // Bind affection events when a component is available.
+	{
+		AffectionChangedHandle = SocialComponent->OnAffectionChanged.AddUObject(this, &UVillagerNeedsWidget::HandleAffectionChanged); // Refresh affections that change without a need change.
 	}
 }
 #pragma endregion PublicAPI
@@ -141,7 +218,7 @@ void UVillagerNeedsWidget::RebuildNeedRows()
 		return; // Exit when the list box is missing. 
 	}
 
-	NeedRowMap.Reset(); // Clear cached row references. 
+	NeedRows.Reset(); // Clear cached row references. 
 	NeedsListBox->ClearChildren(); // Remove existing row widgets. 
 
 	if (!NeedsComponent.IsValid()) // Ensure a valid needs component is assigned. 
@@ -149,23 +226,23 @@ void UVillagerNeedsWidget::RebuildNeedRows()
 		return; // Exit when no needs component is available. 
 	}
 
-	const TArray<FNeedRuntimeState>& RuntimeNeeds = NeedsComponent->GetRuntimeNeeds(); // Retrieve runtime needs. 
-	for (const FNeedRuntimeState& Need : RuntimeNeeds) // Iterate each need definition. 
+	const int32 NeedCount = NeedsComponent->GetNeedCount(); // Number of tracked needs. 
+	for (int32 NeedIndex = 0; NeedIndex < NeedCount; ++NeedIndex) // Iterate each need definition. 
 	{
+		const FGameplayTag& NeedTag = NeedsComponent->GetNeedDefinition(NeedIndex).NeedTag; // Resolve the need tag. 
 		UHorizontalBox* RowBox = WidgetTree->ConstructWidget<UHorizontalBox>(UHorizontalBox::StaticClass()); // Create a row container. 
 		UTextBlock* LabelText = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass()); // Create label text widget. 
 		UTextBlock* ValueText = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass()); // Create value text widget. 
 
-		LabelText->SetText(FText::FromString(Need.NeedTag.ToString())); // Set the label to the need tag. 
+		LabelText->SetText(FText::FromString(NeedTag.ToString())); // Set the label to the need tag. 
 
 		RowBox->AddChildToHorizontalBox(LabelText); // Add the label to the row. 
 		RowBox->AddChildToHorizontalBox(ValueText); // Add the value text to the row. 
 		NeedsListBox->AddChildToVerticalBox(RowBox); // Add the row to the vertical list. 
 
-		FNeedRowWidgets RowWidgets; // Allocate a row widget container. 
+		FNeedRowWidgets& RowWidgets = NeedRows.AddDefaulted_GetRef(); // Allocate a row widget container at the need index. 
 		RowWidgets.LabelText = LabelText; // Cache the label widget. 
 		RowWidgets.ValueText = ValueText; // Cache the value widget. 
-		NeedRowMap.Add(Need.NeedTag, RowWidgets); // Store the row widgets by tag. 
 	}
 }
 
@@ -185,8 +262,7 @@ void UVillagerNeedsWidget::RebuildAffectionRows()
 		return; // Nothing to show.
 	}
 
-	const TMap<FGameplayTag, float> AffectionSnapshot = SocialComponent->GetAffectionSnapshot(); // Fetch snapshot.
-	for (const TPair<FGameplayTag, float>& Pair : AffectionSnapshot) // Iterate entries.
+	for (const TPair<FGameplayTag, float>& Pair : SocialComponent->GetAffections()) // Iterate entries without copying the map.
 	{
 		UHorizontalBox* RowBox = WidgetTree->ConstructWidget<UHorizontalBox>(UHorizontalBox::StaticClass()); // Create row.
 		UTextBlock* LabelText = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass()); // Create label.
@@ -213,26 +289,30 @@ void UVillagerNeedsWidget::RefreshNeeds()
 		return; // Exit when dependencies are missing. 
 	}
 
-	const TArray<FNeedRuntimeState>& RuntimeNeeds = NeedsComponent->GetRuntimeNeeds(); // Retrieve runtime needs. 
-	for (const FNeedRuntimeState& Need : RuntimeNeeds) // Iterate each runtime need. 
+	const int32 NeedCount = NeedsComponent->GetNeedCount(); // Number of tracked needs. 
+	for (int32 NeedIndex = 0; NeedIndex < NeedCount; ++NeedIndex) // Iterate each runtime need. 
 	{
-		FNeedRowWidgets* RowWidgets = NeedRowMap.Find(Need.NeedTag); // Locate the widget row for this need. 
-		if (!RowWidgets) // Rebuild rows if any entry is missing. 
-		{
-			RebuildNeedRows(); // Rebuild the row layout for missing entries. 
-			RowWidgets = NeedRowMap.Find(Need.NeedTag); // Attempt to locate the row again. 
-		}
+		RefreshNeedRow(NeedIndex); // Update the row for this need. 
+	}
+}
 
-		if (!RowWidgets) // Skip when no row can be found. 
-		{
-			continue; // Continue to the next need entry. 
-		}
+// Refreshes the row of a single need. 
+void UVillagerNeedsWidget::RefreshNeedRow(int32 NeedIndex)
+{
+	if (!NeedsComponent.IsValid() || !NeedsComponent->IsValidNeedIndex(NeedIndex)) // Validate the need. 
+	{
+		return; // Exit when the need is unknown. 
+	}
 
-		if (RowWidgets->ValueText) // Update the value text when available. 
-		{
-			const FString ValueString = FString::Printf(TEXT("%.3f"), Need.CurrentValue); // Format the numeric value with more precision. 
-			RowWidgets->ValueText->SetText(FText::FromString(ValueString)); // Apply the formatted value text. 
-		}
+	if (!NeedRows.IsValidIndex(NeedIndex)) // Rebuild rows if the entry is missing. 
+	{
+		RebuildNeedRows(); // Rebuild the row layout for missing entries. 
+	}
+
+	if (NeedRows.IsValidIndex(NeedIndex)) // Update the value text when available. 
+	{
+		FNeedRowWidgets& RowWidgets = NeedRows[NeedIndex]; // Locate the widget row for this need. 
+		SetValueTextIfChanged(RowWidgets.ValueText, RowWidgets.DisplayedValue, NeedsComponent->GetNeedValue(NeedIndex), NeedValueScale, GetNeedValueFormat()); // Three decimals. 
 	}
 }
 
@@ -244,8 +324,7 @@ void UVillagerNeedsWidget::RefreshAffections()
 		return; // Exit if missing.
 	}
 
-	const TMap<FGameplayTag, float> AffectionSnapshot = SocialComponent->GetAffectionSnapshot(); // Fetch snapshot.
-	for (const TPair<FGameplayTag, float>& Pair : AffectionSnapshot) // Iterate entries.
+	for (const TPair<FGameplayTag, float>& Pair : SocialComponent->GetAffections()) // Iterate entries without copying the map.
 	{
 		FAffectionRowWidgets* RowWidgets = AffectionRowMap.Find(Pair.Key); // Find row.
 		if (!RowWidgets) // Rebuild if missing.
@@ -259,32 +338,73 @@ void UVillagerNeedsWidget::RefreshAffections()
 			continue; // Continue loop.
 		}
 
-		if (RowWidgets->ValueText) // Update value.
-		{
-			const FString ValueString = FString::Printf(TEXT("%.2f"), Pair.Value); // Format value.
-			RowWidgets->ValueText->SetText(FText::FromString(ValueString)); // Apply text.
-		}
+		SetValueTextIfChanged(RowWidgets->ValueText, RowWidgets->DisplayedValue, Pair.Value, AffectionValueScale, GetAffectionValueFormat()); // Two decimals.
 	}
 }
 
-// Handles needs updates from the component. 
-void UVillagerNeedsWidget::HandleNeedsUpdated(UVillagerNeedsComponent* UpdatedComponent)
+// Records coalesced needs changes from the component for the next refresh. 
+void UVillagerNeedsWidget::HandleNeedsChanged(UVillagerNeedsComponent* UpdatedComponent, const FVillagerNeedsChangeSet& ChangeSet)
 {
 	if (NeedsComponent.Get() != UpdatedComponent) // Ignore updates from unrelated components. 
 	{
 		return; // Exit when the update does not match this widget. 
 	}
 
-	RefreshVillagerId(); // Keep villager id text in sync. 
-	RefreshNeeds(); // Refresh the UI with the latest values. 
-	RefreshAffections(); // Refresh affection values. 
+	if (ChangeSet.bNeedsRebuilt) // Need list changed with the archetype. 
+	{
+		bNeedRowsRebuildPending = true; // Recreate every row at the next refresh. 
+	}
+
+	for (const int32 NeedIndex : ChangeSet.ChangedNeedIndices) // Remember which rows changed. 
+	{
+		if (NeedIndex >= DirtyNeeds.Num()) // Grow the set for new needs. 
+		{
+			DirtyNeeds.Add(false, NeedIndex + 1 - DirtyNeeds.Num()); // Extend with clean bits. 
+		}
+		DirtyNeeds[NeedIndex] = true; // Mark the row dirty. 
+	}
+
+	bHasPendingChanges = true; // Affections are refreshed alongside needs. 
+}
+
+// Records affection changes from the social component for the next refresh.
+void UVillagerNeedsWidget::HandleAffectionChanged(UVillagerSocialComponent* UpdatedComponent)
+{
+	if (SocialComponent.Get() != UpdatedComponent) // Ignore updates from unrelated components.
+	{
+		return; // Exit when the update does not match this widget.
+	}
+
+	bHasPendingChanges = true; // Refresh affections at the next throttled refresh.
 }
 
-// Normalizes a need value into the 0-1 range. 
-float UVillagerNeedsWidget::NormalizeNeedValue(const FNeedRuntimeState& Need) const
+// Applies the changes recorded since the last refresh. 
+void UVillagerNeedsWidget::FlushPendingChanges()
 {
-	const float Range = FMath::Max(KINDA_SMALL_NUMBER, Need.Definition.MaxValue - Need.Definition.MinValue); // Compute a safe value range. 
-	return (Need.CurrentValue - Need.Definition.MinValue) / Range; // Return the normalized value. 
+	bHasPendingChanges = false; // Consume the pending changes. 
+	TimeSinceRefresh = 0.0f; // Restart the refresh interval. 
+
+	if (bNeedRowsRebuildPending) // Need list changed with the archetype. 
+	{
+		bNeedRowsRebuildPending = false; // Consume the rebuild. 
+		RebuildNeedRows(); // Recreate rows for the new needs. 
+		RefreshVillagerId(); // Keep villager id text in sync. 
+		RefreshNeeds(); // Populate every row. 
+	}
+	else if (NeedsComponent.IsValid() && NeedsComponent->IsLazyEvaluation()) // Values drift without change notifications. 
+	{
+		RefreshNeeds(); // Sample every row; unchanged text is skipped per row. 
+	}
+	else
+	{
+		for (TConstSetBitIterator<> It(DirtyNeeds); It; ++It) // Only touch rows whose value changed. 
+		{
+			RefreshNeedRow(It.GetIndex()); // Update the changed row. 
+		}
+	}
+
+	DirtyNeeds.SetRange(0, DirtyNeeds.Num(), false); // Clear without releasing the bits. 
+	RefreshAffections(); // Refresh affection values. 
 }
 
 // Refreshes the villager identifier text.
@@ -0,0 +1,402 @@
+// Includes the commandlet header for definitions.
+#include "Tools/SimulationBenchmarkCommandlet.h" // Commandlet declaration header.
+
+// Region: Engine includes.
+#pragma region EngineIncludes // Begin engine include region.
+#include "Engine/Engine.h" // Provides world context management.
+#include "Engine/World.h" // Provides world creation and ticking.
+#include "GameFramework/GameModeBase.h" // Provides game mode setup for play.
+#include "NavigationSystem.h" // Provides navmesh projection for spawn points.
+#include "HAL/PlatformTime.h" // Provides high resolution timing.
+#include "Misc/FileHelper.h" // Provides CSV file output.
+#include "Misc/Parse.h" // Provides command line parsing.
+#include "UObject/Package.h" // Provides map package loading.
+#pragma endregion EngineIncludes // End engine include region.
+
+// Region: Simulation includes.
+#pragma region SimulationIncludes // Begin simulation include region.
+#include "Simulation/Activities/VillageDecisionSubsystem.h" // Provides the village-wide decision stage toggle.
+#include "Simulation/Core/VillageSimProfiler.h" // Provides per-stage timing buckets.
+#include "Simulation/Examples/ExampleVillagerCharacter.h" // Provides the spawned villager type.
+#include "Simulation/Examples/ExampleVillagerPawn.h" // Provides the lightweight villager type.
+#include "Simulation/Logging/VillagerLogComponent.h" // Provides the on-screen debug toggle.
+#include "Simulation/Mass/VillageMassSubsystem.h" // Provides the Mass villager backend.
+#include "Simulation/Movement/VillagerMovementComponent.h" // Provides the abstract travel toggle.
+#include "Simulation/Needs/VillageNeedsSubsystem.h" // Provides the village-wide needs stage toggle.
+#include "Simulation/Needs/VillagerNeedsComponent.h" // Provides the lazy need evaluation toggle.
+#include "Simulation/Time/VillageClockSubsystem.h" // Provides the clock driven by the benchmark.
+#pragma endregion SimulationIncludes // End simulation include region.
+
+// Defines a local log category for benchmark output.
+DEFINE_LOG_CATEGORY_STATIC(LogSimulationBenchmark, Log, All); // Local log category.
+
+// Region: Local constants.
+#pragma region LocalConstants // Begin local constants region.
+namespace // Anonymous namespace to restrict linkage scope.
+{
+	static const TCHAR* ArchetypePaths[] = // Archetypes produced by the asset generation commandlet.
+	{
+		TEXT("/Game/Programming/DataAsset/Villager/DA_WaterProviderVillager.DA_WaterProviderVillager"), // Water provider.
+		TEXT("/Game/Programming/DataAsset/Villager/DA_FoodProviderVillager.DA_FoodProviderVillager"), // Food provider.
+		TEXT("/Game/Programming/DataAsset/Villager/DA_CottonProviderVillager.DA_CottonProviderVillager"), // Cotton provider.
+	};
+	static const int32 MinutesPerDay = 24 * 60; // In-game minutes per day.
+	static const float SpawnSpacing = 150.0f; // Distance between spawned villagers.
+	static const FVector SpawnProjectionExtent(500.0f, 500.0f, 1000.0f); // Navmesh projection extent for spawn points.
+} // End anonymous namespace.
+#pragma endregion LocalConstants // End local constants region.
+
+// Region: Commandlet lifecycle.
+#pragma region CommandletLifecycle // Begin commandlet lifecycle region.
+USimulationBenchmarkCommandlet::USimulationBenchmarkCommandlet() // Constructor definition.
+	: VillagerCount(100) // Default villager population.
+	, SimDays(1) // Default simulated duration.
+	, TickSeconds(1.0f) // Match the default clock cadence.
+	, bValidateCurves(false) // Skip curve validation by default.
+	, bSerialNeeds(false) // Use the village-wide needs stage by default.
+	, bSerialDecisions(false) // Use the village-wide decision stage by default.
+	, bLazyNeeds(false) // Integrate needs every minute by default.
+	, bMassVillagers(false) // Spawn actor villagers by default.
+	, bFullLocomotion(false) // Let unobserved villagers travel abstractly by default.
+	, bLightweightVillagers(false) // Spawn character villagers by default.
+	, LastMassVillagerCount(INDEX_NONE) // No run yet.
+	, TotalSeconds(0.0) // No time measured yet.
+{
+	IsClient = false; // Disable client behavior.
+	IsServer = false; // Disable server behavior.
+	IsEditor = false; // Run without editor-only systems.
+	LogToConsole = true; // Enable console logging.
+} // End constructor.
+
+int32 USimulationBenchmarkCommandlet::Main(const FString& Params) // Main commandlet entry point.
+{
+	ParseOptions(Params); // Read command line options.
+
+	if (!LoadArchetypes()) // Ensure there is something to spawn.
+	{
+		UE_LOG(LogSimulationBenchmark, Error, TEXT("No villager archetypes could be loaded; run GenerateVillagerAssets first.")); // Log missing assets.
+		return 1; // Return failure code.
+	}
+
+	if (bValidateCurves) // Report table accuracy before timing.
+	{
+		ValidateCurveTables(); // Rebake with validation enabled.
+	}
+
+	UWorld* World = CreateBenchmarkWorld(); // Prepare the world.
+	if (!World) // Validate world creation.
+	{
+		UE_LOG(LogSimulationBenchmark, Error, TEXT("Failed to create benchmark world.")); // Log world failure.
+		return 1; // Return failure code.
+	}
+
+	if (UVillageNeedsSubsystem* NeedsStage = World->GetSubsystem<UVillageNeedsSubsystem>()) // Select the need integration path before villagers start.
+	{
+		NeedsStage->SetStageEnabled(!bSerialNeeds); // Toggle the village-wide stage.
+	}
+
+	if (UVillageDecisionSubsystem* DecisionStage = World->GetSubsystem<UVillageDecisionSubsystem>()) // Select the decision path before villagers start.
+	{
+		DecisionStage->SetStageEnabled(!bSerialDecisions); // Toggle the village-wide decision stage.
+	}
+
+	const int32 SpawnedCount = SpawnVillagers(World); // Populate the village.
+	UE_LOG(LogSimulationBenchmark, Log, TEXT("Spawned %d villagers; simulating %d day(s)."), SpawnedCount, SimDays); // Log setup.
+
+	const bool bRan = RunSimulation(World); // Run the timed loop.
+	if (bRan) // Only report when the loop executed.
+	{
+		ReportResults(SpawnedCount); // Emit the summary.
+	}
+
+	DestroyBenchmarkWorld(World); // Release the world.
+	return bRan ? 0 : 1; // Return status code.
+} // End Main.
+#pragma endregion CommandletLifecycle // End commandlet lifecycle region.
+
+// Region: Setup.
+#pragma region Setup // Begin setup region.
+void USimulationBenchmarkCommandlet::ParseOptions(const FString& Params) // Option parsing routine.
+{
+	FParse::Value(*Params, TEXT("Map="), MapName); // Optional map package.
+	FParse::Value(*Params, TEXT("Csv="), CsvPath); // Optional CSV output.
+	FParse::Value(*Params, TEXT("Villagers="), VillagerCount); // Population size.
+	FParse::Value(*Params, TEXT("Days="), SimDays); // Simulated duration.
+	FParse::Value(*Params, TEXT("TickSeconds="), TickSeconds); // World tick delta.
+	bValidateCurves = FParse::Param(*Params, TEXT("ValidateCurves")); // Optional curve table validation.
+	bSerialNeeds = FParse::Param(*Params, TEXT("SerialNeeds")); // Optional per-villager need integration.
+	bSerialDecisions = FParse::Param(*Params, TEXT("SerialDecisions")); // Optional per-villager decisions.
+	bLazyNeeds = FParse::Param(*Params, TEXT("LazyNeeds")); // Optional lazy need evaluation.
+	bMassVillagers = FParse::Param(*Params, TEXT("Mass")); // Optional Mass entity backend.
+	bFullLocomotion = FParse::Param(*Params, TEXT("FullLocomotion")); // Optional navmesh walking for every move.
+	bLightweightVillagers = FParse::Param(*Params, TEXT("Lightweight")); // Optional lightweight pawn villagers.
+
+	VillagerCount = FMath::Max(0, VillagerCount); // Reject negative populations.
+	SimDays = FMath::Max(1, SimDays); // Simulate at least one day.
+	TickSeconds = FMath::Max(KINDA_SMALL_NUMBER, TickSeconds); // Keep world ticks positive.
+} // End ParseOptions.
+
+void USimulationBenchmarkCommandlet::ValidateCurveTables() // Curve table validation routine.
+{
+	float MaxCurveError = 0.0f; // Worst table across archetypes.
+	for (UVillagerArchetypeDataAsset* Archetype : Archetypes) // Rebake every loaded archetype.
+	{
+		MaxCurveError = FMath::Max(MaxCurveError, Archetype->ValidateCompiledArchetype()); // Rebake and log per-table error.
+	}
+
+	UE_LOG(LogSimulationBenchmark, Display, TEXT("Curve tables: max error %g against source curves."), MaxCurveError); // Overall accuracy.
+} // End ValidateCurveTables.
+
+UWorld* USimulationBenchmarkCommandlet::CreateBenchmarkWorld() // World setup routine.
+{
+	if (!GEngine) // Engine is required for world contexts.
+	{
+		return nullptr; // Abort without engine.
+	}
+
+	UWorld* World = nullptr; // World under test.
+
+	if (!MapName.IsEmpty()) // Load the requested map.
+	{
+		UPackage* MapPackage = LoadPackage(nullptr, *MapName, LOAD_None); // Load the map package.
+		World = MapPackage ? UWorld::FindWorldInPackage(MapPackage) : nullptr; // Resolve the world asset.
+		if (!World) // Validate map load.
+		{
+			UE_LOG(LogSimulationBenchmark, Error, TEXT("Map %s could not be loaded."), *MapName); // Log map failure.
+			return nullptr; // Abort on failure.
+		}
+
+		World->WorldType = EWorldType::Game; // Run the map as a game world.
+		World->AddToRoot(); // Prevent collection during the run.
+
+		if (!World->bIsWorldInitialized) // Initialize loaded worlds once.
+		{
+			World->InitWorld(UWorld::InitializationValues().AllowAudioPlayback(false).CreatePhysicsScene(true).CreateNavigation(true).CreateAISystem(true).ShouldSimulatePhysics(false).EnableTraceCollision(true)); // Initialize with navigation and AI.
+		}
+	}
+	else // Fall back to an empty world.
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("VillageBenchmarkWorld")); // Create and initialize a blank world.
+		if (!World) // Validate creation.
+		{
+			return nullptr; // Abort on failure.
+		}
+
+		World->AddToRoot(); // Prevent collection during the run.
+		UE_LOG(LogSimulationBenchmark, Warning, TEXT("No -Map supplied; villagers will run without tagged locations or navigation.")); // Warn about reduced coverage.
+	}
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game); // Register the world with the engine.
+	WorldContext.SetCurrentWorld(World); // Bind the world to the context.
+
+	World->UpdateWorldComponents(true, false); // Register actor components.
+	World->SetGameMode(FURL()); // Spawn the authority game mode.
+	World->InitializeActorsForPlay(FURL()); // Prepare actors for play.
+	World->BeginPlay(); // Begin play for placed actors and subsystems.
+
+	return World; // Provide the ready world.
+} // End CreateBenchmarkWorld.
+
+void USimulationBenchmarkCommandlet::DestroyBenchmarkWorld(UWorld* World) // World teardown routine.
+{
+	if (!World) // Nothing to release.
+	{
+		return; // Skip teardown.
+	}
+
+	World->EndPlay(EEndPlayReason::Quit); // End play for every actor.
+
+	if (GEngine) // Unregister the world context.
+	{
+		GEngine->DestroyWorldContext(World); // Remove the context.
+	}
+
+	World->DestroyWorld(false); // Release world resources.
+	World->RemoveFromRoot(); // Allow collection.
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS); // Reclaim memory.
+} // End DestroyBenchmarkWorld.
+
+bool USimulationBenchmarkCommandlet::LoadArchetypes() // Archetype loading routine.
+{
+	Archetypes.Reset(); // Start from an empty list.
+
+	for (const TCHAR* ArchetypePath : ArchetypePaths) // Load every known archetype.
+	{
+		if (UVillagerArchetypeDataAsset* Archetype = LoadObject<UVillagerArchetypeDataAsset>(nullptr, ArchetypePath)) // Attempt the load.
+		{
+			Archetypes.Add(Archetype); // Keep the loaded asset.
+		}
+		else // Asset missing.
+		{
+			UE_LOG(LogSimulationBenchmark, Warning, TEXT("Archetype %s is missing."), ArchetypePath); // Log missing archetype.
+		}
+	}
+
+	return Archetypes.Num() > 0; // Require at least one archetype.
+} // End LoadArchetypes.
+
+int32 USimulationBenchmarkCommandlet::SpawnVillagers(UWorld* World) // Villager spawning routine.
+{
+	UVillagerLogComponent::SetOnScreenDebugEnabled(false); // Skip on-screen messages in headless runs.
+	UVillagerMovementComponent::SetAbstractTravelEnabled(!bFullLocomotion); // Headless villagers are never rendered, so every move is abstract unless disabled.
+
+	UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World); // Optional navmesh for spawn points.
+	const int32 GridWidth = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<float>(VillagerCount)))); // Square grid dimension.
+	const float GridOffset = 0.5f * SpawnSpacing * (GridWidth - 1); // Center the grid on the origin.
+
+	int32 SpawnedCount = 0; // Successful spawns.
+
+	UVillageMassSubsystem* MassSubsystem = bMassVillagers ? World->GetSubsystem<UVillageMassSubsystem>() : nullptr; // Entity backend when requested.
+	if (bMassVillagers && !MassSubsystem) // Validate the backend.
+	{
+		UE_LOG(LogSimulationBenchmark, Error, TEXT("Village Mass subsystem is unavailable.")); // Log missing backend.
+		return 0; // Nothing spawned.
+	}
+
+	for (int32 VillagerIndex = 0; VillagerIndex < VillagerCount; ++VillagerIndex) // Spawn each villager.
+	{
+		FVector SpawnLocation((VillagerIndex % GridWidth) * SpawnSpacing - GridOffset, (VillagerIndex / GridWidth) * SpawnSpacing - GridOffset, 100.0f); // Grid position.
+
+		FNavLocation NavLocation; // Projected spawn point.
+		if (NavSystem && NavSystem->ProjectPointToNavigation(SpawnLocation, NavLocation, SpawnProjectionExtent)) // Snap onto the navmesh when available.
+		{
+			SpawnLocation = NavLocation.Location + FVector(0.0f, 0.0f, bLightweightVillagers ? 0.0f : 100.0f); // Lift above the floor for the capsule; pawns stand on the navmesh.
+		}
+
+		if (MassSubsystem) // Spawn an entity instead of an actor.
+		{
+			SpawnedCount += MassSubsystem->SpawnVillager(Archetypes[VillagerIndex % Archetypes.Num()], SpawnLocation) ? 1 : 0; // Assign archetypes round-robin.
+			continue; // No actor to configure.
+		}
+
+		const FTransform SpawnTransform(SpawnLocation); // Spawn transform.
+		UClass* VillagerClass = bLightweightVillagers ? AExampleVillagerPawn::StaticClass() : AExampleVillagerCharacter::StaticClass(); // Requested villager type.
+		APawn* Villager = World->SpawnActorDeferred<APawn>(VillagerClass, SpawnTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn); // Defer so the archetype is set before BeginPlay.
+		if (!Villager) // Validate spawn.
+		{
+			continue; // Skip failed spawns.
+		}
+
+		UVillagerArchetypeDataAsset* Archetype = Archetypes[VillagerIndex % Archetypes.Num()]; // Assign archetypes round-robin.
+		if (AExampleVillagerPawn* LightweightVillager = Cast<AExampleVillagerPawn>(Villager)) // Lightweight pawn.
+		{
+			LightweightVillager->SetArchetypeData(Archetype); // Apply archetype.
+		}
+		else if (AExampleVillagerCharacter* CharacterVillager = Cast<AExampleVillagerCharacter>(Villager)) // Character.
+		{
+			CharacterVillager->SetArchetypeData(Archetype); // Apply archetype.
+		}
+		if (UVillagerNeedsComponent* NeedsComponent = Villager->FindComponentByClass<UVillagerNeedsComponent>()) // Select the need evaluation mode.
+		{
+			NeedsComponent->SetLazyEvaluation(bLazyNeeds); // Lazy or per-minute needs.
+		}
+		Villager->FinishSpawning(SpawnTransform); // Complete the spawn and run BeginPlay.
+		++SpawnedCount; // Count the villager.
+	}
+
+	return SpawnedCount; // Report spawned population.
+} // End SpawnVillagers.
+#pragma endregion Setup // End setup region.
+
+// Region: Simulation.
+#pragma region Simulation // Begin simulation region.
+bool USimulationBenchmarkCommandlet::RunSimulation(UWorld* World) // Simulation loop.
+{
+	UVillageClockSubsystem* ClockSubsystem = World->GetSubsystem<UVillageClockSubsystem>(); // Resolve the clock.
+	if (!ClockSubsystem) // Validate clock availability.
+	{
+		UE_LOG(LogSimulationBenchmark, Error, TEXT("Village clock subsystem is unavailable.")); // Log missing clock.
+		return false; // Abort on failure.
+	}
+
+	ClockSubsystem->StopClock(); // The benchmark advances minutes explicitly.
+
+	const int32 TotalMinutesToRun = SimDays * MinutesPerDay; // Minutes to simulate.
+	MinuteCosts.Reset(TotalMinutesToRun); // Reserve sample storage.
+	ClockCosts.Reset(TotalMinutesToRun); // Reserve sample storage.
+
+	FVillageSimProfiler::Reset(); // Start with empty buckets.
+	FVillageSimProfiler::SetEnabled(true); // Collect per-stage samples.
+
+	const double LoopStart = FPlatformTime::Seconds(); // Loop start time.
+
+	for (int32 MinuteIndex = 0; MinuteIndex < TotalMinutesToRun; ++MinuteIndex) // Simulate every minute.
+	{
+		const double MinuteStart = FPlatformTime::Seconds(); // Minute start time.
+
+		ClockSubsystem->AdvanceMinutes(1); // Run wakeups for the minute.
+
+		const double ClockEnd = FPlatformTime::Seconds(); // Clock end time.
+
+		World->Tick(LEVELTICK_All, TickSeconds); // Progress movement, timers and actors.
+
+		const double MinuteEnd = FPlatformTime::Seconds(); // Minute end time.
+
+		ClockCosts.Add(ClockEnd - MinuteStart); // Record clock cost.
+		MinuteCosts.Add(MinuteEnd - MinuteStart); // Record full minute cost.
+	}
+
+	TotalSeconds = FPlatformTime::Seconds() - LoopStart; // Record loop time.
+
+	if (const UVillageMassSubsystem* MassSubsystem = World->GetSubsystem<UVillageMassSubsystem>()) // Record Mass survivors.
+	{
+		LastMassVillagerCount = MassSubsystem->GetVillagerCount(); // Entities alive after the run.
+	}
+
+	FVillageSimProfiler::SetEnabled(false); // Stop collecting samples.
+
+	return true; // Report success.
+} // End RunSimulation.
+
+void USimulationBenchmarkCommandlet::ReportResults(int32 SpawnedCount) const // Reporting routine.
+{
+	if (MinuteCosts.Num() == 0 || TotalSeconds <= 0.0) // Guard against empty runs.
+	{
+		return; // Nothing to report.
+	}
+
+	TArray<double> SortedCosts = MinuteCosts; // Copy for percentile computation.
+	SortedCosts.Sort(); // Ascending order.
+
+	const int32 P99Index = FMath::Clamp(FMath::CeilToInt(0.99 * SortedCosts.Num()) - 1, 0, SortedCosts.Num() - 1); // Nearest-rank 99th percentile.
+
+	double ClockTotal = 0.0; // Sum of clock samples.
+	for (const double ClockCost : ClockCosts) // Accumulate clock cost.
+	{
+		ClockTotal += ClockCost; // Add sample.
+	}
+
+	const int32 MinuteCount = MinuteCosts.Num(); // Simulated minutes.
+	UE_LOG(LogSimulationBenchmark, Display, TEXT("Villagers: %d, simulated minutes: %d, wall time: %.3f s"), SpawnedCount, MinuteCount, TotalSeconds); // Run size.
+	UE_LOG(LogSimulationBenchmark, Display, TEXT("Throughput: %.1f sim-minutes/s"), MinuteCount / TotalSeconds); // Throughput.
+	if (bMassVillagers && LastMassVillagerCount >= 0) // Mass villagers die without destroying actors.
+	{
+		UE_LOG(LogSimulationBenchmark, Display, TEXT("Mass villagers alive at the end: %d"), LastMassVillagerCount); // Survivors.
+	}
+	UE_LOG(LogSimulationBenchmark, Display, TEXT("Per minute: avg %.3f ms, p99 %.3f ms, max %.3f ms (clock avg %.3f ms)"), 1000.0 * TotalSeconds / MinuteCount, 1000.0 * SortedCosts[P99Index], 1000.0 * SortedCosts.Last(), 1000.0 * ClockTotal / MinuteCount); // Per-minute cost.
+
+	for (int32 BucketIndex = 0; BucketIndex < static_cast<int32>(EVillageSimBucket::Count); ++BucketIndex) // Report each stage.
+	{
+		const EVillageSimBucket Bucket = static_cast<EVillageSimBucket>(BucketIndex); // Resolve bucket.
+		const double BucketSeconds = FVillageSimProfiler::GetSeconds(Bucket); // Accumulated time.
+		UE_LOG(LogSimulationBenchmark, Display, TEXT("  %-18s %10.3f ms exclusive, %8.4f ms/minute, %10llu calls"), FVillageSimProfiler::GetBucketName(Bucket), 1000.0 * BucketSeconds, 1000.0 * BucketSeconds / MinuteCount, FVillageSimProfiler::GetCallCount(Bucket)); // Stage cost.
+	}
+
+	if (!CsvPath.IsEmpty()) // Write per-minute samples when requested.
+	{
+		TArray<FString> Lines; // CSV rows.
+		Lines.Reserve(MinuteCount + 1); // One row per minute plus header.
+		Lines.Add(TEXT("Minute,TotalMs,ClockMs")); // Header row.
+
+		for (int32 MinuteIndex = 0; MinuteIndex < MinuteCount; ++MinuteIndex) // Emit each sample.
+		{
+			Lines.Add(FString::Printf(TEXT("%d,%.4f,%.4f"), MinuteIndex, 1000.0 * MinuteCosts[MinuteIndex], 1000.0 * ClockCosts[MinuteIndex])); // Sample row.
+		}
+
+		if (!FFileHelper::SaveStringArrayToFile(Lines, *CsvPath)) // Persist the file.
+		{
+			UE_LOG(LogSimulationBenchmark, Warning, TEXT("Failed to write CSV to %s"), *CsvPath); // Log write failure.
+		}
+	}
+} // End ReportResults.
+#pragma endregion Simulation // End simulation region.
@@ -0,0 +1,104 @@
+// Prevents multiple inclusion of the decision stage header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Core types and macros.
+#include "CoreMinimal.h"
+// Base world subsystem for per-world lifetime.
+#include "Subsystems/WorldSubsystem.h"
+// Provides stable keys for queued components.
+#include "UObject/ObjectKey.h"
+#pragma endregion Includes
+
+// Generated header required for reflection.
+#include "VillageDecisionSubsystem.generated.h"
+
+// Forward declare the component whose decisions the stage evaluates.
+class UVillagerActivityComponent;
+
+// Kinds of activity decisions a villager can request.
+enum class EVillagerDecisionKind : uint8
+{
+	PlanNext, // Pick the next activity after the previous one ended.
+	Interruption // Roll whether an urgent need interrupts the running PartOfDay activity.
+};
+
+// Outcome of a read-only decision evaluation, applied later on the game thread.
+// Starting the activity issues its moves, reservations and trades; skipped satisfiers are logged when applied.
+struct FVillagerDecisionCommand
+{
+	// Decision that produced the command.
+	EVillagerDecisionKind Kind = EVillagerDecisionKind::PlanNext;
+
+	// Activity to begin, or INDEX_NONE to leave the villager as it is.
+	int32 ActivityIndex = INDEX_NONE;
+
+	// Need the activity satisfies, or INDEX_NONE for scheduled activities.
+	int32 NeedIndex = INDEX_NONE;
+
+	// Need-satisfying activities skipped because of a provider cooldown, in evaluation order.
+	TArray<int32, TInlineAllocator<2>> CooldownSkippedActivities;
+};
+
+// Village-wide decision stage evaluating the activity decisions requested during a minute's wakeups in parallel.
+// Evaluation only reads villager, needs, schedule and clock state and emits one command per villager; the commands
+// are then applied on the game thread in request order, which is where activities start and the world is touched.
+UCLASS()
+class UVillageDecisionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+public:
+	// Ensure creation for all worlds.
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
+
+	// Binds to the clock's decision phase.
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	// Unbinds from the clock and drops pending requests.
+	virtual void Deinitialize() override;
+
+	// Returns whether a decision requested now can be deferred to the current minute's decision phase.
+	bool CanDeferDecisions() const;
+
+	// Queues a villager's decision for the decision phase; a later request from the same villager replaces the earlier one.
+	void QueueDecision(UVillagerActivityComponent* ActivityComponent, EVillagerDecisionKind Kind);
+
+	// Returns whether the stage defers decisions; when disabled villagers decide immediately.
+	bool IsStageEnabled() const { return bStageEnabled; }
+
+	// Enables or disables the stage.
+	void SetStageEnabled(bool bInEnabled);
+
+	// Returns how many decisions the most recent phase evaluated.
+	int32 GetLastStepDecisionCount() const { return LastStepDecisionCount; }
+
+private:
+	// Evaluates every queued decision in parallel, then applies the commands.
+	void ProcessDecisions(int64 Minute);
+
+	// Whether decisions are deferred to the stage.
+	bool bStageEnabled = true;
+
+	// Binding to the clock's decision phase.
+	FDelegateHandle DecisionPhaseHandle;
+
+	// Villagers with a pending decision, in request order.
+	TArray<TWeakObjectPtr<UVillagerActivityComponent>> PendingVillagers;
+
+	// Decision kind requested by each pending villager.
+	TArray<EVillagerDecisionKind> PendingKinds;
+
+	// Slot of each pending villager so repeated requests stay one evaluation.
+	TMap<TObjectKey<UVillagerActivityComponent>, int32> PendingSlots;
+
+	// Villagers evaluated this phase.
+	TArray<UVillagerActivityComponent*> StepVillagers;
+
+	// Command produced for each step villager.
+	TArray<FVillagerDecisionCommand> StepCommands;
+
+	// Decisions evaluated by the most recent phase.
+	int32 LastStepDecisionCount = 0;
+};
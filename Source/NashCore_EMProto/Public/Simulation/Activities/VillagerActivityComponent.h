@@ -19,6 +19,8 @@
 #include "Simulation/Time/VillageClockSubsystem.h"
 // Imports location registry for resolving tagged destinations.
 #include "Simulation/Locations/VillageLocationRegistry.h"
+// Imports decision commands exchanged with the village decision stage.
+#include "Simulation/Activities/VillageDecisionSubsystem.h"
 #pragma endregion Includes
 
 // Generated header include required by Unreal.
@@ -27,6 +29,9 @@
 // Forward declaration for actor pointers used in provider context.
 class AActor;
 
+// Forward declaration of the village-wide needs stage.
+class UVillageNeedsSubsystem;
+
 // Represents the current activity runtime state.
 USTRUCT(BlueprintType)
 struct FActivityRuntimeState
@@ -82,6 +87,9 @@ public:
 	// Initializes component references and subscribes to the clock.
 	virtual void BeginPlay() override;
 
+	// Cancels pending clock wakeups before the component goes away.
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// Starts the next planned activity based on day order and current time.
 	void StartNextPlannedActivity();
 
@@ -97,11 +105,50 @@ public:
 	// Sets the archetype asset to drive activity selection.
 	void SetArchetype(UVillagerArchetypeDataAsset* InArchetype);
 
+	// Sets whether BeginPlay starts the first planned activity; owners resuming a known activity disable it before spawning finishes.
+	void SetAutoStartEnabled(bool bEnabled) { bAutoStartOnBeginPlay = bEnabled; }
+
+	// Returns the needs component driven by the active activity.
+	UVillagerNeedsComponent* GetNeedsComponent() const;
+
+	// Provides the curves and elapsed activity minute the village needs stage integrates for a minute; false when nothing applies.
+	bool GetNeedsStageInput(int64 Minute, float& OutElapsedMinutes, TConstArrayView<FVillagerCompiledNeedCurve>& OutCurves) const;
+
+	// Re-evaluates the next wakeup after the village needs stage moved a need into another urgency band.
+	void HandleNeedBandCrossed();
+
+	// Evaluates a decision from villager, needs, schedule and clock state without touching the world; safe on worker threads.
+	FVillagerDecisionCommand EvaluateDecision(EVillagerDecisionKind Kind) const;
+
+	// Applies an evaluated decision on the game thread, starting the chosen activity and emitting its logs.
+	void ApplyDecision(const FVillagerDecisionCommand& Command);
+
 private:
-	// Callback for the village clock minute tick to advance activity time.
-	UFUNCTION()
+	// Processes a simulated minute for the active activity: completion, need deltas and interruptions.
 	void OnMinuteTick(int32 Hour, int32 Minute);
 
+	// Handles a scheduled clock wakeup by catching up skipped minutes and processing the current one.
+	void HandleWakeup();
+
+	// Applies the need deltas of minutes that elapsed without a wakeup, up to and including UpToMinute.
+	void CatchUpSkippedMinutes(int64 UpToMinute);
+
+	// Integrates every minute up to the current clock minute before the activity state changes outside a wakeup.
+	void SyncToCurrentMinute();
+
+	// Registers the next minute at which this villager needs attention with the clock.
+	void ScheduleNextWakeup();
+
+	// Computes how many minutes may pass before the active activity needs to be processed again.
+	int64 ComputeMinutesUntilAttention() const;
+
+	// Returns the minutes until the clock leaves the supplied PartOfDay window.
+	int64 GetMinutesUntilWindowExit(const FActivityTimeWindow& Window) const;
+
+	// Predicts the minutes until any need affected by the activity crosses into a lower urgency band or its minimum,
+	// walking the curves' rate segments up to a horizon; returns MAX_int64 when nothing crosses within it.
+	int64 PredictMinutesUntilNeedBandChange(int64 HorizonMinutes) const;
+
 	// Starts execution of a specific activity definition.
 	void BeginActivity(const FActivityDefinition& Definition);
 
@@ -114,39 +161,66 @@ private:
 	// Applies per-minute need deltas based on the activity curves.
 	void ApplyNeedDeltasForMinute();
 
+	// Returns the compiled need curves of the active activity.
+	TConstArrayView<FVillagerCompiledNeedCurve> GetActiveNeedCurves() const;
+
+	// Returns whether the village needs stage integrates this villager's curves.
+	bool IsNeedsStageActive() const;
+
+	// Returns whether the needs component evaluates needs lazily from rates set by this component.
+	bool IsNeedsLazy() const;
+
+	// Hands the active curves' current rate segments to a lazy needs component.
+	void UpdateLazyNeedRates();
+
+	// Marks the activity inactive and stops any lazy need rates it drove.
+	void MarkActivityInactive();
+
 	// Determines whether the provider is present at the expected trade location.
 	bool IsProviderAtTradeLocation(const FResourceProviderContext& ProviderContext) const;
 
 	// Checks for urgent needs during PartOfDay activities to allow interruption.
 	void RunNeedInterruptionCheck();
 
-	// Determines the probability of forcing the satisfying activity for a need.
-	float GetNeedForceProbability(const FNeedRuntimeState& NeededNeed) const;
+	// Decides immediately, or defers to the village decision stage while the clock runs wakeups.
+	void RequestDecision(EVillagerDecisionKind Kind);
+
+	// Determines the probability of forcing the satisfying activity for a need index.
+	float GetNeedForceProbability(int32 NeedIndex) const;
 
 	// Determines whether the current check should force a need-driven activity.
-	bool ShouldForceNeedActivity(const FNeedRuntimeState& NeededNeed) const;
+	bool ShouldForceNeedActivity(int32 NeedIndex) const;
 
 	// Completes the current activity and transitions back to scheduling.
 	void CompleteCurrentActivity();
 
-	// Attempts to pick an activity that satisfies the highest priority need, respecting force probability.
-	bool TryStartNeedSatisfyingActivity(EVillagerNeedUrgency UrgencyThreshold);
+	// Selects an activity that satisfies the highest priority need, respecting force probability.
+	bool SelectNeedSatisfyingActivity(EVillagerNeedUrgency UrgencyThreshold, FVillagerDecisionCommand& Command) const;
 
-	// Attempts to start the activity that satisfies the specified need.
-	bool TryStartNeedSatisfyingActivity(const FNeedRuntimeState& NeededNeed);
+	// Selects the activity that satisfies the need at the specified index.
+	bool SelectSatisfierForNeed(int32 NeedIndex, FVillagerDecisionCommand& Command) const;
 
-	// Picks the next PartOfDay activity using day order and time windows.
-	bool TryStartScheduledActivity();
+	// Selects the next PartOfDay activity using day order and time windows.
+	bool SelectScheduledActivity(FVillagerDecisionCommand& Command) const;
 
 	// Clears timers bound to the current activity.
 	void ClearActivityTimers();
 
-	// Resolves the location of a provider offering the requested resource.
+	// Resolves the location of the provider offering the requested resource with the lowest travel cost, skipping unreachable trade spots.
 	bool FindResourceProviderLocation(const FGameplayTag& ResourceTag, FResourceProviderContext& OutProviderContext) const;
 
+	// Returns whether the activity location may resolve, using read-only registry lookups.
+	bool CanResolveActivityLocation(const FActivityDefinition& Definition) const;
+
 	// Resolves the target transform for an activity, optionally via the location registry.
 	bool ResolveActivityTransform(const FActivityDefinition& Definition, FTransform& OutTransform);
 
+	// Reserves the nearest free instance of the activity location and returns its transform.
+	bool AcquireActivityLocation(const FActivityDefinition& Definition, FTransform& OutTransform);
+
+	// Releases the location instance reserved for the current activity.
+	void ReleaseActivityLocation();
+
 	// Starts movement toward the actual activity location after resource acquisition.
 	void StartMovementToActivityLocation(FActivityDefinition Definition);
 
@@ -165,6 +239,10 @@ private:
 	// Returns whether an activity is blocked by a provider failure cooldown.
 	bool IsActivityInProviderCooldown(const FGameplayTag& ActivityTag) const;
 
+	// Seeds the decision stream from the world seed, the villager id and the villager's serial; called again when the
+	// archetype is assigned after BeginPlay.
+	void InitializeDecisionStream();
+
 	// Cached pointer to the clock subsystem.
 	UPROPERTY()
 	TObjectPtr<UVillageClockSubsystem> ClockSubsystem;
@@ -173,6 +251,14 @@ private:
 	UPROPERTY()
 	TObjectPtr<UVillagerNeedsComponent> NeedsComponent;
 
+	// Cached pointer to the village needs stage.
+	UPROPERTY()
+	TObjectPtr<UVillageNeedsSubsystem> NeedsStage;
+
+	// Cached pointer to the village decision stage.
+	UPROPERTY()
+	TObjectPtr<UVillageDecisionSubsystem> DecisionStage;
+
 	// Cached pointer to the movement component.
 	UPROPERTY()
 	TObjectPtr<UVillagerMovementComponent> MovementComponent;
@@ -196,6 +282,9 @@ private:
 	// Tracks whether an activity is active.
 	bool bHasActiveActivity;
 
+	// Compiled archetype index of the active activity; INDEX_NONE when unknown.
+	int32 CurrentActivityIndex = INDEX_NONE;
+
 	// Tracks whether the villager is currently fetching a resource prerequisite.
 	bool bFetchingResource = false;
 
@@ -208,6 +297,9 @@ private:
 	// Indicates whether the cached activity transform is valid.
 	bool bHasCachedActivityTransform = false;
 
+	// Location instance reserved for the active activity.
+	FVillageLocationHandle ReservedLocationHandle;
+
 	// Cached provider identifier used for logging during resource fetches.
 	FGameplayTag CachedProviderIdTag;
 
@@ -238,4 +330,29 @@ private:
 
 	// Tracks when specific activities last failed to move, to avoid tight retry loops.
 	TMap<FGameplayTag, double> LastMovementFailureTime;
+
+	// Upper bound (in in-game minutes) between wakeups; also bounds how far ahead need crossings are searched.
+	UPROPERTY(EditAnywhere, Category = "Villager", meta = (ClampMin = "1"))
+	int32 MaxWakeupIntervalMinutes = 60;
+
+	// Handle of the pending clock wakeup for this villager.
+	FVillageWakeupHandle WakeupHandle;
+
+	// Last absolute clock minute whose need deltas have been applied.
+	int64 LastProcessedMinute = 0;
+
+	// Clock minute at which the active activity began; its first delta applies on the following minute.
+	int64 ActivityStartMinute = 0;
+
+	// Random stream for every stochastic decision of this villager; seeded per villager so results do not depend on update order.
+	FRandomStream DecisionStream;
+
+	// Begin-play serial mixed into the decision seed so villagers sharing an archetype draw different streams.
+	uint32 VillagerSerial = 0;
+
+	// Whether VillagerSerial was claimed from the clock.
+	bool bHasVillagerSerial = false;
+
+	// Whether BeginPlay starts the first planned activity.
+	bool bAutoStartOnBeginPlay = true;
 };
@@ -0,0 +1,94 @@
+// Prevents multiple inclusion of the simulation profiler header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Provides core types and platform timing.
+#include "CoreMinimal.h"
+#pragma endregion Includes
+
+// Simulation stages timed by the profiler.
+enum class EVillageSimBucket : uint8
+{
+	Needs, // Need value updates and urgency evaluation.
+	ActivitySelection, // Choosing and starting scheduled or need-driven activities.
+	ProviderSearch, // Locating resource providers and trade locations.
+	Movement, // Issuing and completing navigation requests.
+	Logging, // Composing and buffering villager log lines.
+	Count // Number of buckets; not a real stage.
+};
+
+// Lightweight cycle accumulator for simulation stages, used by the benchmark commandlet.
+// Disabled by default so scopes cost a single branch during normal play; game thread only, scopes opened on
+// worker threads are ignored and parallel stages are timed by their enclosing game-thread scope.
+// Buckets report exclusive time: cycles spent in a nested scope of another bucket are charged to that bucket only,
+// so bucket totals never double count and add up to the time spent inside any scope.
+class FVillageSimProfiler
+{
+public:
+	// Enables or disables sample collection.
+	static void SetEnabled(bool bInEnabled);
+
+	// Returns whether samples are being collected.
+	static bool IsEnabled() { return bEnabled; }
+
+	// Clears every accumulated sample.
+	static void Reset();
+
+	// Returns the accumulated seconds spent in a bucket, excluding nested scopes of other buckets.
+	static double GetSeconds(EVillageSimBucket Bucket);
+
+	// Returns how many outermost scopes were recorded for a bucket.
+	static uint64 GetCallCount(EVillageSimBucket Bucket);
+
+	// Returns a display name for a bucket.
+	static const TCHAR* GetBucketName(EVillageSimBucket Bucket);
+
+private:
+	friend class FVillageSimScope;
+
+	// Whether samples are being collected.
+	static bool bEnabled;
+
+	// Accumulated cycles per bucket.
+	static uint64 BucketCycles[static_cast<int32>(EVillageSimBucket::Count)];
+
+	// Outermost scope count per bucket.
+	static uint64 BucketCalls[static_cast<int32>(EVillageSimBucket::Count)];
+
+	// Open scope depth per bucket so re-entrant stages are only counted once.
+	static int32 BucketDepth[static_cast<int32>(EVillageSimBucket::Count)];
+
+	// Innermost scope currently recording, which nested recording scopes charge their time against.
+	static FVillageSimScope* ActiveScope;
+};
+
+// RAII scope adding its elapsed cycles to a profiler bucket.
+class FVillageSimScope
+{
+public:
+	// Starts timing when the profiler is enabled and no scope of the same bucket is open.
+	explicit FVillageSimScope(EVillageSimBucket InBucket);
+
+	// Stops timing and records the sample.
+	~FVillageSimScope();
+
+private:
+	// Bucket receiving the sample.
+	EVillageSimBucket Bucket;
+
+	// Cycle counter at scope entry; zero when the scope is not recording.
+	uint64 StartCycles;
+
+	// Cycles recorded by nested scopes of other buckets, excluded from this scope's sample.
+	uint64 ChildCycles;
+
+	// Recording scope that was active when this one started.
+	FVillageSimScope* ParentScope;
+
+	// Whether this scope entered the bucket and must leave it.
+	bool bEntered;
+};
+
+// Times the enclosing scope under the named simulation bucket.
+#define VILLAGE_SIM_SCOPE(BucketName) FVillageSimScope ANONYMOUS_VARIABLE(VillageSimScope_)(EVillageSimBucket::BucketName)
@@ -0,0 +1,113 @@
+// Prevents multiple inclusion of the compiled archetype header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Provides core containers and array views.
+#include "CoreMinimal.h"
+// Gives access to gameplay tags used as lookup keys.
+#include "GameplayTagContainer.h"
+// Provides baked curve lookup tables.
+#include "Simulation/Data/VillagerCurveLUT.h"
+#pragma endregion Includes
+
+// Need curve of an activity with its need tag resolved to a need index.
+struct FVillagerCompiledNeedCurve
+{
+	// Index into the asset's NeedDefinitions array.
+	int32 NeedIndex = INDEX_NONE;
+
+	// Curve sampled with elapsed activity minutes; owned by the asset.
+	const UCurveFloat* Curve = nullptr;
+
+	// Curve baked at minute granularity from minute zero to its last key.
+	FVillagerCurveLUT DeltaLUT;
+
+	// Whether the curve is constant past its last key, so clamped table reads are exact for any minute.
+	bool bLUTCoversAllMinutes = false;
+
+	// First elapsed minute of each run of minutes sharing the same per-minute delta, ascending from zero.
+	TArray<int32> RateSegmentStarts;
+
+	// Per-minute delta of each run, indexed like RateSegmentStarts.
+	TArray<float> RateSegmentDeltas;
+
+	// One past the last elapsed minute covered by the runs.
+	int32 RateSegmentsEnd = 0;
+
+	// Returns the need delta for an elapsed minute, falling back to the source curve outside the baked range.
+	float SampleDelta(float ElapsedMinutes) const;
+
+	// Returns the constant per-minute delta applied at an elapsed minute and the first elapsed minute where it may change.
+	float FindRateSegment(int64 ElapsedMinute, int64& OutSegmentEnd) const;
+};
+
+// Read-only lookup tables derived from a villager archetype asset.
+// Built once per asset and shared by every villager using it; activity indices refer to the asset's ActivityDefinitions array
+// and need indices to its NeedDefinitions array.
+struct FVillagerCompiledArchetype
+{
+	// Number of hour slots in the schedule table.
+	static constexpr int32 HoursPerDay = 24;
+
+	// PartOfDay activity indices sorted by DayOrder.
+	TArray<int32> DailyActivityIndices;
+
+	// PartOfDay activity indices whose window contains each hour, in DayOrder.
+	TArray<int32> HourlyActivityIndices[HoursPerDay];
+
+	// Index of the first activity satisfying each need, keyed by need tag.
+	TMap<FGameplayTag, int32> SatisfyingActivityByNeed;
+
+	// Index of the first activity carrying each activity tag.
+	TMap<FGameplayTag, int32> ActivityIndexByTag;
+
+	// Index of the first need carrying each need tag.
+	TMap<FGameplayTag, int32> NeedIndexByTag;
+
+	// Need curves of each activity with untracked needs and null curves removed, indexed by activity index.
+	TArray<TArray<FVillagerCompiledNeedCurve>> ActivityNeedCurves;
+
+	// Force-activity probability curves baked over normalized need values, indexed by need index; unbaked when the need has no curve.
+	TArray<FVillagerCurveLUT> ForceProbabilityLUTs;
+
+	// Returns the daily activities eligible at an hour, in DayOrder.
+	TConstArrayView<int32> GetActivitiesForHour(int32 Hour) const
+	{
+		return (Hour >= 0 && Hour < HoursPerDay) ? TConstArrayView<int32>(HourlyActivityIndices[Hour]) : TConstArrayView<int32>(); // Guard out-of-range hours.
+	}
+
+	// Returns the index of the activity satisfying a need, or INDEX_NONE.
+	int32 FindSatisfyingActivityIndex(const FGameplayTag& NeedTag) const
+	{
+		const int32* Index = SatisfyingActivityByNeed.Find(NeedTag); // Look up the need.
+		return Index ? *Index : INDEX_NONE; // Provide the index when present.
+	}
+
+	// Returns the index of the activity with a tag, or INDEX_NONE.
+	int32 FindActivityIndex(const FGameplayTag& ActivityTag) const
+	{
+		const int32* Index = ActivityIndexByTag.Find(ActivityTag); // Look up the activity.
+		return Index ? *Index : INDEX_NONE; // Provide the index when present.
+	}
+
+	// Returns the index of the need with a tag, or INDEX_NONE.
+	int32 FindNeedIndex(const FGameplayTag& NeedTag) const
+	{
+		const int32* Index = NeedIndexByTag.Find(NeedTag); // Look up the need.
+		return Index ? *Index : INDEX_NONE; // Provide the index when present.
+	}
+
+	// Returns the baked force probability for a normalized need value, or 1 when the need has no curve.
+	float GetForceProbability(int32 NeedIndex, float NormalizedValue) const
+	{
+		const bool bHasCurve = ForceProbabilityLUTs.IsValidIndex(NeedIndex) && ForceProbabilityLUTs[NeedIndex].IsBaked(); // Needs without a curve always force.
+		return bHasCurve ? FMath::Clamp(ForceProbabilityLUTs[NeedIndex].Evaluate(NormalizedValue), 0.0f, 1.0f) : 1.0f; // Clamp to valid probability range.
+	}
+
+	// Returns the compiled need curves of an activity.
+	TConstArrayView<FVillagerCompiledNeedCurve> GetNeedCurvesForActivity(int32 ActivityIndex) const
+	{
+		return ActivityNeedCurves.IsValidIndex(ActivityIndex) ? TConstArrayView<FVillagerCompiledNeedCurve>(ActivityNeedCurves[ActivityIndex]) : TConstArrayView<FVillagerCompiledNeedCurve>(); // Guard invalid indices.
+	}
+};
@@ -0,0 +1,52 @@
+// Prevents multiple inclusion of the curve lookup table header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Provides core containers and math.
+#include "CoreMinimal.h"
+#pragma endregion Includes
+
+// Forward declare the source curve type.
+class UCurveFloat;
+
+// Fixed-resolution lookup table sampled from a float curve.
+// Reads are a clamped linear interpolation between evenly spaced samples, replacing rich curve key searches at runtime.
+struct FVillagerCurveLUT
+{
+	// Samples the curve at evenly spaced times across [InMinTime, InMaxTime]; at least two samples are taken.
+	void Bake(const UCurveFloat& Curve, float InMinTime, float InMaxTime, int32 SampleCount);
+
+	// Returns whether the table holds samples.
+	bool IsBaked() const { return Samples.Num() >= 2; }
+
+	// Returns whether a time lies inside the baked range.
+	bool Covers(float Time) const { return Time >= MinTime && Time <= MaxTime; }
+
+	// Returns the interpolated value; times outside the baked range clamp to the end samples.
+	float Evaluate(float Time) const
+	{
+		const float Position = FMath::Clamp((Time - MinTime) * InvStep, 0.0f, LastPosition); // Fractional sample position.
+		const int32 Index = FMath::Min(static_cast<int32>(Position), Samples.Num() - 2); // Left sample of the interval.
+		return FMath::Lerp(Samples[Index], Samples[Index + 1], Position - static_cast<float>(Index)); // Interpolate within the interval.
+	}
+
+	// Returns the largest absolute difference to the source curve, probing several points per sample interval.
+	float MeasureMaxError(const UCurveFloat& Curve, int32 ProbesPerInterval = 8) const;
+
+private:
+	// First baked time.
+	float MinTime = 0.0f;
+
+	// Last baked time.
+	float MaxTime = 0.0f;
+
+	// Samples per unit of time.
+	float InvStep = 0.0f;
+
+	// Position of the last sample, used to clamp reads.
+	float LastPosition = 0.0f;
+
+	// Curve values at evenly spaced times.
+	TArray<float> Samples;
+};
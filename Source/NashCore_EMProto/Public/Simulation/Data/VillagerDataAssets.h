@@ -11,6 +11,8 @@
 #include "GameplayTagContainer.h"
 // Adds curve asset support for time-based value sampling.
 #include "Curves/CurveFloat.h"
+// Provides the runtime lookup tables compiled from archetype data.
+#include "Simulation/Data/VillagerCompiledArchetype.h"
 #pragma endregion Includes
 
 // Generated header include required for Unreal's reflection system.
@@ -258,4 +260,32 @@ public:
 	// Movement tuning parameters.
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Villager|Movement")
 	FMovementDefinition MovementDefinition;
+
+	// Builds the compiled lookup tables as soon as the asset is loaded.
+	virtual void PostLoad() override;
+
+	// Returns the compiled lookup tables; assets created at runtime build them on first use, which must happen on the
+	// game thread before worker threads read them.
+	const FVillagerCompiledArchetype& GetCompiledArchetype() const;
+
+	// Discards the compiled tables so they are rebuilt from the current definitions. References previously returned by
+	// GetCompiledArchetype dangle afterwards, so call this only while no villager is simulating with the asset.
+	void InvalidateCompiledArchetype();
+
+	// Rebuilds the compiled tables, logs each table's error against its source curve and returns the largest error.
+	// Replaces the tables like InvalidateCompiledArchetype, so the same restriction applies.
+	float ValidateCompiledArchetype();
+
+#if WITH_EDITOR
+	// Rebuilds compiled tables after designers edit the asset.
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	// Builds lookup tables from the authored definitions.
+	// Measures every table against its source curve when OutMaxCurveError is set.
+	TSharedRef<FVillagerCompiledArchetype> BuildCompiledArchetype(float* OutMaxCurveError = nullptr) const;
+
+	// Lookup tables shared by every villager using this asset; built on load or on first game thread access.
+	mutable TSharedPtr<const FVillagerCompiledArchetype> CompiledArchetype;
 };
@@ -35,6 +35,9 @@ public:
 	// Applies archetype data to components once the game begins.
 	virtual void BeginPlay() override;
 
+	// Assigns the archetype asset; must be called before BeginPlay, e.g. on a deferred spawn.
+	void SetArchetypeData(UVillagerArchetypeDataAsset* InArchetypeData);
+
 private:
 	// Archetype asset defining this villager's data.
 	UPROPERTY(EditAnywhere, Category = "Villager")
@@ -0,0 +1,91 @@
+// Prevents multiple inclusion of the lightweight villager header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Provides pawn base functionality.
+#include "GameFramework/Pawn.h"
+// Imports villager needs component.
+#include "Simulation/Needs/VillagerNeedsComponent.h"
+// Imports activity component.
+#include "Simulation/Activities/VillagerActivityComponent.h"
+// Imports social component.
+#include "Simulation/Social/VillagerSocialComponent.h"
+// Imports movement component.
+#include "Simulation/Movement/VillagerMovementComponent.h"
+// Imports path-following pawn movement.
+#include "Simulation/Movement/VillagerPathMovementComponent.h"
+// Imports logging component.
+#include "Simulation/Logging/VillagerLogComponent.h"
+// Imports needs display component.
+#include "Simulation/UI/VillagerNeedsDisplayComponent.h"
+#pragma endregion Includes
+
+// Generated header required for reflection.
+#include "ExampleVillagerPawn.generated.h"
+
+// Forward declare the optional mesh component.
+class UStaticMeshComponent;
+
+// Lightweight alternative to AExampleVillagerCharacter without capsule collision or character movement.
+// Uses the same simulation components and archetype data; the root sits at the villager's feet on the navmesh and
+// UVillagerPathMovementComponent follows the paths requested by UVillagerMovementComponent.
+UCLASS()
+class AExampleVillagerPawn : public APawn
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+public:
+	// Constructor creating default subobjects.
+	AExampleVillagerPawn(const FObjectInitializer& ObjectInitializer);
+
+	// Applies archetype data to components once the game begins.
+	virtual void BeginPlay() override;
+
+	// Returns the root location; APawn subtracts the eye height, but this root already sits at the feet.
+	virtual FVector GetNavAgentLocation() const override { return GetActorLocation(); }
+
+	// Assigns the archetype asset; must be called before BeginPlay, e.g. on a deferred spawn.
+	void SetArchetypeData(UVillagerArchetypeDataAsset* InArchetypeData);
+
+private:
+	// Archetype asset defining this villager's data.
+	UPROPERTY(EditAnywhere, Category = "Villager")
+	TObjectPtr<UVillagerArchetypeDataAsset> ArchetypeData;
+
+	// Root placed at the villager's feet.
+	UPROPERTY(VisibleAnywhere, Category = "Villager")
+	TObjectPtr<USceneComponent> Root;
+
+	// Optional visual; leave the mesh empty for invisible villagers.
+	UPROPERTY(VisibleAnywhere, Category = "Villager")
+	TObjectPtr<UStaticMeshComponent> MeshComponent;
+
+	// Path-following pawn movement.
+	UPROPERTY(VisibleAnywhere, Category = "Villager")
+	TObjectPtr<UVillagerPathMovementComponent> PathMovementComponent;
+
+	// Needs component instance.
+	UPROPERTY(VisibleAnywhere, Category = "Villager")
+	TObjectPtr<UVillagerNeedsComponent> NeedsComponent;
+
+	// Activity component instance.
+	UPROPERTY(VisibleAnywhere, Category = "Villager")
+	TObjectPtr<UVillagerActivityComponent> ActivityComponent;
+
+	// Social component instance.
+	UPROPERTY(VisibleAnywhere, Category = "Villager")
+	TObjectPtr<UVillagerSocialComponent> SocialComponent;
+
+	// Movement component instance.
+	UPROPERTY(VisibleAnywhere, Category = "Villager")
+	TObjectPtr<UVillagerMovementComponent> MovementComponent;
+
+	// Log component instance.
+	UPROPERTY(VisibleAnywhere, Category = "Villager")
+	TObjectPtr<UVillagerLogComponent> LogComponent;
+
+	// Needs display component instance for world-space UI.
+	UPROPERTY(VisibleAnywhere, Category = "Villager")
+	TObjectPtr<UVillagerNeedsDisplayComponent> NeedsDisplayComponent;
+};
@@ -0,0 +1,19 @@
+// Prevents multiple inclusion of the example villager setup header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Provides base types and helper macros.
+#include "CoreMinimal.h"
+#pragma endregion Includes
+
+// Forward declare the configured villager and its archetype.
+class AActor;
+class UVillagerArchetypeDataAsset;
+
+// BeginPlay setup shared by AExampleVillagerCharacter and AExampleVillagerPawn.
+struct FExampleVillagerSetup
+{
+	// Applies archetype data to the villager's simulation components and shows its needs display.
+	static void ApplyArchetype(AActor& Villager, UVillagerArchetypeDataAsset* ArchetypeData);
+};
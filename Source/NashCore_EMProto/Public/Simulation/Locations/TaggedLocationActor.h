@@ -24,10 +24,20 @@ public:
 	// Constructor ensuring tick is disabled.
 	ATaggedLocationActor();
 
+	// Registers this location with the world location registry.
+	virtual void BeginPlay() override;
+
+	// Removes this location from the world location registry.
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// Returns the tagged transform to use for navigation or activities.
 	FTransform GetTaggedTransform() const { return GetActorTransform(); }
 
 	// Public tag exposed in the editor and blueprints.
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Tagged Location")
 	FGameplayTag LocationTag;
+
+	// Number of villagers this spot serves at once before others prefer another instance of the tag; zero means unlimited.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Tagged Location", meta = (ClampMin = "0"))
+	int32 Capacity = 0;
 };
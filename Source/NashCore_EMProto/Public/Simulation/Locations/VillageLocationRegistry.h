@@ -9,15 +9,39 @@
 #include "Subsystems/WorldSubsystem.h"
 // Gameplay tags for keyed lookup.
 #include "GameplayTagContainer.h"
+// Provides stable keys for registered actors.
+#include "UObject/ObjectKey.h"
 #pragma endregion Includes
 
 // Generated header required for reflection.
 #include "VillageLocationRegistry.generated.h"
 
-// Forward declare the tagged location actor.
+// Forward declare the tagged location actor and navigation data.
 class ATaggedLocationActor;
+class ANavigationData;
 
-// Subsystem that discovers tagged location actors in the world and exposes lookups.
+// Raised whenever registered locations or their projected transforms change; the flag is set after a navmesh rebuild.
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnVillageLocationsChanged, bool /*bNavigationRebuilt*/);
+
+// Identifies one registered location instance; stale handles are ignored after the instance unregisters.
+struct FVillageLocationHandle
+{
+	// Slot of the instance inside the registry.
+	int32 InstanceIndex = INDEX_NONE;
+
+	// Serial guarding against reuse of the slot by a later instance.
+	uint32 Serial = 0;
+
+	// Returns whether the handle was ever assigned.
+	bool IsValid() const { return InstanceIndex != INDEX_NONE; }
+
+	// Clears the handle.
+	void Reset() { InstanceIndex = INDEX_NONE; Serial = 0; }
+};
+
+// Subsystem tracking tagged location actors in the world and exposing lookups.
+// Actors register themselves on BeginPlay; transforms are projected to the navmesh once and re-projected when navigation rebuilds.
+// Each tag may have many instances, indexed in a per-tag spatial hash grid with occupancy counters.
 UCLASS()
 class UVillageLocationRegistry : public UWorldSubsystem
 {
@@ -30,20 +54,152 @@ public:
 	// Build the registry when the subsystem initializes.
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 
-	// Rebuilds the registry by scanning the world.
+	// Unbinds navigation events on shutdown.
+	virtual void Deinitialize() override;
+
+	// Binds navigation rebuild events once the world's navigation system exists.
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// Scans the world for tagged location actors that are not registered yet; existing instances, their occupancy and
+	// outstanding handles are kept.
 	void RefreshRegistry();
 
-	// Attempts to fetch a transform for the supplied tag; returns false if not found or invalid.
+	// Adds a tagged location actor as a new instance of its tag.
+	void RegisterLocation(ATaggedLocationActor* Actor);
+
+	// Removes a tagged location actor's instance.
+	void UnregisterLocation(ATaggedLocationActor* Actor);
+
+	// Attempts to fetch the transform of the first registered instance of a tag; returns false if not found.
 	bool TryGetLocation(const FGameplayTag& LocationTag, FTransform& OutTransform);
 
-	// Returns a copy of all registered locations (used for debugging or UI).
-	TMap<FGameplayTag, FTransform> GetRegisteredLocations() const { return RegisteredLocations; }
+	// Returns whether TryGetLocation may succeed for a tag without scanning the world; safe to call from worker threads.
+	bool MayResolveLocation(const FGameplayTag& LocationTag) const;
+
+	// Finds the closest instance of a tag with spare capacity; returns false when every instance is full or none exist.
+	bool FindNearestFreeInstance(const FGameplayTag& LocationTag, const FVector& Position, FVillageLocationHandle& OutHandle, FTransform& OutTransform) const;
+
+	// Finds the instance of a tag with the fewest occupants, preferring the closest on ties.
+	bool FindLeastOccupiedInstance(const FGameplayTag& LocationTag, const FVector& Position, FVillageLocationHandle& OutHandle, FTransform& OutTransform) const;
+
+	// Picks the nearest free instance, falling back to the least occupied, and reserves it.
+	bool AcquireInstance(const FGameplayTag& LocationTag, const FVector& Position, FVillageLocationHandle& OutHandle, FTransform& OutTransform);
+
+	// Increments the occupancy of an instance; returns false for stale handles.
+	bool ReserveInstance(const FVillageLocationHandle& Handle);
+
+	// Decrements the occupancy of an instance and clears the handle.
+	void ReleaseInstance(FVillageLocationHandle& Handle);
+
+	// Returns the number of occupants of an instance, or zero for stale handles.
+	int32 GetInstanceOccupancy(const FVillageLocationHandle& Handle) const;
+
+	// Returns how many instances are registered for a tag.
+	int32 GetInstanceCount(const FGameplayTag& LocationTag) const;
+
+	// Returns a counter bumped whenever registered locations change, so callers can invalidate cached transforms.
+	int32 GetRevision() const { return Revision; }
+
+	// Returns the first instance transform of every tag (used for debugging or UI).
+	TMap<FGameplayTag, FTransform> GetRegisteredLocations() const;
+
+	// Appends the projected location of every registered instance, in slot order.
+	void GetInstanceLocations(TArray<FVector>& OutLocations) const;
+
+	// Broadcast after locations are added, removed or re-projected.
+	FOnVillageLocationsChanged OnLocationsChanged;
 
 private:
+	// Registered location instance.
+	struct FLocationInstance
+	{
+		// Actor providing the location.
+		TWeakObjectPtr<ATaggedLocationActor> Actor;
+
+		// Tag of the location.
+		FGameplayTag LocationTag;
+
+		// Navmesh-projected transform.
+		FTransform Transform;
+
+		// Grid cell containing the transform.
+		FIntPoint Cell = FIntPoint::ZeroValue;
+
+		// Maximum occupants; zero means unlimited.
+		int32 Capacity = 0;
+
+		// Current occupants.
+		int32 Occupancy = 0;
+
+		// Serial matching handles issued for this instance.
+		uint32 Serial = 0;
+
+		// Returns whether another occupant fits.
+		bool HasFreeCapacity() const { return Capacity <= 0 || Occupancy < Capacity; }
+	};
+
+	// Instances of one tag with their spatial hash grid.
+	struct FTagIndex
+	{
+		// Instance slots in registration order.
+		TArray<int32> Instances;
+
+		// Instance slots bucketed by grid cell.
+		TMap<FIntPoint, TArray<int32>> Cells;
+
+		// Inclusive lower corner of every cell ever used by this tag.
+		FIntPoint MinCell = FIntPoint(MAX_int32, MAX_int32);
+
+		// Inclusive upper corner of every cell ever used by this tag.
+		FIntPoint MaxCell = FIntPoint(MIN_int32, MIN_int32);
+	};
+
 	// Adds a location to the registry, projecting to the navmesh if possible.
-	void AddFromActor(const ATaggedLocationActor* Actor);
+	void AddFromActor(ATaggedLocationActor* Actor);
+
+	// Projects an actor transform onto the navmesh, falling back to the raw transform.
+	FTransform ProjectActorTransform(const ATaggedLocationActor* Actor) const;
+
+	// Returns the grid cell containing a position.
+	static FIntPoint GetCell(const FVector& Position);
+
+	// Files an instance in its tag's grid cell.
+	void AddToGrid(FTagIndex& TagIndex, int32 InstanceIndex);
+
+	// Removes an instance from its tag's grid cell.
+	void RemoveFromGrid(FTagIndex& TagIndex, int32 InstanceIndex);
+
+	// Returns the closest instance of a tag, optionally only those with spare capacity.
+	int32 FindNearestInstanceIndex(const FTagIndex& TagIndex, const FVector& Position, bool bRequireFreeCapacity) const;
+
+	// Returns the instance slot for a handle, or INDEX_NONE when stale.
+	int32 ResolveHandle(const FVillageLocationHandle& Handle) const;
+
+	// Builds a handle for an instance slot.
+	FVillageLocationHandle MakeHandle(int32 InstanceIndex) const;
+
+	// Re-projects every registered location after the navmesh finished building.
+	UFUNCTION()
+	void HandleNavigationGenerationFinished(ANavigationData* NavData);
+
+	// Bumps the revision and notifies listeners.
+	void NotifyLocationsChanged(bool bNavigationRebuilt);
+
+	// Registered instances addressed by stable slot.
+	TSparseArray<FLocationInstance> Instances;
+
+	// Per-tag instance lists and grids.
+	TMap<FGameplayTag, FTagIndex> TagIndices;
+
+	// Instance slot owned by each registered actor.
+	TMap<TObjectKey<ATaggedLocationActor>, int32> InstanceByActor;
+
+	// Tags that were looked up but never registered; prevents repeated world scans for typos.
+	TSet<FGameplayTag> MissingTags;
+
+	// Next serial handed to a new instance.
+	uint32 NextSerial = 1;
 
-	// Cached mapping of tag -> transform.
-	UPROPERTY()
-	TMap<FGameplayTag, FTransform> RegisteredLocations;
+	// Incremented on every change.
+	int32 Revision = 0;
 };
@@ -0,0 +1,134 @@
+// Prevents multiple inclusion of the village event hub header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Core types and macros.
+#include "CoreMinimal.h"
+// Base class for tickable world subsystems.
+#include "Subsystems/WorldSubsystem.h"
+// Gameplay tags identifying villagers.
+#include "GameplayTagContainer.h"
+// Provides villager log entries carried by notifications.
+#include "Simulation/Logging/VillagerLogComponent.h"
+#pragma endregion Includes
+
+// Generated header required for reflection.
+#include "VillageEventHubSubsystem.generated.h"
+
+// Villager event as delivered by the hub.
+struct FVillageEventNotification
+{
+	// Villager that recorded the event; may be gone by delivery.
+	TWeakObjectPtr<UVillagerLogComponent> Source;
+
+	// Identifier of the villager at publish time.
+	FGameplayTag VillagerIdTag;
+
+	// Copy of the villager's log entry.
+	FVillagerLogEntry Entry;
+};
+
+// Events a subscriber receives; setters chain like FVillageEventParams.
+struct FVillageEventTopic
+{
+	// Villager whose events are delivered; invalid delivers every villager.
+	FGameplayTag VillagerIdTag;
+
+	// Bit per EVillageEventType that is delivered.
+	uint32 EventTypeMask = MAX_uint32;
+
+	// Restricts delivery to one villager.
+	FVillageEventTopic& SetVillager(const FGameplayTag& InTag) { VillagerIdTag = InTag; return *this; }
+
+	// Restricts delivery to the given event types.
+	FVillageEventTopic& SetEventTypes(std::initializer_list<EVillageEventType> Types)
+	{
+		EventTypeMask = 0;
+		for (EVillageEventType Type : Types)
+		{
+			EventTypeMask |= 1u << static_cast<uint32>(Type);
+		}
+		return *this;
+	}
+
+	// Returns whether a notification belongs to this topic.
+	bool Matches(const FVillageEventNotification& Notification) const
+	{
+		return (!VillagerIdTag.IsValid() || Notification.VillagerIdTag == VillagerIdTag)
+			&& (EventTypeMask & (1u << static_cast<uint32>(Notification.Entry.Record.Type))) != 0;
+	}
+};
+
+// Receives the events of one frame matching a subscription, in village order.
+DECLARE_DELEGATE_OneParam(FOnVillageEventBatch, TConstArrayView<const FVillageEventNotification*>);
+
+// Per-world hub villager log components publish their events to.
+// Log components register on BeginPlay and unregister on EndPlay, so consumers find spawned and despawned villagers
+// without scanning the world. Each consumer subscribes once with a topic; events published during a frame are copied
+// only while someone is subscribed and are delivered from Tick as one batch per subscriber.
+UCLASS()
+class UVillageEventHubSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+public:
+	// Ensure creation for all worlds.
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
+
+	// Drops subscriptions, villagers and undelivered events.
+	virtual void Deinitialize() override;
+
+	// Delivers the events published since the last tick.
+	virtual void Tick(float DeltaTime) override;
+
+	// Provides the stat identifier used by the tickable object manager.
+	virtual TStatId GetStatId() const override;
+
+	// Adds a villager to the registry.
+	void RegisterVillager(UVillagerLogComponent* Villager);
+
+	// Removes a villager from the registry.
+	void UnregisterVillager(UVillagerLogComponent* Villager);
+
+	// Returns the registered villagers in registration order.
+	const TArray<TWeakObjectPtr<UVillagerLogComponent>>& GetVillagers() const { return Villagers; }
+
+	// Queues a villager's event for the next delivery.
+	void Publish(UVillagerLogComponent* Source, const FVillagerLogEntry& Entry);
+
+	// Subscribes to the events of a topic; returns the handle to unsubscribe with.
+	FDelegateHandle Subscribe(const FVillageEventTopic& Topic, FOnVillageEventBatch&& Delegate);
+
+	// Removes a subscription.
+	void Unsubscribe(FDelegateHandle Handle);
+
+private:
+	// Consumer of one topic.
+	struct FSubscription
+	{
+		// Events delivered to the consumer.
+		FVillageEventTopic Topic;
+
+		// Consumer callback; unbound while awaiting removal.
+		FOnVillageEventBatch Delegate;
+	};
+
+	// Registered villagers.
+	TArray<TWeakObjectPtr<UVillagerLogComponent>> Villagers;
+
+	// Active subscriptions.
+	TArray<FSubscription> Subscriptions;
+
+	// Events awaiting the next delivery.
+	TArray<FVillageEventNotification> Pending;
+
+	// Events being delivered; swapped with Pending so both allocations are reused.
+	TArray<FVillageEventNotification> Delivering;
+
+	// Events of the current delivery matching one subscription.
+	TArray<const FVillageEventNotification*> Matches;
+
+	// Whether subscribers are being notified, so removals are deferred.
+	bool bDelivering = false;
+};
@@ -0,0 +1,182 @@
+// Prevents multiple inclusion of the village event log header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Core types and macros.
+#include "CoreMinimal.h"
+// Base world subsystem for per-world lifetime.
+#include "Subsystems/WorldSubsystem.h"
+// Gameplay tags identifying villagers, activities, resources and locations.
+#include "GameplayTagContainer.h"
+#pragma endregion Includes
+
+// Generated header required for reflection.
+#include "VillageEventLogSubsystem.generated.h"
+
+// Forward declare the clock providing event timestamps.
+class UVillageClockSubsystem;
+
+// Kinds of villager events; each kind formats its own text from the record's tags and values.
+UENUM(BlueprintType)
+enum class EVillageEventType : uint8
+{
+	Message, // Free text passed to UVillagerLogComponent::LogAction.
+	ActivityStarted, // Activity, optional location.
+	ActivityCompleted, // Activity.
+	ActivityLocationReached, // Activity.
+	ActivityLocationMissing, // Activity.
+	ActivityCooldownDelayed, // Activity.
+	ActivityCooldownSkipped, // Activity.
+	ActivityRetryDelayed, // Activity, Value0 = delay seconds.
+	MovementFailed, // Activity, Value0 = retry seconds.
+	NeedSwitch, // Resource = need.
+	NeedInterrupt, // Resource = need.
+	ResourceFetchStarted, // Resource, target provider, location, activity.
+	ResourceProviderMissing, // Resource, activity.
+	ResourceAcquired, // Resource, target provider, location, activity, Value0 = quantity.
+	ProviderUnavailable, // Target provider, location, Value0 = retry seconds.
+	ProviderUnreachable, // Activity, Value0 = retry seconds.
+	AffectionMissedTrade, // Target villager, Value0 = affection.
+	AffectionTrade, // Target villager, Value0 = affection, Value1 = 1 when the need was critical.
+	Count UMETA(Hidden)
+};
+
+// Compact, allocation-free record of one villager event.
+// Tags are stored as indices into the event log's tag table; text is only built when a consumer formats the record.
+struct FVillageEventRecord
+{
+	// Village-wide sequence number; increases by one per event.
+	uint64 Sequence = 0;
+
+	// Clock minute the event happened at.
+	int64 SimMinute = 0;
+
+	// Numeric payloads; meaning depends on the event type.
+	float Values[2] = { 0.0f, 0.0f };
+
+	// Villager the event belongs to.
+	uint16 ActorTag = 0;
+
+	// Other villager involved, e.g. a provider.
+	uint16 TargetTag = 0;
+
+	// Activity involved.
+	uint16 ActivityTag = 0;
+
+	// Resource or need involved.
+	uint16 ResourceTag = 0;
+
+	// Location involved.
+	uint16 LocationTag = 0;
+
+	// Kind of event.
+	EVillageEventType Type = EVillageEventType::Message;
+};
+
+// Tags and values describing an event before it is recorded; setters chain like FAIMoveRequest.
+struct FVillageEventParams
+{
+	// Other villager involved.
+	FGameplayTag Target;
+
+	// Activity involved.
+	FGameplayTag Activity;
+
+	// Resource or need involved.
+	FGameplayTag Resource;
+
+	// Location involved.
+	FGameplayTag Location;
+
+	// Numeric payloads.
+	float Values[2] = { 0.0f, 0.0f };
+
+	// Sets the other villager.
+	FVillageEventParams& SetTarget(const FGameplayTag& InTag) { Target = InTag; return *this; }
+
+	// Sets the activity.
+	FVillageEventParams& SetActivity(const FGameplayTag& InTag) { Activity = InTag; return *this; }
+
+	// Sets the resource or need.
+	FVillageEventParams& SetResource(const FGameplayTag& InTag) { Resource = InTag; return *this; }
+
+	// Sets the location.
+	FVillageEventParams& SetLocation(const FGameplayTag& InTag) { Location = InTag; return *this; }
+
+	// Sets a numeric payload.
+	FVillageEventParams& SetValue(int32 Index, float InValue) { Values[Index] = InValue; return *this; }
+};
+
+// Per-world ring buffer of villager events.
+// Villager components write compact records here instead of composing strings; the widget, on-screen debug and the
+// LogVillageEvents output log category format records only when they consume them. The output log sink is verbose,
+// so records are formatted for it only when that verbosity is enabled.
+UCLASS()
+class UVillageEventLogSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+public:
+	// Ensure creation for all worlds.
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
+
+	// Allocates the ring buffer and resolves the clock.
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	// Releases the ring buffer and tag table.
+	virtual void Deinitialize() override;
+
+	// Records an event of a villager and returns the stored record; Message is only kept for free text events.
+	const FVillageEventRecord& Write(EVillageEventType Type, const FGameplayTag& ActorTag, const FVillageEventParams& Params, const FString& Message = FString());
+
+	// Returns a retained record by sequence number, or null once it was overwritten.
+	const FVillageEventRecord* FindEvent(uint64 Sequence) const;
+
+	// Returns the text of a retained free text event; empty for other events.
+	const FString& GetEventMessage(uint64 Sequence) const;
+
+	// Returns the oldest retained sequence number.
+	uint64 GetFirstSequence() const { return NextSequence > static_cast<uint64>(Records.Num()) ? NextSequence - Records.Num() : 1; }
+
+	// Returns the sequence number the next event will get.
+	uint64 GetNextSequence() const { return NextSequence; }
+
+	// Formats a record as "[Actor] text", appending free text for Message events.
+	FString FormatEvent(const FVillageEventRecord& Record, const FString& Message) const;
+
+	// Returns the tag stored at a tag index.
+	const FGameplayTag& GetTag(uint16 TagIndex) const;
+
+	// Returns the short display name of the tag stored at a tag index.
+	const FString& GetShortTagName(uint16 TagIndex) const;
+
+private:
+	// Returns the index of a tag, adding it to the table on first use; zero for invalid tags.
+	uint16 InternTag(const FGameplayTag& Tag);
+
+	// Formats the type-specific text of a record.
+	FString FormatBody(const FVillageEventRecord& Record, const FString& Message) const;
+
+	// Clock providing event timestamps.
+	UPROPERTY()
+	TObjectPtr<UVillageClockSubsystem> Clock;
+
+	// Retained records addressed by sequence modulo capacity.
+	TArray<FVillageEventRecord> Records;
+
+	// Free text of retained Message events, parallel to Records.
+	TArray<FString> Messages;
+
+	// Sequence number of the next event; starts at one so zero means "none seen".
+	uint64 NextSequence = 1;
+
+	// Interned tags; index zero is the invalid tag.
+	TArray<FGameplayTag> Tags;
+
+	// Short display names parallel to Tags.
+	TArray<FString> ShortTagNames;
+
+	// Index of each interned tag.
+	TMap<FGameplayTag, uint16> TagIndices;
+};
@@ -11,6 +11,8 @@
 #include "GameplayTagContainer.h"
 // Brings in delegate declarations for notifying UI.
 #include "Delegates/DelegateCombinations.h"
+// Provides structured event records and their parameters.
+#include "Simulation/Logging/VillageEventLogSubsystem.h"
 #pragma endregion Includes
 
 // Generated header required by Unreal reflection.
@@ -18,8 +20,23 @@
 
 // Forward declaration for delegate signatures.
 class UVillagerLogComponent;
+// Forward declaration of the hub events are published to.
+class UVillageEventHubSubsystem;
 
-// Raised whenever a new log line is added so UI can subscribe.
+// Event recorded by a villager, with its free text for Message events.
+struct FVillagerLogEntry
+{
+	// Per-villager sequence number; increases by one per event of this villager.
+	uint64 Sequence = 0;
+
+	// Structured record as written to the village event log.
+	FVillageEventRecord Record;
+
+	// Free text of Message events; empty otherwise.
+	FString Message;
+};
+
+// Raised whenever a new log line is added so UI can subscribe; the line is only formatted when bound.
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnVillagerLogLineAdded, UVillagerLogComponent*, SourceComponent, const FString&, Message);
 
 // Component that emits on-screen logs for simulation events.
@@ -32,9 +49,21 @@ public:
 	// Constructor disabling tick.
 	UVillagerLogComponent();
 
+	// Registers with the village event hub.
+	virtual void BeginPlay() override;
+
+	// Unregisters from the village event hub.
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// Emits a formatted log line to the screen.
 	void LogMessage(const FString& Message);
 
+	// Records a structured event; text is formatted only for on-screen debug and bound listeners.
+	void LogEvent(EVillageEventType Type, const FVillageEventParams& Params = FVillageEventParams());
+
+	// Formats an entry as a log line.
+	FString FormatEntry(const FVillagerLogEntry& Entry) const;
+
 	// Enables or disables on-screen debug rendering for all villager log components.
 	static void SetOnScreenDebugEnabled(bool bEnabled);
 
@@ -58,15 +87,24 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Villager Log")
 	void SetVillagerIdTag(const FGameplayTag& InVillagerId);
 
-	// Returns the buffered log lines for UI consumption.
+	// Formats the buffered log lines for UI consumption.
 	UFUNCTION(BlueprintCallable, Category = "Villager Log")
-	TArray<FString> GetRecentMessages() const { return RecentMessages; }
+	TArray<FString> GetRecentMessages() const;
+
+	// Visits buffered entries newer than a sequence number, oldest first, without copying them.
+	void ForEachEntry(uint64 AfterSequence, TFunctionRef<void(const FVillagerLogEntry&)> Visitor) const;
+
+	// Returns the sequence number of the newest entry, or zero before the first event.
+	uint64 GetLatestSequence() const { return NextSequence - 1; }
+
+	// Returns the number of buffered entries.
+	int32 GetEntryCount() const { return static_cast<int32>(FMath::Min<uint64>(NextSequence - 1, History.Num())); }
 
 	// Delegate fired whenever a new message arrives.
 	UPROPERTY(BlueprintAssignable, Category = "Villager Log")
 	FOnVillagerLogLineAdded OnLogLineAdded;
 
-	// Maximum number of log lines to retain for the widget.
+	// Maximum number of log lines to retain for the widget; the buffer is sized when the first event is recorded.
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Villager Log")
 	int32 MaxStoredMessages = 50;
 
@@ -96,7 +134,18 @@ private:
 	// Tracks whether the auto color has been computed.
 	mutable bool bHasCachedAutoColor = false;
 
-	// In-memory buffer of recent log lines for UI display.
-	UPROPERTY()
-	TArray<FString> RecentMessages;
+	// Hub this villager is registered with.
+	TWeakObjectPtr<UVillageEventHubSubsystem> EventHub;
+
+	// Writes an event to the village event log, buffers it and notifies consumers.
+	void RecordEvent(EVillageEventType Type, const FVillageEventParams& Params, const FString& Message);
+
+	// Resolves the village event log.
+	UVillageEventLogSubsystem* GetEventLog() const;
+
+	// Fixed-capacity ring of recent events addressed by (Sequence - 1) % capacity.
+	TArray<FVillagerLogEntry> History;
+
+	// Sequence number of the next event; starts at one so zero means "none seen".
+	uint64 NextSequence = 1;
 };
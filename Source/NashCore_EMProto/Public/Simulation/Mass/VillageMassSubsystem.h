@@ -0,0 +1,187 @@
+// Prevents multiple inclusion of the Mass villager subsystem header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Core types and macros.
+#include "CoreMinimal.h"
+// Base class for tickable world subsystems.
+#include "Subsystems/WorldSubsystem.h"
+// Entity handles and archetype handles.
+#include "MassEntityTypes.h"
+// Shared fragment values attached to spawned entities.
+#include "MassArchetypeTypes.h"
+// Gives access to gameplay tags used as resource and villager identifiers.
+#include "GameplayTagContainer.h"
+// Provides stable keys for archetype assets.
+#include "UObject/ObjectKey.h"
+#pragma endregion Includes
+
+// Generated header required for reflection.
+#include "VillageMassSubsystem.generated.h"
+
+// Forward declare the types referenced by the subsystem.
+class AExampleVillagerCharacter;
+class UVillagerArchetypeDataAsset;
+class UVillagerMassActivityProcessor;
+class UVillagerMassNeedsProcessor;
+
+// Clock state read by the Mass processors during a step.
+struct FVillageMassStepContext
+{
+	// Monotonic minute being processed.
+	int64 Minute = 0;
+
+	// Hour of the day.
+	int32 Hour = 0;
+
+	// Minute within the hour.
+	int32 MinuteOfHour = 0;
+
+	// Real seconds per game minute, used to turn walk speed into travel minutes.
+	float SecondsPerGameMinute = 1.0f;
+};
+
+// Trade spot of a Mass villager providing a resource.
+struct FVillageMassProvider
+{
+	// Providing villager.
+	FMassEntityHandle Entity;
+
+	// Identifier of the providing villager.
+	FGameplayTag ProviderId;
+
+	// Resolved trade location.
+	FVector TradeLocation = FVector::ZeroVector;
+};
+
+// Crowd-scale villager backend on MassEntity, driven by the village clock.
+// Villagers spawned here live as entities whose fragments mirror the needs, activity and social components and are
+// stepped once per clock minute by the village Mass processors. Villagers near the camera are handed to full
+// AExampleVillagerCharacter actors and handed back when they leave the representation radius, so each villager is
+// simulated by exactly one backend at a time.
+UCLASS()
+class UVillageMassSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+public:
+	// Ensure creation for all worlds.
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
+
+	// Binds to the clock's per-minute hook.
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	// Unbinds from the clock and drops entity bookkeeping.
+	virtual void Deinitialize() override;
+
+	// Refreshes the actors representing villagers near the camera.
+	virtual void Tick(float DeltaTime) override;
+
+	// Provides the stat identifier used by the tickable object manager.
+	virtual TStatId GetStatId() const override;
+
+	// Spawns a villager entity of an archetype at a location; returns false when the archetype cannot be simulated.
+	bool SpawnVillager(UVillagerArchetypeDataAsset* Archetype, const FVector& Location);
+
+	// Returns the number of villager entities alive after the last step.
+	int32 GetVillagerCount() const { return Villagers.Num(); }
+
+	// Returns the number of villagers currently represented by actors.
+	int32 GetRepresentedCount() const { return RepresentedEntities.Num(); }
+
+	// Returns the clock state of the step being processed.
+	const FVillageMassStepContext& GetStepContext() const { return StepContext; }
+
+	// Returns the trade spots offering a resource.
+	TConstArrayView<FVillageMassProvider> GetProviders(const FGameplayTag& ResourceTag) const;
+
+	// Sets the actor class spawned for villagers near the camera.
+	void SetRepresentationActorClass(TSubclassOf<AExampleVillagerCharacter> InActorClass);
+
+	// Sets the camera distance within which villagers are represented by actors; zero or less disables representation.
+	void SetRepresentationRadius(float InRadius);
+
+	// Sets the maximum number of villagers represented by actors at once.
+	void SetMaxRepresentedVillagers(int32 InMaxRepresented);
+
+private:
+	// Creates the entity archetype and processors on first use.
+	bool EnsureMassSetup();
+
+	// Returns the shared fragment values of an archetype asset, resolving its locations and providers on first use.
+	const FMassArchetypeSharedFragmentValues& FindOrAddSharedValues(UVillagerArchetypeDataAsset* Archetype);
+
+	// Adds the trade spots of a spawned provider villager.
+	void RegisterProvider(const UVillagerArchetypeDataAsset& Archetype, FMassEntityHandle Entity);
+
+	// Steps every simulated villager by one minute.
+	void ProcessMinute(int64 Minute);
+
+	// Drops dead villagers from the entity and provider lists.
+	void PruneDeadVillagers();
+
+	// Hands villagers entering the camera radius to actors and villagers leaving it back to Mass.
+	void UpdateRepresentation();
+
+	// Spawns an actor continuing an entity's state.
+	bool SpawnRepresentation(FMassEntityHandle Entity);
+
+	// Copies an actor's state back into its entity and destroys the actor.
+	void ReleaseRepresentation(int32 RepresentedIndex);
+
+	// Returns the point representation distances are measured from.
+	bool GetViewLocation(FVector& OutLocation) const;
+
+	// Binding to the clock's per-minute hook.
+	FDelegateHandle MinuteProcessedHandle;
+
+	// Fragment composition shared by all villager entities.
+	FMassArchetypeHandle EntityArchetype;
+
+	// Shared fragment values per archetype asset.
+	TMap<TObjectKey<UVillagerArchetypeDataAsset>, FMassArchetypeSharedFragmentValues> SharedValuesByArchetype;
+
+	// Processor ending, interrupting and planning activities.
+	UPROPERTY()
+	TObjectPtr<UVillagerMassActivityProcessor> ActivityProcessor;
+
+	// Processor integrating need curves.
+	UPROPERTY()
+	TObjectPtr<UVillagerMassNeedsProcessor> NeedsProcessor;
+
+	// Every villager entity, including represented ones.
+	TArray<FMassEntityHandle> Villagers;
+
+	// Trade spots keyed by provided resource.
+	TMap<FGameplayTag, TArray<FVillageMassProvider>> ProvidersByResource;
+
+	// Number of villagers spawned, used to give each its own decision stream.
+	int32 SpawnSerial = 0;
+
+	// Clock state of the step being processed.
+	FVillageMassStepContext StepContext;
+
+	// Actor class spawned for represented villagers.
+	UPROPERTY()
+	TSubclassOf<AExampleVillagerCharacter> RepresentationActorClass;
+
+	// Camera distance within which villagers are represented.
+	float RepresentationRadius = 3000.0f;
+
+	// Maximum villagers represented at once.
+	int32 MaxRepresentedVillagers = 64;
+
+	// Seconds until the next representation refresh.
+	float RepresentationCountdown = 0.0f;
+
+	// Entities currently represented, indexed like RepresentedActors.
+	TArray<FMassEntityHandle> RepresentedEntities;
+
+	// Same entities as RepresentedEntities, for membership tests while scanning every villager.
+	TSet<FMassEntityHandle> RepresentedEntitySet;
+
+	// Actor representing each represented entity.
+	UPROPERTY()
+	TArray<TObjectPtr<AExampleVillagerCharacter>> RepresentedActors;
+};
@@ -0,0 +1,134 @@
+// Prevents multiple inclusion of the Mass villager fragments header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Core types and macros.
+#include "CoreMinimal.h"
+// Base fragment, tag and shared fragment types.
+#include "MassEntityTypes.h"
+// Gives access to gameplay tags used as villager identifiers.
+#include "GameplayTagContainer.h"
+#pragma endregion Includes
+
+// Generated header required for reflection.
+#include "VillagerMassFragments.generated.h"
+
+// Forward declare the authoring asset shared by villagers of one archetype.
+class UVillagerArchetypeDataAsset;
+
+// Need values of a Mass villager, indexed like the archetype's NeedDefinitions.
+// Fixed capacity keeps the fragment inline in its chunk; needs past the capacity are not simulated.
+USTRUCT()
+struct FVillagerMassNeedsFragment : public FMassFragment
+{
+	GENERATED_BODY() // Enables reflection.
+
+	// Maximum needs tracked per villager.
+	static constexpr int32 MaxNeeds = 8;
+
+	// Current value of each tracked need.
+	float Values[MaxNeeds] = {};
+
+	// Number of tracked needs.
+	int32 NeedCount = 0;
+};
+
+// Activity and travel state of a Mass villager.
+USTRUCT()
+struct FVillagerMassActivityFragment : public FMassFragment
+{
+	GENERATED_BODY() // Enables reflection.
+
+	// Index of the running activity in the archetype's ActivityDefinitions, or INDEX_NONE when idle.
+	int32 ActivityIndex = INDEX_NONE;
+
+	// Clock minute the activity began.
+	int64 ActivityStartMinute = 0;
+
+	// Clock minute the villager reaches its destination; travel is abstract and only costs time.
+	int64 ArrivalMinute = 0;
+
+	// Current position, updated on arrival.
+	FVector Location = FVector::ZeroVector;
+
+	// Position of the current activity, or of the trade spot while a trade is pending.
+	FVector Destination = FVector::ZeroVector;
+
+	// Provider the villager is travelling to trade with.
+	FMassEntityHandle TradeProvider;
+
+	// Identifier of that provider.
+	FGameplayTag TradeProviderId;
+
+	// Whether the villager is still travelling.
+	bool bTravelling = false;
+
+	// Whether the trade has to happen before the activity location is approached.
+	bool bTradePending = false;
+
+	// Returns whether an activity is running.
+	bool IsActive() const { return ActivityIndex != INDEX_NONE; }
+};
+
+// Affection of a Mass villager toward other villagers, seeded from the archetype approvals.
+USTRUCT()
+struct FVillagerMassSocialFragment : public FMassFragment
+{
+	GENERATED_BODY() // Enables reflection.
+
+	// Maximum villagers tracked per villager; further trade partners are ignored.
+	static constexpr int32 MaxPeers = 8;
+
+	// Identifier of each tracked villager.
+	FGameplayTag PeerIds[MaxPeers];
+
+	// Affection toward each tracked villager.
+	float Affection[MaxPeers] = {};
+
+	// Number of tracked villagers.
+	int32 PeerCount = 0;
+
+	// Adds a delta to the affection toward a villager, tracking it when there is room.
+	void AddAffection(const FGameplayTag& PeerId, float Delta);
+};
+
+// Per-villager schedule state.
+USTRUCT()
+struct FVillagerMassScheduleFragment : public FMassFragment
+{
+	GENERATED_BODY() // Enables reflection.
+
+	// Random stream for force probability rolls and provider picks, seeded per villager.
+	FRandomStream DecisionStream;
+
+	// Earliest clock minute an idle villager tries to plan again after finding nothing to do.
+	int64 NextPlanMinute = 0;
+};
+
+// Villager currently simulated by a full actor; processors skip it until it returns to Mass.
+USTRUCT()
+struct FVillagerMassRepresentedTag : public FMassTag
+{
+	GENERATED_BODY() // Enables reflection.
+};
+
+// Archetype data shared by every Mass villager spawned from one asset.
+// Activity locations are resolved on the game thread when the archetype is first spawned so processors never touch the world.
+USTRUCT()
+struct FVillagerMassArchetypeFragment : public FMassConstSharedFragment
+{
+	GENERATED_BODY() // Enables reflection.
+
+	// Authoring asset providing definitions and compiled tables.
+	UPROPERTY()
+	TObjectPtr<UVillagerArchetypeDataAsset> Archetype = nullptr;
+
+	// Resolved location of each activity, indexed like ActivityDefinitions.
+	UPROPERTY()
+	TArray<FVector> ActivityLocations;
+
+	// Whether each activity can run: its location resolved or none is required.
+	UPROPERTY()
+	TArray<bool> ActivityAvailable;
+};
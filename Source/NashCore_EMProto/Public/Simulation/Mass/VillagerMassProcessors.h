@@ -0,0 +1,62 @@
+// Prevents multiple inclusion of the Mass villager processors header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Core types and macros.
+#include "CoreMinimal.h"
+// Base processor type.
+#include "MassProcessor.h"
+// Entity queries iterated by the processors.
+#include "MassEntityQuery.h"
+#pragma endregion Includes
+
+// Generated header required for reflection.
+#include "VillagerMassProcessors.generated.h"
+
+// Ends, interrupts and plans Mass villager activities for the current minute, mirroring UVillagerActivityComponent.
+// Runs before the needs processor, like component wakeups run before the village needs stage. Chunks are processed in
+// parallel; the step context and provider table are read-only while it runs.
+UCLASS()
+class UVillagerMassActivityProcessor : public UMassProcessor
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+public:
+	// Configures the processor to run only when the village Mass subsystem executes it.
+	UVillagerMassActivityProcessor();
+
+protected:
+	// Declares fragment access.
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+
+	// Processes one minute for every simulated villager.
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	// Villagers simulated by Mass.
+	FMassEntityQuery EntityQuery;
+};
+
+// Applies one minute of the running activities' need curves to Mass villagers, mirroring the village needs stage.
+// Villagers whose need bottoms out are destroyed once the step's commands flush.
+UCLASS()
+class UVillagerMassNeedsProcessor : public UMassProcessor
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+public:
+	// Configures the processor to run only when the village Mass subsystem executes it.
+	UVillagerMassNeedsProcessor();
+
+protected:
+	// Declares fragment access.
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+
+	// Integrates one minute for every simulated villager.
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	// Villagers simulated by Mass.
+	FMassEntityQuery EntityQuery;
+};
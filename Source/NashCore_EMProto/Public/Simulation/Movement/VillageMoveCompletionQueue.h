@@ -0,0 +1,94 @@
+// Prevents multiple inclusion of the move completion queue header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Core types and macros.
+#include "CoreMinimal.h"
+// Base world subsystem for per-world lifetime.
+#include "Subsystems/WorldSubsystem.h"
+// Provides the tick function draining the queue.
+#include "Engine/EngineBaseTypes.h"
+#pragma endregion Includes
+
+// Generated header required for reflection.
+#include "VillageMoveCompletionQueue.generated.h"
+
+// Forward declare the queue and the movement component it notifies.
+class UVillageMoveCompletionQueue;
+class UVillagerMovementComponent;
+
+// Tick function draining the move completion queue once per frame.
+USTRUCT()
+struct FVillageMoveCompletionTickFunction : public FTickFunction
+{
+	GENERATED_BODY() // Enables reflection.
+
+	// Queue drained by this tick function.
+	UVillageMoveCompletionQueue* Target = nullptr;
+
+	// Drains the queue.
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+
+	// Names the tick function in tick diagnostics.
+	virtual FString DiagnosticMessage() override;
+};
+
+// Tick functions cannot be copied once registered.
+template<>
+struct TStructOpsTypeTraits<FVillageMoveCompletionTickFunction> : public TStructOpsTypeTraitsBase2<FVillageMoveCompletionTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+// Deferred delivery of villager move results.
+// Movement components push a record per finished or failed move instead of scheduling a task each; the queue drains
+// the records once per frame in TG_PostUpdateWork, in push order, so callbacks never run inside the move request that
+// produced them. Records pushed while draining are delivered on the next frame.
+UCLASS()
+class UVillageMoveCompletionQueue : public UWorldSubsystem
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+public:
+	// Ensure creation for all worlds.
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
+
+	// Registers the drain tick function with the world's persistent level.
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// Unregisters the tick function and drops undelivered records.
+	virtual void Deinitialize() override;
+
+	// Queues the result of a component's move for delivery at the next drain.
+	void Push(UVillagerMovementComponent* Component, uint32 MoveSerial, bool bSuccess);
+
+	// Delivers every record queued before the call.
+	void Drain();
+
+private:
+	// Result of one move awaiting delivery.
+	struct FCompletion
+	{
+		// Component whose move finished.
+		TWeakObjectPtr<UVillagerMovementComponent> Component;
+
+		// Move the result belongs to; stale once the component starts another move.
+		uint32 MoveSerial = 0;
+
+		// Whether the move reached its target.
+		bool bSuccess = false;
+	};
+
+	// Tick function draining the queue.
+	FVillageMoveCompletionTickFunction DrainTickFunction;
+
+	// Records awaiting the next drain.
+	TArray<FCompletion> Pending;
+
+	// Records being delivered; swapped with Pending so both allocations are reused.
+	TArray<FCompletion> Draining;
+};
@@ -0,0 +1,91 @@
+// Prevents multiple inclusion of the navigation cache header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Core types and macros.
+#include "CoreMinimal.h"
+// Base class for tickable world subsystems.
+#include "Subsystems/WorldSubsystem.h"
+// Provides navigation path types served to movement requests.
+#include "NavigationData.h"
+#pragma endregion Includes
+
+// Generated header required for reflection.
+#include "VillageNavigationCache.generated.h"
+
+// Precomputed routes between every pair of registered locations.
+// Villagers only travel between tagged location instances, so the cache finds each pair's path once after the navmesh
+// is ready and serves it to movement requests and provider selection. Routes are found a few per frame: every route
+// after a navigation rebuild, and only the rows and columns of added or moved locations when the registry changes.
+UCLASS()
+class UVillageNavigationCache : public UTickableWorldSubsystem
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+public:
+	// Ensure creation for all worlds.
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
+
+	// Binds to location registry changes.
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	// Unbinds from the registry and drops cached routes.
+	virtual void Deinitialize() override;
+
+	// Finds the next batch of routes while the matrix is incomplete.
+	virtual void Tick(float DeltaTime) override;
+
+	// Provides the stat identifier used by the tickable object manager.
+	virtual TStatId GetStatId() const override;
+
+	// Returns a copy of the cached path between the locations nearest two points, or null when no route is cached.
+	// Copies are served because path following observes and invalidates the path it follows; they end at To, not at
+	// the snapped location.
+	FNavPathSharedPtr FindPath(const FVector& From, const FVector& To) const;
+
+	// Cost reported for routes searched without finding a complete path.
+	static constexpr float UnreachableCost = TNumericLimits<float>::Max();
+
+	// Returns the cached path length between the locations nearest two points, plus the final leg to To; UnreachableCost
+	// when the route was searched without a complete path, or a negative value while the route is unknown.
+	float GetTravelCost(const FVector& From, const FVector& To) const;
+
+	// Returns whether every route between the registered locations has been found.
+	bool IsComplete() const { return NextRouteIndex >= Routes.Num(); }
+
+private:
+	// Travel data from one registered location to another.
+	struct FRoute
+	{
+		// Path found once navigation was ready; null when unreachable or not yet found.
+		FNavPathSharedPtr Path;
+
+		// Path length in centimeters; negative until searched, UnreachableCost when no complete path exists.
+		float Cost = -1.0f;
+
+		// Whether the route was searched, found or not.
+		bool bResolved = false;
+	};
+
+	// Collects the registry's locations, keeps the routes between unchanged locations and schedules the rest.
+	void HandleLocationsChanged(bool bNavigationRebuilt);
+
+	// Returns the registered location within snapping distance of a point, or INDEX_NONE.
+	int32 FindNode(const FVector& Position) const;
+
+	// Returns the cached route between two points, or null when either point is off the location set.
+	const FRoute* FindRoute(const FVector& From, const FVector& To) const;
+
+	// Binding to the location registry's change event.
+	FDelegateHandle LocationsChangedHandle;
+
+	// Projected location of every registered instance.
+	TArray<FVector> Nodes;
+
+	// Routes indexed by From * Nodes.Num() + To.
+	TArray<FRoute> Routes;
+
+	// Next route to visit; routes already resolved are skipped. Equals Routes.Num() once the matrix is complete.
+	int32 NextRouteIndex = 0;
+};
@@ -0,0 +1,76 @@
+// Prevents multiple inclusion of the path request queue header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Core types and macros.
+#include "CoreMinimal.h"
+// Base class for tickable world subsystems.
+#include "Subsystems/WorldSubsystem.h"
+// Provides navigation path and query result types.
+#include "NavigationData.h"
+#pragma endregion Includes
+
+// Generated header required for reflection.
+#include "VillagePathRequestQueue.generated.h"
+
+// Forward declare the movement component receiving resolved paths.
+class UVillagerMovementComponent;
+
+// Frame-batched asynchronous pathfinding for villager moves.
+// Move requests issued during a frame are queued and dispatched to FindPathAsync from Tick, at most a fixed number per
+// frame, so an hour boundary switching many villagers at once spreads its queries over the navigation worker instead
+// of spiking the game thread. Results return to the requesting movement component on the game thread.
+UCLASS()
+class UVillagePathRequestQueue : public UTickableWorldSubsystem
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+public:
+	// Ensure creation for all worlds.
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
+
+	// Aborts in-flight queries and drops queued requests.
+	virtual void Deinitialize() override;
+
+	// Dispatches queued requests up to the per-frame budget.
+	virtual void Tick(float DeltaTime) override;
+
+	// Provides the stat identifier used by the tickable object manager.
+	virtual TStatId GetStatId() const override;
+
+	// Queues a path from the requester's location at dispatch time to a target; returns the request identifier.
+	uint32 RequestPath(UVillagerMovementComponent* Requester, const FVector& TargetLocation);
+
+	// Drops a queued or in-flight request without notifying its requester.
+	void CancelRequest(uint32 RequestId);
+
+	// Returns the number of requests waiting for dispatch.
+	int32 GetQueuedCount() const { return Queued.Num(); }
+
+private:
+	// Path request of one villager.
+	struct FPendingRequest
+	{
+		// Component receiving the path.
+		TWeakObjectPtr<UVillagerMovementComponent> Requester;
+
+		// Location the path leads to.
+		FVector TargetLocation = FVector::ZeroVector;
+
+		// Identifier handed to the requester.
+		uint32 RequestId = 0;
+	};
+
+	// Receives an asynchronous query result on the game thread.
+	void HandlePathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+
+	// Requests waiting for dispatch, oldest first.
+	TArray<FPendingRequest> Queued;
+
+	// Dispatched requests keyed by navigation query identifier.
+	TMap<uint32, FPendingRequest> InFlight;
+
+	// Next identifier handed out; zero is never used.
+	uint32 NextRequestId = 1;
+};
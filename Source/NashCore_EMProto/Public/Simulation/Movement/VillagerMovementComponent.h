@@ -47,6 +47,21 @@ public:
 	// Applies new movement tuning parameters.
 	void ApplyMovementDefinition(const FMovementDefinition& Definition);
 
+	// Receives the path found for a queued request; null paths fail the move. Called by the path request queue.
+	void HandlePathResolved(uint32 RequestId, FNavPathSharedPtr Path);
+
+	// Executes the pending delegate unless a newer move replaced it. Called by the move completion queue.
+	void ExecuteMoveFinished(uint32 InMoveSerial, bool bSuccess);
+
+	// Returns whether the current move is simulated abstractly instead of walked.
+	bool IsTravellingAbstractly() const;
+
+	// Enables or disables abstract travel for every villager, e.g. to benchmark full locomotion.
+	static void SetAbstractTravelEnabled(bool bInEnabled);
+
+	// Returns whether abstract travel is globally enabled.
+	static bool IsAbstractTravelEnabled();
+
 private:
 	// Handles move completion events from the AI controller.
 	UFUNCTION()
@@ -58,9 +73,30 @@ private:
 	// Retrieves or caches the AI controller.
 	AAIController* ResolveAIController();
 
-	// Executes the pending delegate, deferring to avoid re-entrancy loops.
+	// Queues the pending delegate's result with the move completion queue to avoid re-entrancy loops.
 	void DispatchMoveFinished(bool bSuccess);
 
+	// Returns whether nobody can see the villager walk: off-screen or beyond the abstract travel distance from the camera.
+	bool ShouldTravelAbstractly() const;
+
+	// Times the move along a resolved path from its length and the walk speed.
+	void StartAbstractTravel(const FNavPathSharedPtr& Path);
+
+	// Starts walking or abstract travel along a resolved path; fails the move when the path is missing.
+	void StartResolvedMove(const FNavPathSharedPtr& Path);
+
+	// Drops a path request still waiting in the queue.
+	void CancelPathRequest();
+
+	// Places the villager at the destination and reports success.
+	void HandleAbstractTravelArrived();
+
+	// Stops a pending abstract move without notifying.
+	void CancelAbstractTravel();
+
+	// Returns the village navigation cache's path from the villager to a target, or null when the route is not cached.
+	FNavPathSharedPtr FindCachedPath(const FVector& TargetLocation) const;
+
 	// Cached movement definition settings.
 	UPROPERTY(EditAnywhere, Category = "Villager")
 	FMovementDefinition MovementDefinition;
@@ -74,4 +110,40 @@ private:
 
 	// Active request identifier to validate callbacks.
 	FAIRequestID ActiveRequestId;
+
+	// Whether this villager may travel abstractly when unobserved.
+	UPROPERTY(EditAnywhere, Category = "Villager|LOD")
+	bool bAllowAbstractTravel = true;
+
+	// Camera distance beyond which villagers travel abstractly even when on screen.
+	UPROPERTY(EditAnywhere, Category = "Villager|LOD", meta = (ClampMin = "0.0"))
+	float AbstractTravelDistance = 4000.0f;
+
+	// Seconds since the last render after which a villager counts as off-screen.
+	UPROPERTY(EditAnywhere, Category = "Villager|LOD", meta = (ClampMin = "0.0"))
+	float OffScreenTolerance = 0.5f;
+
+	// Incremented per move request so queued results of replaced moves are dropped.
+	uint32 MoveSerial = 0;
+
+	// Queued path request awaiting its result; zero when none.
+	uint32 PendingPathRequestId = 0;
+
+	// Target of the current request.
+	FVector PendingTargetLocation = FVector::ZeroVector;
+
+	// Acceptance radius of the current request.
+	float PendingAcceptanceRadius = 0.0f;
+
+	// Whether the current request travels abstractly once its path arrives.
+	bool bPendingAbstractTravel = false;
+
+	// Timer firing when an abstract move arrives.
+	FTimerHandle AbstractTravelHandle;
+
+	// Actor location the villager is placed at when the abstract move arrives.
+	FVector AbstractTravelDestination = FVector::ZeroVector;
+
+	// Global switch for abstract travel.
+	static bool bAbstractTravelEnabled;
 };
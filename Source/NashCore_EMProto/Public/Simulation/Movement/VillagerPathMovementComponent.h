@@ -0,0 +1,67 @@
+// Prevents multiple inclusion of the path movement component header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Provides core UE types.
+#include "CoreMinimal.h"
+// Supplies the pawn movement base driven by path following.
+#include "GameFramework/PawnMovementComponent.h"
+#pragma endregion Includes
+
+// Generated header required for reflection.
+#include "VillagerPathMovementComponent.generated.h"
+
+// Minimal navmesh path-following movement for villager pawns.
+// Applies the velocity requested by path following without sweeps, floor checks or physics, periodically re-projects
+// the pawn onto the navmesh to follow slopes, and stops ticking while the pawn stands still.
+UCLASS(ClassGroup = (Simulation), meta = (BlueprintSpawnableComponent))
+class UVillagerPathMovementComponent : public UPawnMovementComponent
+{
+	GENERATED_BODY() // Enables reflection.
+
+public:
+	// Default constructor configuring a walking nav agent.
+	UVillagerPathMovementComponent();
+
+	// Moves the updated component along the requested velocity.
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// Returns the walk speed.
+	virtual float GetMaxSpeed() const override { return MaxSpeed; }
+
+	// Villagers always walk on the navmesh.
+	virtual bool IsMovingOnGround() const override { return true; }
+
+	// Stores the path following velocity and resumes ticking.
+	virtual void RequestDirectMove(const FVector& MoveVelocity, bool bForceMaxSpeed) override;
+
+	// Applies the walk speed.
+	void SetMaxSpeed(float InMaxSpeed);
+
+	// Applies the yaw turn rate in degrees per second.
+	void SetRotationRate(float InRotationRate);
+
+private:
+	// Snaps a location onto the navmesh; returns false when no navmesh is near.
+	bool ProjectToNavigation(FVector& InOutLocation) const;
+
+	// Walk speed in centimeters per second.
+	UPROPERTY(EditAnywhere, Category = "Villager", meta = (ClampMin = "0.0"))
+	float MaxSpeed = 300.0f;
+
+	// Yaw turn rate in degrees per second.
+	UPROPERTY(EditAnywhere, Category = "Villager", meta = (ClampMin = "0.0"))
+	float RotationRate = 540.0f;
+
+	// Seconds between navmesh re-projections while moving.
+	UPROPERTY(EditAnywhere, Category = "Villager", meta = (ClampMin = "0.0"))
+	float ProjectionInterval = 0.25f;
+
+	// Search extent of navmesh re-projections.
+	UPROPERTY(EditAnywhere, Category = "Villager")
+	FVector ProjectionExtent = FVector(50.0f, 50.0f, 250.0f);
+
+	// Seconds until the next re-projection.
+	float ProjectionCountdown = 0.0f;
+};
@@ -0,0 +1,128 @@
+// Prevents multiple inclusion of the needs stage header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Core types and macros.
+#include "CoreMinimal.h"
+// Base world subsystem for per-world lifetime.
+#include "Subsystems/WorldSubsystem.h"
+// Provides stable keys for registered components.
+#include "UObject/ObjectKey.h"
+#pragma endregion Includes
+
+// Generated header required for reflection.
+#include "VillageNeedsSubsystem.generated.h"
+
+// Forward declare the components driven by the stage.
+class UVillagerActivityComponent;
+class UVillagerNeedsComponent;
+struct FVillagerCompiledNeedCurve;
+
+// Kinds of events the needs stage hands back to the game thread.
+enum class EVillageNeedsStageEvent : uint8
+{
+	BandCrossed // A need moved into a different urgency band.
+};
+
+// Compact event produced by the needs stage for one need of one villager.
+struct FVillageNeedsStageEventRecord
+{
+	// Index into the step's villager list.
+	int32 VillagerIndex = INDEX_NONE;
+
+	// Need index within the villager's archetype.
+	int32 NeedIndex = INDEX_NONE;
+
+	// What happened to the need.
+	EVillageNeedsStageEvent Type = EVillageNeedsStageEvent::BandCrossed;
+};
+
+// Village-wide needs stage applying every active villager's per-minute curve deltas in one batched pass.
+// Runs after each minute's wakeups: deltas are gathered into flat arrays on the game thread, clamped and classified
+// with ParallelFor, then written back with one notification per villager and a compact list of band-crossing events. Needs reaching their minimum are
+// flagged on the needs component, which resolves the death when the villager's batch flushes.
+UCLASS()
+class UVillageNeedsSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+public:
+	// Ensure creation for all worlds.
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
+
+	// Binds to the clock's per-minute hook.
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	// Unbinds from the clock and drops registrations.
+	virtual void Deinitialize() override;
+
+	// Adds a villager whose active activity curves the stage should integrate.
+	void RegisterVillager(UVillagerActivityComponent* ActivityComponent);
+
+	// Removes a villager from the stage.
+	void UnregisterVillager(UVillagerActivityComponent* ActivityComponent);
+
+	// Returns whether the stage integrates needs; when disabled each villager integrates its own curves.
+	bool IsStageEnabled() const { return bStageEnabled; }
+
+	// Enables or disables the stage.
+	void SetStageEnabled(bool bInEnabled);
+
+	// Returns the events produced by the most recent step.
+	TConstArrayView<FVillageNeedsStageEventRecord> GetLastStepEvents() const { return Events; }
+
+private:
+	// Integrates one minute for every registered villager.
+	void ProcessMinute(int64 Minute);
+
+	// Collects one row per active need curve into the flat arrays.
+	void GatherRows(int64 Minute);
+
+	// Clamps, classifies and flags every row in parallel.
+	void RunKernel();
+
+	// Writes results back per villager and compacts the event list.
+	void ScatterRows();
+
+	// Delivers crossing events to the affected villagers.
+	void DispatchEvents();
+
+	// Whether the stage integrates needs.
+	bool bStageEnabled = true;
+
+	// Binding to the clock's per-minute hook.
+	FDelegateHandle MinuteProcessedHandle;
+
+	// Registered villagers; order is stable between registrations.
+	TArray<TObjectKey<UVillagerActivityComponent>> Villagers;
+
+	// Slot of each registered villager for swap removal.
+	TMap<TObjectKey<UVillagerActivityComponent>, int32> VillagerSlots;
+
+	// Villagers with at least one row this step; callbacks may unregister villagers while the step runs.
+	TArray<UVillagerActivityComponent*> StepVillagers;
+
+	// Needs component of each step villager.
+	TArray<UVillagerNeedsComponent*> StepNeeds;
+
+	// First row of each step villager, plus one trailing entry holding the row count.
+	TArray<int32> StepFirstRow;
+
+	// Row columns: need index, curve, elapsed minute and need bounds.
+	TArray<int32> RowNeed;
+	TArray<const FVillagerCompiledNeedCurve*> RowCurve;
+	TArray<float> RowElapsed;
+	TArray<float> RowValue;
+	TArray<float> RowMin;
+	TArray<float> RowMax;
+	TArray<float> RowMild;
+	TArray<float> RowCritical;
+
+	// Kernel outputs: new value and event flags per row.
+	TArray<float> RowResult;
+	TArray<uint8> RowFlags;
+
+	// Events produced by the most recent step.
+	TArray<FVillageNeedsStageEventRecord> Events;
+};
@@ -13,6 +13,8 @@
 
 // Forward declaration to support delegate declaration.
 class UVillagerNeedsComponent;
+// Forward declaration of the clock evaluated by lazy needs.
+class UVillageClockSubsystem;
 
 // Generated header include for reflection support.
 #include "VillagerNeedsComponent.generated.h"
@@ -26,29 +28,25 @@ enum class EVillagerNeedUrgency : uint8
 	Critical // Value is at or below the critical threshold.
 };
 
-// Captures runtime state for a single need with its static definition.
-USTRUCT(BlueprintType)
-struct FNeedRuntimeState
+// Summary of the need changes delivered with one coalesced notification.
+struct FVillagerNeedsChangeSet
 {
-	GENERATED_BODY() // Adds reflection helpers.
+	// Indices of needs whose value changed, in ascending order.
+	TArray<int32, TInlineAllocator<8>> ChangedNeedIndices;
 
-public:
-	// Tag copied from the definition for quick lookups.
-	UPROPERTY(BlueprintReadOnly, Category = "Need")
-	FGameplayTag NeedTag;
-
-	// Current numeric value clamped within allowed bounds.
-	UPROPERTY(BlueprintReadOnly, Category = "Need")
-	float CurrentValue = 0.0f;
+	// Whether any changed need moved into a different urgency band.
+	bool bUrgencyBandCrossed = false;
 
-	// Copy of the static definition for access to thresholds and weight.
-	UPROPERTY(BlueprintReadOnly, Category = "Need")
-	FNeedDefinition Definition;
+	// Whether the need list was rebuilt, invalidating previously cached indices.
+	bool bNeedsRebuilt = false;
 };
 
 // Delegate fired whenever the needs state changes.
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnVillagerNeedsUpdated, UVillagerNeedsComponent*, NeedsComponent);
 
+// Native delegate fired once per flush with the changes accumulated since the previous one.
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnVillagerNeedsChanged, UVillagerNeedsComponent*, const FVillagerNeedsChangeSet&);
+
 // Component responsible for tracking and evaluating villager needs.
 UCLASS(ClassGroup = (Simulation), Blueprintable, meta = (BlueprintSpawnableComponent))
 class UVillagerNeedsComponent : public UActorComponent
@@ -59,17 +57,71 @@ public:
 	// Standard constructor enabling defaults.
 	UVillagerNeedsComponent();
 
+	// Resolves the clock before any component's BeginPlay can anchor lazy needs.
+	virtual void InitializeComponent() override;
+
 	// Initializes runtime state from the archetype asset at BeginPlay.
 	virtual void BeginPlay() override;
 
 	// Applies a delta to a need identified by tag, clamping to bounds.
 	void ApplyNeedDelta(const FGameplayTag& NeedTag, float Delta);
 
-	// Fetches the highest priority need meeting or exceeding the urgency threshold.
-	bool GetHighestPriorityNeed(EVillagerNeedUrgency MinimumUrgency, FNeedRuntimeState& OutNeed) const;
+	// Applies a delta to a need identified by index, clamping to bounds.
+	void ApplyNeedDeltaByIndex(int32 NeedIndex, float Delta);
+
+	// Stores a value already clamped and classified by the village needs stage.
+	void StoreStageResult(int32 NeedIndex, float NewValue, bool bBandCrossed, bool bBottomedOut);
+
+	// Defers change notifications until the matching EndNeedsBatch; batches may nest.
+	void BeginNeedsBatch();
+
+	// Closes a batch and flushes accumulated changes when the outermost batch ends.
+	void EndNeedsBatch();
+
+	// Returns the index of the highest priority need meeting the urgency threshold, or INDEX_NONE.
+	int32 FindHighestPriorityNeed(EVillagerNeedUrgency MinimumUrgency) const;
+
+	// Returns the number of needs tracked for the current archetype.
+	int32 GetNeedCount() const;
+
+	// Returns whether an index refers to a tracked need.
+	bool IsValidNeedIndex(int32 NeedIndex) const;
+
+	// Returns the index of a need tag, or INDEX_NONE when the villager does not track it.
+	int32 FindNeedIndex(const FGameplayTag& NeedTag) const;
+
+	// Returns the current value of a need.
+	float GetNeedValue(int32 NeedIndex) const;
+
+	// Returns the need value normalized to 0-1 within its bounds.
+	float GetNormalizedNeedValue(int32 NeedIndex) const;
+
+	// Returns the urgency band of a need.
+	EVillagerNeedUrgency GetNeedUrgency(int32 NeedIndex) const;
+
+	// Returns the shared static definition of a need.
+	const FNeedDefinition& GetNeedDefinition(int32 NeedIndex) const;
+
+	// Exposes the stored need values, indexed like the archetype's NeedDefinitions; in lazy mode these are anchor values, so use GetNeedValue for current ones.
+	const TArray<float>& GetNeedValues() const;
+
+	// Returns whether need values are evaluated on demand from per-need rates instead of per-minute deltas.
+	bool IsLazyEvaluation() const { return bLazyEvaluation; }
+
+	// Selects lazy evaluation; call before BeginPlay so activities pick the matching integration path.
+	void SetLazyEvaluation(bool bInLazy);
+
+	// Anchors a need at the current minute and lets it change by a constant amount per minute through ValidThroughMinute.
+	void SetNeedRate(int32 NeedIndex, float RatePerMinute, int64 ValidThroughMinute);
+
+	// Anchors every need at the current minute and stops all rates.
+	void ClearNeedRates();
+
+	// Anchors every need at the current minute, reporting changes, band crossings and deaths since the previous anchors.
+	void SyncLazyNeeds();
 
-	// Exposes the current need states.
-	const TArray<FNeedRuntimeState>& GetRuntimeNeeds() const;
+	// Returns the earliest minute at which a need crosses an urgency threshold, bottoms out or its rate expires; MAX_int64 when no rate is active.
+	int64 PredictNextNeedEventMinute() const;
 
 	// Allows external systems to read the archetype asset.
 	UVillagerArchetypeDataAsset* GetArchetype() const;
@@ -81,22 +133,99 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Need")
 	FOnVillagerNeedsUpdated OnNeedsUpdated;
 
+	// Delegate fired alongside OnNeedsUpdated with the needs that changed.
+	FOnVillagerNeedsChanged OnNeedsChanged;
+
 private:
-	// Creates runtime states from the configured archetype.
+	// Creates runtime values from the configured archetype.
 	void BuildRuntimeNeeds();
 
 	// Converts a raw value into an urgency state using thresholds.
-	EVillagerNeedUrgency EvaluateUrgency(const FNeedRuntimeState& Need) const;
+	EVillagerNeedUrgency EvaluateUrgency(const FNeedDefinition& Definition, float Value) const;
+
+	// Broadcasts accumulated changes and applies deferred villager death.
+	void FlushNeedChanges();
+
+	// Returns the clock minute lazy needs are evaluated at.
+	int64 GetCurrentSimMinute() const;
 
-	// Retrieves a runtime state by need tag.
-	bool TryGetRuntimeNeed(const FGameplayTag& NeedTag, FNeedRuntimeState& OutNeed) const;
+	// Evaluates a lazy need at a minute from its anchor and rate.
+	float EvaluateLazyValue(int32 NeedIndex, int64 Minute) const;
 
+	// Moves a lazy need's anchor to a minute, recording the change like a delta would.
+	void AnchorNeed(int32 NeedIndex, int64 Minute);
+
+	// Returns the earliest event minute of one lazy need.
+	int64 PredictNeedEventMinute(int32 NeedIndex) const;
 
 	// Archetype asset that defines needs and activities for this villager.
 	UPROPERTY(EditAnywhere, Category = "Villager")
 	TObjectPtr<UVillagerArchetypeDataAsset> Archetype;
 
-	// Runtime list of needs with mutable values.
+	// Whether needs are evaluated on demand from anchors and rates; activities then wake villagers only at predicted crossings.
+	UPROPERTY(EditAnywhere, Category = "Villager")
+	bool bLazyEvaluation = false;
+
+	// Current need values, indexed like the archetype's NeedDefinitions; anchor values in lazy mode.
 	UPROPERTY(VisibleAnywhere, Category = "Villager")
-	TArray<FNeedRuntimeState> RuntimeNeeds;
+	TArray<float> NeedValues;
+
+	// Clock minute each lazy need value was anchored at.
+	TArray<int64> AnchorMinutes;
+
+	// Per-minute change of each lazy need after its anchor.
+	TArray<float> NeedRates;
+
+	// Last minute each lazy rate applies to.
+	TArray<int64> RateValidThrough;
+
+	// Clock used to evaluate lazy needs.
+	UPROPERTY()
+	TObjectPtr<UVillageClockSubsystem> ClockSubsystem;
+
+	// Needs changed since the last flush, indexed like NeedValues.
+	TBitArray<> DirtyNeeds;
+
+	// Depth of open batches; notifications are deferred while positive.
+	int32 NeedsBatchDepth = 0;
+
+	// Whether a need changed urgency band since the last flush.
+	bool bPendingUrgencyBandCrossed = false;
+
+	// Whether the need list was rebuilt since the last flush.
+	bool bPendingRebuild = false;
+
+	// Whether a need bottomed out since the last flush.
+	bool bPendingDeathCheck = false;
+};
+
+// Scoped needs batch coalescing all changes inside the scope into one notification.
+struct FVillagerNeedsBatchScope
+{
+	// Opens a batch on the component; null components are ignored.
+	explicit FVillagerNeedsBatchScope(UVillagerNeedsComponent* InNeedsComponent)
+		: NeedsComponent(InNeedsComponent)
+	{
+		if (NeedsComponent) // Skip missing components.
+		{
+			NeedsComponent->BeginNeedsBatch(); // Defer notifications.
+		}
+	}
+
+	// Closes the batch, flushing when it is the outermost one.
+	~FVillagerNeedsBatchScope()
+	{
+		if (NeedsComponent) // Skip missing components.
+		{
+			NeedsComponent->EndNeedsBatch(); // Flush deferred notifications.
+		}
+	}
+
+	// Non-copyable to keep begin and end balanced.
+	FVillagerNeedsBatchScope(const FVillagerNeedsBatchScope&) = delete;
+	FVillagerNeedsBatchScope& operator=(const FVillagerNeedsBatchScope&) = delete;
+
+private:
+	// Component the batch was opened on.
+	UVillagerNeedsComponent* NeedsComponent;
 };
@@ -0,0 +1,83 @@
+// Prevents multiple inclusion of the provider registry header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Core types and macros.
+#include "CoreMinimal.h"
+// Base world subsystem for per-world lifetime.
+#include "Subsystems/WorldSubsystem.h"
+// Gameplay tags for keyed lookup.
+#include "GameplayTagContainer.h"
+// Provides stable keys for registered components.
+#include "UObject/ObjectKey.h"
+#pragma endregion Includes
+
+// Generated header required for reflection.
+#include "VillageProviderRegistry.generated.h"
+
+// Forward declare the provider component and location registry.
+class UVillagerSocialComponent;
+class UVillageLocationRegistry;
+
+// Trade location resolved through the location registry.
+struct FVillageProviderTradeLocation
+{
+	// Tag of the trade location.
+	FGameplayTag LocationTag;
+
+	// Navmesh-projected transform of the trade location.
+	FTransform LocationTransform;
+};
+
+// Registered provider with its cached trade locations.
+struct FVillageProviderEntry
+{
+	// Provider social component used to negotiate resources.
+	TWeakObjectPtr<UVillagerSocialComponent> SocialComponent;
+
+	// Provider actor used to validate spatial presence.
+	TWeakObjectPtr<AActor> ProviderActor;
+
+	// Trade location tags authored on the provider archetype.
+	TArray<FGameplayTag> TradeLocationTags;
+
+	// Trade locations that resolved to a transform; unresolved tags are omitted.
+	TArray<FVillageProviderTradeLocation> TradeLocations;
+
+	// Location registry revision the trade locations were resolved against; INDEX_NONE when never resolved.
+	int32 ResolvedRevision = INDEX_NONE;
+};
+
+// Subsystem indexing resource providers by the resource they supply so lookups scale with provider count.
+UCLASS()
+class UVillageProviderRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+public:
+	// Ensure creation for all worlds.
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
+
+	// Drops all providers on shutdown.
+	virtual void Deinitialize() override;
+
+	// Registers or re-registers a provider under its current provided resource tag.
+	void RegisterProvider(UVillagerSocialComponent* SocialComponent);
+
+	// Removes a provider from the index.
+	void UnregisterProvider(UVillagerSocialComponent* SocialComponent);
+
+	// Returns providers of a resource with trade locations resolved against the current location registry.
+	TConstArrayView<FVillageProviderEntry> GetProviders(const FGameplayTag& ResourceTag);
+
+private:
+	// Resolves cached trade transforms when the location registry changed since the last resolve.
+	void ResolveTradeLocations(FVillageProviderEntry& Entry, UVillageLocationRegistry* LocationRegistry) const;
+
+	// Providers keyed by provided resource tag.
+	TMap<FGameplayTag, TArray<FVillageProviderEntry>> ProvidersByResource;
+
+	// Resource tag each registered component was filed under, for unregistration after archetype changes.
+	TMap<TObjectKey<UVillagerSocialComponent>, FGameplayTag> ResourceBySocialComponent;
+};
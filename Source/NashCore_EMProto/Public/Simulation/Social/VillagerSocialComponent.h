@@ -15,9 +15,15 @@
 #include "Simulation/Logging/VillagerLogComponent.h"
 #pragma endregion Includes
 
+// Forward declaration to support delegate declaration.
+class UVillagerSocialComponent;
+
 // Generated header required for reflection.
 #include "VillagerSocialComponent.generated.h"
 
+// Native delegate fired after any affection value of the component changed.
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnVillagerAffectionChanged, UVillagerSocialComponent*);
+
 // Component managing approvals and resource trades between villagers.
 UCLASS(ClassGroup = (Simulation), Blueprintable, meta = (BlueprintSpawnableComponent))
 class UVillagerSocialComponent : public UActorComponent
@@ -31,6 +37,9 @@ public:
 	// Initializes approval maps from archetype data.
 	virtual void BeginPlay() override;
 
+	// Removes this villager from the provider index.
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// Requests a resource amount based on affection and need urgency.
 	float RequestResource(const FGameplayTag& RequesterId, const FGameplayTag& NeedTag, EVillagerNeedUrgency NeedUrgency);
 
@@ -52,6 +61,15 @@ public:
 	// Returns a snapshot of current affection values keyed by villager id.
 	TMap<FGameplayTag, float> GetAffectionSnapshot() const;
 
+	// Returns current affection values keyed by villager id without copying them.
+	const TMap<FGameplayTag, float>& GetAffections() const { return AffectionMap; }
+
+	// Overwrites the affection toward another villager, e.g. when state is handed over from another backend.
+	void SetAffection(const FGameplayTag& OtherVillagerId, float Value);
+
+	// Delegate fired after affection values were added, changed or rebuilt.
+	FOnVillagerAffectionChanged OnAffectionChanged;
+
 private:
 	// Retrieves affection for a villager, inserting if missing.
 	float GetOrAddAffection(const FGameplayTag& VillagerId);
@@ -62,6 +80,9 @@ private:
 	// Rebuilds the affection map from archetype data.
 	void RebuildAffectionFromArchetype();
 
+	// Files this villager in the world provider index under its provided resource.
+	void RegisterWithProviderRegistry();
+
 	// Archetype asset containing social definitions.
 	UPROPERTY(EditAnywhere, Category = "Villager")
 	TObjectPtr<UVillagerArchetypeDataAsset> Archetype;
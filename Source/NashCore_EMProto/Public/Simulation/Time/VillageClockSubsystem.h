@@ -5,12 +5,14 @@
 #pragma region Includes
 // Provides core types and helper macros.
 #include "CoreMinimal.h"
-// Supplies the base class for world subsystems that live with the world.
+// Supplies the base class for tickable world subsystems that live with the world.
 #include "Subsystems/WorldSubsystem.h"
 // Brings in shared villager data types including the day phase enumeration.
 #include "Simulation/Data/VillagerDataAssets.h"
 // Grants access to delegates for broadcasting clock events.
 #include "Delegates/DelegateCombinations.h"
+// Supplies the hierarchical timing wheel used for villager wakeups.
+#include "Simulation/Time/VillageTimingWheel.h"
 #pragma endregion Includes
 
 // Generated header include required for Unreal reflection.
@@ -19,6 +21,9 @@
 // Declares a delegate fired every in-game minute with hour and minute payloads.
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnVillageMinuteChanged, int32, Hour, int32, Minute);
 
+// Native delegate fired after a minute's wakeups ran, with the monotonic minute counter.
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnVillageMinuteProcessed, int64);
+
 // Declares a delegate fired when the hour value changes.
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnVillageHourChanged, int32, Hour);
 
@@ -26,8 +31,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnVillageHourChanged, int32, Hour);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnVillagePhaseChanged, EVillageDayPhase, NewPhase);
 
 // World subsystem that owns the authoritative simulation clock.
+// Real time accumulates every frame and is converted into whole in-game minutes advanced in fixed steps.
 UCLASS()
-class UVillageClockSubsystem : public UWorldSubsystem
+class UVillageClockSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY() // Generates constructors and reflection metadata.
 
@@ -38,22 +44,64 @@ public:
 	// Returns true to create the subsystem for any world.
 	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
 
-	// Initializes the subsystem and starts the clock timer.
+	// Initializes the subsystem and starts the clock.
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 
-	// Cleans up timers on shutdown.
+	// Stops the clock and drops pending wakeups on shutdown.
 	virtual void Deinitialize() override;
 
+	// Accumulates real time and advances whole minutes within the per-frame step budget.
+	virtual void Tick(float DeltaTime) override;
+
+	// Provides the stat identifier used by the tickable object manager.
+	virtual TStatId GetStatId() const override;
+
 	// Starts the in-game clock if it is not already running.
 	void StartClock();
 
-	// Stops the in-game clock and clears timers.
+	// Stops the in-game clock and discards any partially accumulated minute.
 	void StopClock();
 
+	// Returns whether the clock advances on world tick.
+	UFUNCTION(BlueprintPure, Category = "Village Clock")
+	bool IsClockRunning() const;
+
+	// Advances the clock by a number of whole minutes immediately, regardless of the running state or step budget.
+	UFUNCTION(BlueprintCallable, Category = "Village Clock")
+	void AdvanceMinutes(int32 MinuteCount);
+
 	// Sets the number of real seconds that equal one in-game minute.
 	UFUNCTION(BlueprintCallable, Category = "Village Clock")
 	void SetSecondsPerGameMinute(float InSecondsPerGameMinute);
 
+	// Retrieves the number of real seconds that equal one in-game minute.
+	UFUNCTION(BlueprintPure, Category = "Village Clock")
+	float GetSecondsPerGameMinute() const;
+
+	// Sets how many minutes may be simulated in a single frame; surplus time carries over up to a small backlog and the rest is dropped.
+	UFUNCTION(BlueprintCallable, Category = "Village Clock")
+	void SetMaxStepsPerFrame(int32 InMaxStepsPerFrame);
+
+	// Retrieves how many minutes may be simulated in a single frame.
+	UFUNCTION(BlueprintPure, Category = "Village Clock")
+	int32 GetMaxStepsPerFrame() const;
+
+	// Sets the seed villager random streams are derived from; villagers seed their streams when they begin play.
+	UFUNCTION(BlueprintCallable, Category = "Village Clock")
+	void SetWorldSeed(int32 InWorldSeed);
+
+	// Retrieves the seed villager random streams are derived from.
+	UFUNCTION(BlueprintPure, Category = "Village Clock")
+	int32 GetWorldSeed() const;
+
+	// Returns a serial unique to one villager in this world, handed out in begin-play order; distinguishes villagers
+	// sharing an archetype when seeding their streams.
+	uint32 AcquireVillagerSerial();
+
+	// Returns simulation time in minutes including the fraction of the minute currently accumulating.
+	UFUNCTION(BlueprintPure, Category = "Village Clock")
+	double GetSimTimeMinutes() const;
+
 	// Retrieves the current hour.
 	UFUNCTION(BlueprintPure, Category = "Village Clock")
 	int32 GetCurrentHour() const;
@@ -66,10 +114,31 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Village Clock")
 	EVillageDayPhase GetCurrentPhase() const;
 
+	// Returns the number of in-game minutes elapsed since the clock started.
+	int64 GetTotalMinutes() const;
+
+	// Schedules a callback for an absolute simulation minute; past minutes fire on the next tick.
+	FVillageWakeupHandle ScheduleWakeup(int64 DueMinute, FOnVillageWakeup Callback);
+
+	// Cancels a pending wakeup and clears the handle.
+	void CancelWakeup(FVillageWakeupHandle& Handle);
+
+	// Returns the number of wakeups waiting in the scheduler.
+	int32 GetPendingWakeupCount() const;
+
+	// Returns whether the clock is currently running the minute's due wakeups.
+	bool IsDispatchingWakeups() const { return bDispatchingWakeups; }
+
 	// Multicast delegate raised each minute.
 	UPROPERTY(BlueprintAssignable, Category = "Village Clock")
 	FOnVillageMinuteChanged OnMinuteChanged;
 
+	// Raised after each minute's wakeups so village-wide stages see every villager's decisions for that minute.
+	FOnVillageMinuteProcessed OnMinuteProcessed;
+
+	// Raised after OnMinuteProcessed so deferred villager decisions see the minute's integrated needs.
+	FOnVillageMinuteProcessed OnMinuteDecisionPhase;
+
 	// Multicast delegate raised each hour.
 	UPROPERTY(BlueprintAssignable, Category = "Village Clock")
 	FOnVillageHourChanged OnHourChanged;
@@ -79,12 +148,15 @@ public:
 	FOnVillagePhaseChanged OnPhaseChanged;
 
 private:
-	// Internal tick called by the timer to advance one in-game minute.
+	// Advances one in-game minute and fires events.
 	void AdvanceOneMinute();
 
 	// Evaluates whether the day phase should switch based on the hour.
 	void UpdatePhaseFromHour();
 
+	// Executes the wakeups that became due on the current minute.
+	void DispatchDueWakeups();
+
 	// Cached current hour (0-23).
 	int32 CurrentHour;
 
@@ -94,9 +166,36 @@ private:
 	// Current day phase derived from the hour.
 	EVillageDayPhase CurrentPhase;
 
+	// Monotonic count of in-game minutes elapsed since the clock started.
+	int64 TotalMinutes;
+
+	// Scheduler holding villager wakeups keyed by absolute minute.
+	FVillageTimingWheel WakeupWheel;
+
+	// Scratch buffer reused to collect due wakeups each minute.
+	TArray<FOnVillageWakeup> DueWakeups;
+
 	// Real seconds corresponding to one in-game minute.
 	float SecondsPerGameMinute;
 
-	// Timer handle managing the recurring clock advancement.
-	FTimerHandle ClockTimerHandle;
+	// Maximum number of minutes simulated in a single frame.
+	int32 MaxStepsPerFrame;
+
+	// Seed shared by every villager random stream in this world.
+	int32 WorldSeed;
+
+	// Next serial handed to a villager.
+	uint32 NextVillagerSerial = 0;
+
+	// Maximum backlog of unsimulated minutes kept when frames cannot keep up; older time is dropped beyond this.
+	double MaxPendingMinutes;
+
+	// In-game minutes accumulated from real time but not yet simulated.
+	double PendingMinutes;
+
+	// Whether world ticks feed real time into the clock.
+	bool bClockRunning;
+
+	// Whether due wakeups are being executed.
+	bool bDispatchingWakeups;
 };
@@ -0,0 +1,104 @@
+// Prevents multiple inclusion of the timing wheel header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Provides core types, containers and delegate macros.
+#include "CoreMinimal.h"
+#pragma endregion Includes
+
+// Delegate executed when a scheduled simulation wakeup becomes due.
+DECLARE_DELEGATE(FOnVillageWakeup);
+
+// Lightweight handle identifying a scheduled wakeup so it can be cancelled or replaced.
+struct FVillageWakeupHandle
+{
+	// Unique identifier assigned by the wheel; zero means the handle is unset.
+	uint64 Id = 0;
+
+	// Returns whether the handle refers to a scheduled entry.
+	bool IsValid() const { return Id != 0; }
+
+	// Clears the handle without touching the wheel.
+	void Reset() { Id = 0; }
+};
+
+// Hierarchical timing wheel keyed on absolute simulation minutes.
+// Each level holds 64 slots; level N slots span 64^N minutes and cascade into the level below when the wheel reaches them.
+class FVillageTimingWheel
+{
+public:
+	// Constructor starting the wheel at minute zero.
+	FVillageTimingWheel();
+
+	// Drops every pending entry and restarts the wheel at the supplied minute.
+	void Reset(int64 InCurrentMinute);
+
+	// Schedules a callback for the supplied absolute minute; past minutes fire on the next advance.
+	FVillageWakeupHandle Schedule(int64 DueMinute, FOnVillageWakeup Callback);
+
+	// Cancels a pending entry and clears the handle; returns true when an entry was removed.
+	bool Cancel(FVillageWakeupHandle& Handle);
+
+	// Advances the wheel minute by minute up to NewMinute and appends every callback that became due.
+	void Advance(int64 NewMinute, TArray<FOnVillageWakeup>& OutDueCallbacks);
+
+	// Returns the number of pending entries.
+	int32 Num() const { return Entries.Num(); }
+
+	// Returns the minute the wheel last advanced to.
+	int64 GetCurrentMinute() const { return CurrentMinute; }
+
+private:
+	// Number of bits addressed by a single level.
+	static constexpr int32 SlotBits = 6;
+
+	// Number of slots per level.
+	static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+
+	// Mask used to extract a slot index.
+	static constexpr int64 SlotMask = SlotsPerLevel - 1;
+
+	// Number of levels; three levels cover 64^3 minutes (about 182 in-game days) before spilling to the overflow list.
+	static constexpr int32 LevelCount = 3;
+
+	// Pending wakeup payload stored by identifier.
+	struct FEntry
+	{
+		// Absolute minute at which the callback must run.
+		int64 DueMinute = 0;
+
+		// Callback executed when the entry becomes due.
+		FOnVillageWakeup Callback;
+	};
+
+	// Places an identifier into the level and slot matching its due minute relative to the current minute.
+	void Insert(uint64 Id, int64 DueMinute);
+
+	// Re-inserts every identifier of a higher-level slot so it lands in finer slots.
+	void CascadeSlot(int32 Level, int32 SlotIndex);
+
+	// Processes a single minute step, cascading higher levels and collecting due callbacks.
+	void Step(TArray<FOnVillageWakeup>& OutDueCallbacks);
+
+	// Returns the slot bucket for a level and slot index.
+	TArray<uint64>& GetSlot(int32 Level, int32 SlotIndex) { return Slots[Level * SlotsPerLevel + SlotIndex]; }
+
+	// Pending entries keyed by identifier; cancelled identifiers are skipped lazily when their slot is processed.
+	TMap<uint64, FEntry> Entries;
+
+	// Flattened slot buckets for every level.
+	TArray<uint64> Slots[LevelCount * SlotsPerLevel];
+
+	// Entries scheduled beyond the range of the highest level.
+	TArray<uint64> Overflow;
+
+	// Scratch buffer reused while cascading to avoid per-step allocations.
+	TArray<uint64> CascadeScratch;
+
+	// Minute the wheel has advanced to.
+	int64 CurrentMinute;
+
+	// Next identifier handed out by Schedule.
+	uint64 NextId;
+};
@@ -47,7 +47,7 @@ protected:
 	bool bAutoFindVillager = true;
 
 private:
-	// Attempts to locate a villager log component from the preferred actor or the level.
+	// Attempts to locate a villager log component from the preferred actor or the village event hub.
 	UVillagerLogComponent* ResolveLogComponent() const;
 
 	// Stored widget instance for cleanup.
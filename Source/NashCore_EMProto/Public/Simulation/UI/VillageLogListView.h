@@ -0,0 +1,99 @@
+// Prevents multiple inclusion of the log list view header.
+#pragma once
+
+// Region: Includes.
+#pragma region Includes
+// Provides base types and helper macros.
+#include "CoreMinimal.h"
+// Supplies the virtualized list view.
+#include "Components/ListView.h"
+// Supplies the base user widget class for list entries.
+#include "Blueprint/UserWidget.h"
+// Provides the list entry interface receiving item objects.
+#include "Blueprint/IUserObjectListEntry.h"
+// Provides villager log entries carried by list items.
+#include "Simulation/Logging/VillagerLogComponent.h"
+#pragma endregion Includes
+
+// Forward declare the text block rendering an entry.
+class UTextBlock;
+
+// Generated header required for reflection.
+#include "VillageLogListView.generated.h"
+
+// One villager log entry shown by the status widget's list view; text is formatted on first display.
+UCLASS()
+class UVillageLogListItem : public UObject
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+public:
+	// Fills or refills the item from a villager's log entry; the source may already be destroyed.
+	void Initialize(const UVillageEventLogSubsystem* InEventLog, const UVillagerLogComponent* InSource, const FGameplayTag& InVillagerTag, const FVillagerLogEntry& InEntry);
+
+	// Returns the formatted line, formatting and caching it on first use.
+	const FText& GetText() const;
+
+	// Returns the structured entry.
+	const FVillagerLogEntry& GetEntry() const { return Entry; }
+
+	// Returns the identifier of the villager that recorded the entry.
+	const FGameplayTag& GetVillagerTag() const { return VillagerTag; }
+
+	// Returns the source villager's text color.
+	const FLinearColor& GetColor() const { return Color; }
+
+	// Returns the source villager's font size.
+	int32 GetFontSize() const { return FontSize; }
+
+private:
+	// Village log resolving the entry's tag names.
+	TWeakObjectPtr<const UVillageEventLogSubsystem> EventLog;
+
+	// Identifier of the source villager, kept for filtering.
+	FGameplayTag VillagerTag;
+
+	// Copy of the entry, so the line survives the villager's ring buffer overwriting it.
+	FVillagerLogEntry Entry;
+
+	// Text color resolved when the item was created.
+	FLinearColor Color = FLinearColor::White;
+
+	// Font size resolved when the item was created.
+	int32 FontSize = 12;
+
+	// Formatted line, valid once bHasText is set.
+	mutable FText CachedText;
+
+	// Whether CachedText was formatted.
+	mutable bool bHasText = false;
+};
+
+// Recycled list entry rendering one log item as a styled text block.
+UCLASS()
+class UVillageLogEntryWidget : public UUserWidget, public IUserObjectListEntry
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+protected:
+	// Builds a text block layout when the entry was not designed in UMG.
+	virtual void NativeOnInitialized() override;
+
+	// Shows the item assigned to this recycled entry.
+	virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+
+	// Text block showing the line; optional so designed entries may bind their own.
+	UPROPERTY(meta = (BindWidgetOptional))
+	TObjectPtr<UTextBlock> EntryText;
+};
+
+// List view preconfigured with the villager log entry widget, used by the status widget's code-built layout.
+UCLASS()
+class UVillageLogListView : public UListView
+{
+	GENERATED_BODY() // Enables reflection and constructors.
+
+public:
+	// Sets the entry widget class and disables right-click scrolling so camera look input passes through.
+	UVillageLogListView(const FObjectInitializer& ObjectInitializer);
+};
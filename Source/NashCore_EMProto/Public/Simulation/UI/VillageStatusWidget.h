@@ -9,18 +9,28 @@
 #include "Blueprint/UserWidget.h" // Imports UUserWidget. 
 // Provides the FReply type for input overrides. 
 #include "Input/Reply.h" // Imports FReply. 
+// Provides the villager identifier type used by the log filter. 
+#include "GameplayTagContainer.h" // Imports FGameplayTag. 
+// Provides the event types used by the log filter. 
+#include "Simulation/Logging/VillageEventLogSubsystem.h" // Imports EVillageEventType. 
 #pragma endregion Includes // Ends the includes region. 
 
 // Groups forward declarations. 
 #pragma region ForwardDeclarations 
-// Forward-declared scroll box widget. 
-class UScrollBox; 
+// Forward-declared list view widget. 
+class UListView; 
 // Forward-declared text block widget. 
 class UTextBlock; 
 // Forward-declared clock subsystem type. 
 class UVillageClockSubsystem; 
 // Forward-declared villager log component type. 
 class UVillagerLogComponent; 
+// Forward-declared log list item type. 
+class UVillageLogListItem; 
+// Forward-declared event hub type. 
+class UVillageEventHubSubsystem; 
+// Forward-declared event hub notification type. 
+struct FVillageEventNotification; 
 // Forward-declared geometry struct for mouse events. 
 struct FGeometry; 
 // Forward-declared pointer event struct for mouse input. 
@@ -33,6 +43,9 @@ struct FPointerEvent;
 // Region: Widget declaration. 
 #pragma region VillageStatusWidgetDeclaration // Groups the widget declaration. 
 // Simple status widget that shows the simulation clock and recent log messages. 
+// Log lines are kept as list items in a bounded retention window and shown through a virtualized list view, so only 
+// visible rows own widgets and each line is formatted when first scrolled into view. New lines arrive from the village 
+// event hub as one batch per frame, which also covers villagers spawned after the widget. 
 UCLASS(BlueprintType, Blueprintable) // Exposes the widget to Blueprints. 
 class UVillageStatusWidget : public UUserWidget // Declares the widget type. 
 { // Opens the widget class declaration. 
@@ -40,9 +53,26 @@ class UVillageStatusWidget : public UUserWidget // Declares the widget type.
 
 public: // Begins the public section. 
 #pragma region PublicInterface // Groups public methods. 
-	// Initializes bindings to the clock subsystem and a villager log component. 
+	// Initializes bindings to the clock subsystem; lines of every villager registered with the event hub are shown, and 
+	// the buffered lines of InLogComponent are included even if it has not registered yet. 
 	UFUNCTION(BlueprintCallable, Category = "Village UI") // Exposes the initialization to Blueprints. 
 	void InitializeFromSources(UVillageClockSubsystem* InClockSubsystem, UVillagerLogComponent* InLogComponent); // Binds the widget to simulation sources. 
+
+	// Shows only the lines of one villager; an invalid tag shows every villager. 
+	UFUNCTION(BlueprintCallable, Category = "Village UI") // Exposes the filter to Blueprints. 
+	void SetVillagerFilter(FGameplayTag InVillagerIdTag); 
+
+	// Shows or hides lines of one event type. 
+	UFUNCTION(BlueprintCallable, Category = "Village UI") // Exposes the filter to Blueprints. 
+	void SetEventTypeVisible(EVillageEventType EventType, bool bVisible); 
+
+	// Shows every retained line again. 
+	UFUNCTION(BlueprintCallable, Category = "Village UI") // Exposes the filter to Blueprints. 
+	void ClearLogFilters(); 
+
+	// Number of most recent lines kept for display across all villagers. 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Village UI", meta = (ClampMin = "1")) // Exposes the retention window. 
+	int32 RetainedLogLines = 500; 
 #pragma endregion PublicInterface // Ends the public interface region. 
 
 protected: // Begins the protected section. 
@@ -63,9 +93,9 @@ protected: // Begins the protected section.
 	UPROPERTY(meta = (BindWidgetOptional)) // Allows optional widget binding from UMG. 
 	TObjectPtr<UTextBlock> ClockText; 
 
-	// Optional scroll box used to render log lines in UMG. 
+	// Optional list view used to render log lines in UMG; its entry class must be a UVillageLogEntryWidget. 
 	UPROPERTY(meta = (BindWidgetOptional)) // Allows optional widget binding from UMG. 
-	TObjectPtr<UScrollBox> LogScrollBox; 
+	TObjectPtr<UListView> LogListView; 
 #pragma endregion ProtectedInterface // Ends the protected interface region. 
 
 private: // Groups private helper methods. 
@@ -76,22 +106,33 @@ private: // Groups private helper methods.
 	// Updates the clock text with the provided time. 
 	void RefreshClockText(int32 Hour, int32 Minute); 
 
-	// Rebuilds the visible log list from the buffered messages. 
-	void RepopulateLog(); 
+	// Rebuilds the retained lines from the buffered messages of the registered villagers and an optional extra source. 
+	void RepopulateLog(UVillagerLogComponent* AdditionalSource); 
 
-	// Handles minute changes from the clock subsystem. 
-	UFUNCTION() // Marks the handler for delegate binding. 
-	void HandleMinuteChanged(int32 Hour, int32 Minute); 
+	// Appends one frame of hub events to the retained lines. 
+	void HandleEventBatch(TConstArrayView<const FVillageEventNotification*> Notifications); 
 
-	// Handles new log messages emitted by a villager. 
-	UFUNCTION() // Marks the handler for delegate binding. 
-	void HandleLogLineAdded(UVillagerLogComponent* SourceComponent, const FString& Message); 
+	// Drops lines beyond the retention window and refreshes the list. 
+	void TrimAndRefresh(); 
+
+	// Returns a recycled list item, or a new one when the pool is empty. 
+	UVillageLogListItem* AcquireItem(); 
+
+	// Moves the oldest retained lines to the retired list. 
+	void RetireItems(int32 Count); 
 
-	// Adds a styled log entry to the scroll box. 
-	void AddLogEntry(UVillagerLogComponent* SourceComponent, const FString& Message); 
+	// Pools retired lines once no list view row maps to them; the list view keeps rows for removed items until it regenerates. 
+	void RecycleRetiredItems(); 
 
-	// Binds to a log component if not already observed. 
-	void BindToLogComponent(UVillagerLogComponent* InLogComponent); 
+	// Rebuilds the list view items from the retained lines that pass the filters. 
+	void RefreshVisibleItems(); 
+
+	// Returns whether a retained line passes the villager and event type filters. 
+	bool PassesFilters(const UVillageLogListItem& Item) const; 
+
+	// Handles minute changes from the clock subsystem. 
+	UFUNCTION() // Marks the handler for delegate binding. 
+	void HandleMinuteChanged(int32 Hour, int32 Minute); 
 #pragma endregion PrivateMethods // Ends the private methods region. 
 
 private: // Begins the private state section. 
@@ -99,9 +140,42 @@ private: // Begins the private state section.
 	// Cached pointer to the clock subsystem. 
 	TWeakObjectPtr<UVillageClockSubsystem> ClockSubsystem; 
 
-	// Cached pointers to all villager log components being observed. 
-	UPROPERTY() // Keeps the observed components referenced for GC. 
-	TArray<TWeakObjectPtr<UVillagerLogComponent>> ObservedLogComponents; 
+	// Cached pointer to the hub delivering new lines. 
+	TWeakObjectPtr<UVillageEventHubSubsystem> EventHub; 
+
+	// Cached pointer to the village log formatting the lines. 
+	TWeakObjectPtr<UVillageEventLogSubsystem> EventLog; 
+
+	// Subscription to the event hub. 
+	FDelegateHandle EventBatchHandle; 
+
+	// Village-wide sequence of the newest retained line, so hub events already read from a buffer are skipped. 
+	uint64 LastRetainedSequence = 0; 
+
+	// Retained lines of all villagers, oldest first. 
+	UPROPERTY() // Keeps the items referenced for GC. 
+	TArray<TObjectPtr<UVillageLogListItem>> RetainedItems; 
+
+	// Lines dropped from the retention window, pooled once no list view entry widget shows them anymore. 
+	UPROPERTY() // Keeps the items referenced for GC. 
+	TArray<TObjectPtr<UVillageLogListItem>> RetiredItems; 
+
+	// Frame the latest lines were retired in; none are pooled before the list view ticked once since. 
+	uint64 RetiredFrame = 0; 
+
+	// Recycled lines ready for reuse. 
+	UPROPERTY() // Keeps the items referenced for GC. 
+	TArray<TObjectPtr<UVillageLogListItem>> ItemPool; 
+
+	// Retained lines passing the filters, handed to the list view. 
+	UPROPERTY() // Keeps the items referenced for GC. 
+	TArray<TObjectPtr<UObject>> VisibleItems; 
+
+	// Villager whose lines are shown; invalid shows all. 
+	FGameplayTag VillagerFilter; 
+
+	// Bit per EVillageEventType that is hidden. 
+	uint32 HiddenEventTypes = 0; 
 #pragma endregion PrivateState // Ends the private state region. 
 }; // Ends the widget class declaration. 
 #pragma endregion VillageStatusWidgetDeclaration // Ends the widget declaration region. 
@@ -19,10 +19,10 @@ class UVerticalBox;
 class UTextBlock; 
 // Forward-declared needs component type. 
 class UVillagerNeedsComponent; 
-// Forward-declared need runtime state struct. 
-struct FNeedRuntimeState; 
 // Forward-declared social component type.
 class UVillagerSocialComponent;
+// Forward-declared needs change summary struct. 
+struct FVillagerNeedsChangeSet; 
 #pragma endregion ForwardDeclarations // Ends the forward declarations region. 
 
 // Generated header required by Unreal reflection. 
@@ -45,6 +45,10 @@ public:
 	// Initializes the widget with both needs and social components for richer data.
 	UFUNCTION(BlueprintCallable, Category = "Villager Needs")
 	void InitializeFromNeedsAndSocial(UVillagerNeedsComponent* InNeedsComponent, UVillagerSocialComponent* InSocialComponent);
+
+	// Maximum display refreshes per second; changes arriving in between are coalesced. Zero refreshes every frame. 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Villager Needs", meta = (ClampMin = "0"))
+	float RefreshRateHz = 10.0f;
 #pragma endregion PublicInterface
 
 protected:
@@ -54,6 +58,9 @@ protected:
 
 	// Cleans up bindings when the widget is destroyed. 
 	virtual void NativeDestruct() override;
+
+	// Applies pending changes at the configured refresh rate. 
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 #pragma endregion ProtectedInterface
 
 private:
@@ -63,6 +70,7 @@ private:
 	{
 		UTextBlock* LabelText = nullptr; // Displays the need name. 
 		UTextBlock* ValueText = nullptr; // Displays the numeric value. 
+		int32 DisplayedValue = MIN_int32; // Value shown, scaled to the displayed precision. 
 	};
 
 	// Runtime widgets used to represent a single affection row.
@@ -70,6 +78,7 @@ private:
 	{
 		UTextBlock* LabelText = nullptr; // Displays the other villager id.
 		UTextBlock* ValueText = nullptr; // Displays affection value.
+		int32 DisplayedValue = MIN_int32; // Value shown, scaled to the displayed precision.
 	};
 #pragma endregion PrivateTypes
 
@@ -84,18 +93,23 @@ private:
 	// Refreshes the UI with the latest needs values. 
 	void RefreshNeeds();
 
+	// Refreshes the row of a single need. 
+	void RefreshNeedRow(int32 NeedIndex);
+
 	// Rebuilds the UI rows for current affection entries.
 	void RebuildAffectionRows();
 
 	// Refreshes the UI with the latest affection values.
 	void RefreshAffections();
 
-	// Handles needs updates from the component. 
-	UFUNCTION()
-	void HandleNeedsUpdated(UVillagerNeedsComponent* UpdatedComponent);
+	// Records coalesced needs changes from the component for the next refresh. 
+	void HandleNeedsChanged(UVillagerNeedsComponent* UpdatedComponent, const FVillagerNeedsChangeSet& ChangeSet);
 
-	// Normalizes a need value into the 0-1 range. 
-	float NormalizeNeedValue(const FNeedRuntimeState& Need) const;
+	// Records affection changes from the social component for the next refresh.
+	void HandleAffectionChanged(UVillagerSocialComponent* UpdatedComponent);
+
+	// Applies the changes recorded since the last refresh. 
+	void FlushPendingChanges();
 
 	// Refreshes the villager identifier text block.
 	void RefreshVillagerId();
@@ -121,11 +135,29 @@ private:
 	// Cached social component used as data source for affections.
 	TWeakObjectPtr<UVillagerSocialComponent> SocialComponent;
 
-	// Cached widget rows mapped by need tag. 
-	TMap<FGameplayTag, FNeedRowWidgets> NeedRowMap;
+	// Binding to the needs component change notifications.
+	FDelegateHandle NeedsChangedHandle;
+
+	// Binding to the social component change notifications.
+	FDelegateHandle AffectionChangedHandle;
+
+	// Cached widget rows indexed like the component's needs. 
+	TArray<FNeedRowWidgets> NeedRows;
 
 	// Cached affection rows mapped by villager id.
 	TMap<FGameplayTag, FAffectionRowWidgets> AffectionRowMap;
+
+	// Needs whose value changed since the last refresh, by need index. 
+	TBitArray<> DirtyNeeds;
+
+	// Whether any change awaits the next refresh. 
+	bool bHasPendingChanges = false;
+
+	// Whether the need list was rebuilt since the last refresh. 
+	bool bNeedRowsRebuildPending = false;
+
+	// Real time elapsed since the last refresh. 
+	float TimeSinceRefresh = 0.0f;
 #pragma endregion PrivateState
 };
 #pragma endregion VillagerNeedsWidgetDeclaration // Ends the widget declaration region. 
@@ -0,0 +1,111 @@
+// Ensures the header is included only once during compilation to avoid duplicate symbols.
+#pragma once // Single-include guard directive.
+
+// Region: Includes for commandlet declarations.
+#pragma region Includes // Begin include region.
+// Provides core Unreal types and macros.
+#include "CoreMinimal.h" // Core definitions and utilities.
+// Declares the base commandlet class for headless automation.
+#include "Commandlets/Commandlet.h" // Commandlet base class.
+// Exposes villager archetype data assets spawned by the benchmark.
+#include "Simulation/Data/VillagerDataAssets.h" // Villager data definitions.
+#pragma endregion Includes // End include region.
+
+// Generated header include for Unreal reflection.
+#include "SimulationBenchmarkCommandlet.generated.h" // Auto-generated reflection data.
+
+// Forward declaration of the world hosting the benchmark.
+class UWorld; // World type used by helpers.
+
+// Runs the villager simulation headless as fast as possible and reports throughput.
+// Usage: -run=SimulationBenchmark -nullrhi [-Map=/Game/Maps/Village] [-Villagers=100] [-Days=1] [-TickSeconds=1.0] [-Csv=Path.csv] [-ValidateCurves] [-SerialNeeds] [-SerialDecisions] [-LazyNeeds] [-Mass] [-FullLocomotion] [-Lightweight] [-VillageSeed=0]
+UCLASS() // Enable reflection for the commandlet class.
+class USimulationBenchmarkCommandlet : public UCommandlet // Derives from UCommandlet for headless execution.
+{ // Begin commandlet class definition.
+	// Enables reflection and boilerplate generation.
+	GENERATED_BODY() // Macro expanding to reflection code.
+
+public: // Public interface section.
+	// Initializes commandlet metadata and defaults.
+	USimulationBenchmarkCommandlet(); // Constructor declaration.
+
+	// Entry point invoked by the commandlet runner.
+	virtual int32 Main(const FString& Params) override; // Main execution method.
+
+private: // Private helper section.
+	// Reads benchmark options from the command line.
+	void ParseOptions(const FString& Params); // Option parsing routine.
+
+	// Loads the requested map or creates an empty world and begins play in it.
+	UWorld* CreateBenchmarkWorld(); // World setup routine.
+
+	// Ends play and releases the benchmark world.
+	void DestroyBenchmarkWorld(UWorld* World); // World teardown routine.
+
+	// Loads the villager archetypes cycled through while spawning.
+	bool LoadArchetypes(); // Archetype loading routine.
+
+	// Rebakes archetype curve tables and logs their error against the source curves.
+	void ValidateCurveTables(); // Curve table validation routine.
+
+	// Spawns the configured number of villagers around the world origin.
+	int32 SpawnVillagers(UWorld* World); // Villager spawning routine.
+
+	// Advances the clock minute by minute and records per-minute cost.
+	bool RunSimulation(UWorld* World); // Simulation loop.
+
+	// Logs the throughput summary and writes the optional CSV.
+	void ReportResults(int32 SpawnedCount) const; // Reporting routine.
+
+	// Map package to load; empty runs in a blank world.
+	FString MapName; // Requested map.
+
+	// Optional CSV output path for per-minute samples.
+	FString CsvPath; // Requested CSV path.
+
+	// Number of villagers to spawn.
+	int32 VillagerCount; // Requested villager count.
+
+	// Number of in-game days to simulate.
+	int32 SimDays; // Requested simulated days.
+
+	// World delta seconds fed to each tick so movement and timers progress.
+	float TickSeconds; // Fixed world tick delta.
+
+	// Whether baked curve tables are checked against their source curves before the run.
+	bool bValidateCurves; // Requested curve validation.
+
+	// Whether villagers integrate their own needs instead of the village-wide stage.
+	bool bSerialNeeds; // Requested per-villager need integration.
+
+	// Whether villagers decide immediately instead of in the village-wide decision stage.
+	bool bSerialDecisions; // Requested per-villager decisions.
+
+	// Whether villagers evaluate needs lazily from rate segments and wake only at predicted crossings.
+	bool bLazyNeeds; // Requested lazy need evaluation.
+
+	// Whether villagers are spawned as Mass entities instead of actors.
+	bool bMassVillagers; // Requested Mass backend.
+
+	// Whether every move walks the navmesh instead of travelling abstractly when unobserved.
+	bool bFullLocomotion; // Requested full locomotion.
+
+	// Whether actor villagers are spawned as lightweight pawns instead of characters.
+	bool bLightweightVillagers; // Requested lightweight pawns.
+
+	// Mass villagers alive after the run, or INDEX_NONE before it.
+	int32 LastMassVillagerCount; // Mass survivors.
+
+	// Archetypes assigned round-robin to spawned villagers.
+	UPROPERTY() // Keep archetypes referenced for the benchmark duration.
+	TArray<TObjectPtr<UVillagerArchetypeDataAsset>> Archetypes; // Loaded archetype assets.
+
+	// Wall-clock seconds spent on each simulated minute including the world tick.
+	TArray<double> MinuteCosts; // Per-minute cost samples.
+
+	// Wall-clock seconds spent inside clock advancement for each minute.
+	TArray<double> ClockCosts; // Per-minute clock samples.
+
+	// Wall-clock seconds spent for the whole simulation loop.
+	double TotalSeconds; // Total loop time.
+}; // End commandlet class definition.